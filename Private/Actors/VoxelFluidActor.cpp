@@ -167,6 +167,8 @@ void AVoxelFluidActor::BeginPlay()
 		{
 			SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_FirstChunkLoad);
 			
+			FFluidSimulationThread::FScopedAccess SimulationAccess(ChunkManager);
+
 			TArray<FVector> ViewerPositions = GetViewerPositions();
 			// Force an update to load chunks
 			ChunkManager->UpdateChunks(0.1f, ViewerPositions);
@@ -197,7 +199,7 @@ void AVoxelFluidActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		ChunkManager->ClearAllChunks();
 	}
 
-	FluidSources.Empty();
+	SourceRegistry.Reset();
 
 
 	Super::EndPlay(EndPlayReason);
@@ -207,13 +209,17 @@ void AVoxelFluidActor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	if (ChunkManager)
+	{
+		ChunkManager->GetFrameProfiler().TickFrame();
+	}
+
 	// Update water systems to follow player
-	static float WaterUpdateTimer = 0.0f;
-	WaterUpdateTimer += DeltaTime;
+	StatsUpdateTimer += DeltaTime;
 	
-	if (WaterUpdateTimer > 0.5f) // Update every 0.5 seconds
+	if (StatsUpdateTimer > 0.5f) // Update every 0.5 seconds
 	{
-		WaterUpdateTimer = 0.0f;
+		StatsUpdateTimer = 0.0f;
 		
 		// Get current player position
 		FVector PlayerPos = FVector::ZeroVector;
@@ -242,13 +248,19 @@ void AVoxelFluidActor::Tick(float DeltaTime)
 	{
 		const double StartTime = FPlatformTime::Seconds();
 
-		if (bUseFixedTimestep)
+		if (SimulationThread)
+		{
+			// Stepping happens on the simulation thread; the game thread only syncs streaming and edits
+			SyncSimulationThread(DeltaTime);
+		}
+		else if (bUseFixedTimestep)
 		{
 			// Accumulate time for fixed timestep simulation
 			SimulationAccumulator += DeltaTime * SimulationSpeed;
 
-			// Run simulation steps at fixed timestep
-			while (SimulationAccumulator >= SimulationTimestep)
+			// Run simulation steps at fixed timestep, capped per frame so a hitch cannot snowball
+			int32 StepsThisFrame = 0;
+			while (SimulationAccumulator >= SimulationTimestep && StepsThisFrame < MaxSimulationStepsPerFrame)
 			{
 				if (ChunkManager)
 				{
@@ -256,12 +268,29 @@ void AVoxelFluidActor::Tick(float DeltaTime)
 				}
 
 				SimulationAccumulator -= SimulationTimestep;
+				++StepsThisFrame;
+				++GameThreadStepCount;
+			}
+
+			// Shed whole steps still owed; the fractional remainder keeps the interpolation phase
+			if (SimulationAccumulator >= SimulationTimestep)
+			{
+				const float ShedTime = SimulationAccumulator - FMath::Fmod(SimulationAccumulator, SimulationTimestep);
+				SimulationAccumulator -= ShedTime;
+				INC_FLOAT_STAT_BY(STAT_VoxelFluid_SimTimeShedMS, ShedTime * 1000.0f);
+			}
+
+			SET_DWORD_STAT(STAT_VoxelFluid_SimStepsPerFrame, StepsThisFrame);
+			if (StepsThisFrame > 0)
+			{
+				CaptureInterpolationSnapshot();
 			}
 		}
 		else
 		{
-			// Variable timestep simulation
+			// Variable timestep simulation; there is no step phase to interpolate
 			const float ScaledDeltaTime = DeltaTime * SimulationSpeed;
+			InterpolationSnapshot.Reset();
 
 			if (ChunkManager)
 			{
@@ -269,7 +298,9 @@ void AVoxelFluidActor::Tick(float DeltaTime)
 			}
 		}
 
-		LastFrameSimulationTime = (FPlatformTime::Seconds() - StartTime) * 1000.0f; // Convert to ms
+		LastFrameSimulationTime = SimulationThread
+			? SimulationThread->GetLastStepTimeMs()
+			: (FPlatformTime::Seconds() - StartTime) * 1000.0f; // Convert to ms
 		
 		// Update performance comparison stats
 		if (ChunkManager)
@@ -310,15 +341,10 @@ void AVoxelFluidActor::Tick(float DeltaTime)
 	}
 
 	// Update fluid source statistics
-	if (FluidSources.Num() > 0)
+	if (SourceRegistry.Num() > 0)
 	{
-		float TotalFlowRate = 0.0f;
-		for (const auto& Source : FluidSources)
-		{
-			TotalFlowRate += Source.Value;
-		}
-		// SET_DWORD_STAT(STAT_VoxelFluid_ActiveSources, FluidSources.Num()); // Hidden - source detail
-		// SET_FLOAT_STAT(STAT_VoxelFluid_TotalSourceFlow, TotalFlowRate); // Hidden - source detail
+		// SET_DWORD_STAT(STAT_VoxelFluid_ActiveSources, SourceRegistry.Num()); // Hidden - source detail
+		// SET_FLOAT_STAT(STAT_VoxelFluid_TotalSourceFlow, SourceRegistry.GetTotalFlowRate()); // Hidden - source detail
 	}
 	else
 	{
@@ -326,6 +352,7 @@ void AVoxelFluidActor::Tick(float DeltaTime)
 		// SET_FLOAT_STAT(STAT_VoxelFluid_TotalSourceFlow, 0.0f); // Hidden - source detail
 	}
 
+	VisualizationComponent->SetSimulationInterpolationAlpha(GetSimulationInterpolationAlpha());
 	VisualizationComponent->UpdateVisualization();
 }
 
@@ -402,6 +429,7 @@ void AVoxelFluidActor::InitializeFluidSystem()
 						// If cell is solid terrain, remove ANY water from it
 						if (Chunk->Cells[i].bIsSolid && Chunk->Cells[i].FluidLevel > 0.0f)
 						{
+							Chunk->MassFlows.Add(EFluidMassCategory::Terrain, -Chunk->Cells[i].FluidLevel);
 							Chunk->Cells[i].FluidLevel = 0.0f;
 							Chunk->Cells[i].bSettled = false;
 							Chunk->Cells[i].bSourceBlock = false;
@@ -443,6 +471,7 @@ void AVoxelFluidActor::InitializeFluidSystem()
 								{
 									if (Chunk->Cells[i].bIsSolid)
 									{
+										Chunk->MassFlows.Add(EFluidMassCategory::Terrain, -Chunk->Cells[i].FluidLevel);
 										Chunk->Cells[i].FluidLevel = 0.0f;
 										Chunk->Cells[i].bSourceBlock = false;
 									}
@@ -473,6 +502,7 @@ void AVoxelFluidActor::InitializeFluidSystem()
 										{
 											if (RetryChunk->Cells[i].bIsSolid)
 											{
+												RetryChunk->MassFlows.Add(EFluidMassCategory::Terrain, -RetryChunk->Cells[i].FluidLevel);
 												RetryChunk->Cells[i].FluidLevel = 0.0f;
 												RetryChunk->Cells[i].bSourceBlock = false;
 											}
@@ -505,6 +535,7 @@ void AVoxelFluidActor::InitializeFluidSystem()
 	{
 		SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_VisualizationInit);
 		VisualizationComponent->SetChunkManager(ChunkManager);
+		VisualizationComponent->SetSnapshotSource([this]() { return GetRenderSnapshot(); });
 	}
 
 	UpdateSimulationBounds();
@@ -514,14 +545,83 @@ void AVoxelFluidActor::StartSimulation()
 {
 	bIsSimulating = true;
 
+	if (bUseSimulationThread)
+	{
+		StartSimulationThread();
+	}
 }
 
 void AVoxelFluidActor::StopSimulation()
 {
+	StopSimulationThread();
 	bIsSimulating = false;
 
 }
 
+void AVoxelFluidActor::StartSimulationThread()
+{
+	if (SimulationThread || !ChunkManager)
+		return;
+
+	SimulationThread = MakeUnique<FFluidSimulationThread>(ChunkManager, SimulationThreadRate);
+	SimulationThread->SetTimeScale(SimulationSpeed);
+	SimulationThread->SetMaxCatchUpSteps(MaxSimulationStepsPerFrame);
+	SimulationThread->SetPreStepCallback([this](float StepTime)
+	{
+		// Chunks were prepared at the last sync point; nothing is created off the game thread
+		if (!bPauseFluidSources)
+		{
+			SourceRegistry.ApplyEmissions(StepTime, false);
+		}
+	});
+
+	if (!SimulationThread->Start())
+	{
+		VOXELFLUID_LOG(LogVoxelFluidSim, Warning, TEXT("VoxelFluidActor: Could not start the simulation thread, simulating on the game thread"));
+		SimulationThread.Reset();
+		return;
+	}
+
+	PendingStreamingTime = 0.0f;
+	InterpolationSnapshot.Reset();
+}
+
+void AVoxelFluidActor::StopSimulationThread()
+{
+	if (!SimulationThread)
+		return;
+
+	SimulationThread->Shutdown();
+	SimulationThread.Reset();
+}
+
+void AVoxelFluidActor::SyncSimulationThread(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_SimThreadSync);
+
+	SimulationThread->SetTimeScale(SimulationSpeed);
+	SimulationThread->SetStepRate(SimulationThreadRate);
+	SimulationThread->SetMaxCatchUpSteps(MaxSimulationStepsPerFrame);
+
+	// Streaming and source chunk preparation need the chunk maps; if a step is running they wait a frame
+	PendingStreamingTime += DeltaTime;
+	const bool bSynced = SimulationThread->SyncWithGameThread([this]()
+	{
+		UpdateChunkStreaming(PendingStreamingTime);
+		if (!bPauseFluidSources)
+		{
+			SourceRegistry.PrepareChunks();
+		}
+	});
+
+	if (bSynced)
+	{
+		PendingStreamingTime = 0.0f;
+	}
+
+	SET_FLOAT_STAT(STAT_VoxelFluid_SimThreadStepMS, SimulationThread->GetLastStepTimeMs());
+}
+
 void AVoxelFluidActor::ResetSimulation()
 {
 	StopSimulation();
@@ -531,7 +631,7 @@ void AVoxelFluidActor::ResetSimulation()
 		ChunkManager->ClearAllChunks();
 	}
 
-	FluidSources.Empty();
+	SourceRegistry.Reset();
 
 	if (VoxelIntegration && TargetVoxelWorld)
 	{
@@ -540,40 +640,59 @@ void AVoxelFluidActor::ResetSimulation()
 
 }
 
-void AVoxelFluidActor::AddFluidSource(const FVector& WorldPosition, float FlowRate)
+int32 AVoxelFluidActor::AddFluidSource(const FVector& WorldPosition, float FlowRate)
 {
 	// Use DefaultSourceFlowRate if no flow rate is specified
 	const float ActualFlowRate = (FlowRate < 0.0f) ? DefaultSourceFlowRate : FlowRate;
 	// Apply density multiplier to the flow rate
 	const float FinalFlowRate = ActualFlowRate * FluidDensityMultiplier;
 
-	UE_LOG(LogTemp, Warning, TEXT("VoxelFluidActor::AddFluidSource at %s, flow rate: %.2f (final: %.2f)"), 
-		*WorldPosition.ToString(), ActualFlowRate, FinalFlowRate);
+	const int32 SourceId = SourceRegistry.AddSource(WorldPosition, FinalFlowRate);
 
-	if (FluidSources.Contains(WorldPosition))
-	{
-		FluidSources[WorldPosition] = FinalFlowRate;
-		UE_LOG(LogTemp, Warning, TEXT("VoxelFluidActor: Updated existing fluid source. Total sources: %d"), FluidSources.Num());
-	}
-	else
+	VOXELFLUID_LOG(LogVoxelFluidSim, Log, TEXT("VoxelFluidActor::AddFluidSource %d at %s, flow rate: %.2f (final: %.2f). Total sources: %d"), 
+		SourceId, *WorldPosition.ToString(), ActualFlowRate, FinalFlowRate, SourceRegistry.Num());
+
+	return SourceId;
+}
+
+void AVoxelFluidActor::RemoveFluidSource(const FVector& WorldPosition)
+{
+	SourceRegistry.RemoveSource(SourceRegistry.FindSourceAtPosition(WorldPosition));
+}
+
+FFluidBulkEditResult AVoxelFluidActor::ApplyFluidBulkEdit(const FFluidBulkEdit& Edit)
+{
+	if (!ChunkManager)
 	{
-		FluidSources.Add(WorldPosition, FinalFlowRate);
-		UE_LOG(LogTemp, Warning, TEXT("VoxelFluidActor: Added new fluid source. Total sources: %d"), FluidSources.Num());
+		return FFluidBulkEditResult();
 	}
+
+	// Applied in place rather than queued so the caller gets the real volumes; this waits for a running step
+	FFluidSimulationThread::FScopedAccess SimulationAccess(ChunkManager);
+	const FFluidBulkEditResult Result = ChunkManager->ApplyBulkEdit(Edit);
+
+	VOXELFLUID_LOG(LogVoxelFluidSim, Verbose, TEXT("VoxelFluidActor: Bulk edit of %d cells changed %d chunks (+%.2f / -%.2f)"), 
+		Result.CellsEdited, Result.ChunksChanged, Result.VolumeAdded, Result.VolumeRemoved);
+
+	return Result;
 }
 
-void AVoxelFluidActor::RemoveFluidSource(const FVector& WorldPosition)
+bool AVoxelFluidActor::RemoveFluidSourceById(int32 SourceId)
 {
-	FluidSources.Remove(WorldPosition);
+	return SourceRegistry.RemoveSource(SourceId);
+}
 
+bool AVoxelFluidActor::SetFluidSourceFlowRate(int32 SourceId, float FlowRate)
+{
+	return SourceRegistry.SetFlowRate(SourceId, FlowRate * FluidDensityMultiplier);
 }
 
 void AVoxelFluidActor::AddFluidAtLocation(const FVector& WorldPosition, float Amount)
 {
 	// Apply accumulation and density multiplier
-	const float AdjustedAmount = Amount * FluidDensityMultiplier * (1.0f + FluidAccumulation);
+	const float AdjustedAmount = GetAdjustedFluidAmount(Amount);
 
-	UE_LOG(LogTemp, Warning, TEXT("VoxelFluidActor::AddFluidAtLocation at %s, amount: %.2f (adjusted: %.2f)"), 
+	VOXELFLUID_LOG(LogVoxelFluidSim, Verbose, TEXT("VoxelFluidActor::AddFluidAtLocation at %s, amount: %.2f (adjusted: %.2f)"), 
 		*WorldPosition.ToString(), Amount, AdjustedAmount);
 
 	// Notify water activation manager about fluid being added
@@ -585,13 +704,22 @@ void AVoxelFluidActor::AddFluidAtLocation(const FVector& WorldPosition, float Am
 
 	if (ChunkManager)
 	{
-		ChunkManager->AddFluidAtWorldPosition(WorldPosition, AdjustedAmount);
-		UE_LOG(LogTemp, Warning, TEXT("VoxelFluidActor: Added fluid via ChunkManager"));
+		if (SimulationThread)
+		{
+			SimulationThread->EnqueueCommand({ ChunkManager->GetChunkCoordFromWorldPosition(WorldPosition) },
+				[WorldPosition, AdjustedAmount](UFluidChunkManager& Manager)
+			{
+				Manager.AddFluidAtWorldPosition(WorldPosition, AdjustedAmount);
+			});
+		}
+		else
+		{
+			ChunkManager->AddFluidAtWorldPosition(WorldPosition, AdjustedAmount);
+		}
 	}
 	else if (VoxelIntegration)
 	{
 		VoxelIntegration->AddFluidAtWorldPosition(WorldPosition, AdjustedAmount);
-		UE_LOG(LogTemp, Warning, TEXT("VoxelFluidActor: Added fluid via VoxelIntegration"));
 	}
 	else
 	{
@@ -611,6 +739,8 @@ void AVoxelFluidActor::SetVoxelWorld(AActor* InVoxelWorld)
 
 void AVoxelFluidActor::RefreshTerrainData()
 {
+	FFluidSimulationThread::FScopedAccess SimulationAccess(ChunkManager);
+
 	if (VoxelIntegration)
 	{
 		VoxelIntegration->UpdateChunkedTerrainHeights();
@@ -664,24 +794,10 @@ void AVoxelFluidActor::TestFluidSpawn()
 
 void AVoxelFluidActor::UpdateFluidSources(float DeltaTime)
 {
-	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_FluidSourceUpdate);
-
 	if (ChunkManager)
 	{
-		// SET_DWORD_STAT(STAT_VoxelFluid_ActiveSources, FluidSources.Num()); // Hidden - source detail
-
-		float TotalFlowRate = 0.0f;
-		for (const auto& Source : FluidSources)
-		{
-			const FVector& SourcePos = Source.Key;
-			const float SourceFlowRate = Source.Value;
-			TotalFlowRate += SourceFlowRate;
-
-			// Use the source's specific flow rate, not the global one
-			ChunkManager->AddFluidAtWorldPosition(SourcePos, SourceFlowRate * DeltaTime);
-		}
-
-		// SET_FLOAT_STAT(STAT_VoxelFluid_TotalSourceFlow, TotalFlowRate); // Hidden - source detail
+		// Emissions are applied per chunk from pre-resolved cell indices
+		SourceRegistry.ApplyEmissions(DeltaTime);
 	}
 }
 
@@ -851,11 +967,109 @@ void AVoxelFluidActor::EnableProfiling(bool bEnable)
 	{
 		LastProfilingTime = FDateTime::Now();
 	}
-	else
+
+	if (ChunkManager)
+	{
+		FFluidFrameProfiler& Profiler = ChunkManager->GetFrameProfiler();
+		if (bEnable)
+		{
+			Profiler.Reset();
+			Profiler.SetHitchThresholdMs(HitchThresholdMs);
+		}
+		Profiler.SetEnabled(bEnable);
+	}
+}
+
+FString AVoxelFluidActor::GetHitchReport() const
+{
+	if (!ChunkManager)
+	{
+		return TEXT("No chunk manager");
+	}
+
+	const FFluidFrameProfiler& Profiler = ChunkManager->GetFrameProfiler();
+	if (!Profiler.IsEnabled())
+	{
+		return TEXT("Profiling disabled; call EnableProfiling(true)");
+	}
+
+	const FFluidTimingHistogram FluidHistogram = Profiler.GetFluidHistogram();
+	FString Report = FString::Printf(TEXT("Frames: %lld, hitches: %d (threshold %.1f ms)\n"),
+		FluidHistogram.GetCount(), Profiler.GetTotalHitchCount(), HitchThresholdMs);
+	Report += FString::Printf(TEXT("%-16s %8s %8s %8s %8s %8s\n"), TEXT("Phase"), TEXT("p50"), TEXT("p90"), TEXT("p99"), TEXT("p99.9"), TEXT("max"));
+
+	auto AddRow = [&Report](const TCHAR* Name, const FFluidTimingHistogram& Histogram)
+	{
+		Report += FString::Printf(TEXT("%-16s %8.2f %8.2f %8.2f %8.2f %8.2f\n"), Name,
+			Histogram.GetPercentile(50.0), Histogram.GetPercentile(90.0), Histogram.GetPercentile(99.0),
+			Histogram.GetPercentile(99.9), Histogram.GetMax());
+	};
+
+	for (int32 i = 0; i < (int32)EFluidFramePhase::Count; ++i)
+	{
+		const EFluidFramePhase Phase = (EFluidFramePhase)i;
+		AddRow(LexToString(Phase), Profiler.GetPhaseHistogram(Phase));
+	}
+	AddRow(TEXT("Fluid total"), FluidHistogram);
+	AddRow(TEXT("Sim step"), Profiler.GetStepHistogram());
+	AddRow(TEXT("Frame"), Profiler.GetFrameHistogram());
+
+	const TArray<FFluidHitchRecord> Hitches = Profiler.GetHitches();
+	const int32 FirstShown = FMath::Max(0, Hitches.Num() - 10);
+	for (int32 i = FirstShown; i < Hitches.Num(); ++i)
+	{
+		Report += Hitches[i].ToString() + TEXT("\n");
+	}
+
+	return Report;
+}
+
+void AVoxelFluidActor::EnableChunkProfiling(bool bEnable)
+{
+	if (ChunkManager)
+	{
+		FFluidChunkProfiler& Profiler = ChunkManager->GetChunkProfiler();
+		if (bEnable)
+		{
+			Profiler.Reset();
+		}
+		Profiler.SetEnabled(bEnable);
+	}
+}
+
+FString AVoxelFluidActor::GetWorstChunksReport(int32 Count) const
+{
+	if (!ChunkManager)
+	{
+		return TEXT("No chunk manager");
+	}
+
+	return ChunkManager->GetChunkProfiler().GetWorstChunksReport(FMath::Max(Count, 1), EFluidChunkProfileMetric::TotalMs);
+}
+
+bool AVoxelFluidActor::ExportChunkHeatmap(const FString& FilePath) const
+{
+	return ChunkManager && ChunkManager->GetChunkProfiler().SaveHeatmap(FilePath);
+}
+
+void AVoxelFluidActor::SetMassAuditInterval(int32 IntervalSteps)
+{
+	if (ChunkManager)
 	{
+		ChunkManager->GetMassLedger().SetAuditInterval(IntervalSteps);
 	}
 }
 
+FString AVoxelFluidActor::GetMassAuditReport(int32 WorstChunkCount) const
+{
+	if (!ChunkManager)
+	{
+		return TEXT("No chunk manager");
+	}
+
+	return ChunkManager->GetMassLedger().GetReport(FMath::Max(WorstChunkCount, 0));
+}
+
 int32 AVoxelFluidActor::GetActiveCellCount() const
 {
 	if (ChunkManager)
@@ -898,6 +1112,14 @@ void AVoxelFluidActor::InitializeChunkSystem()
 	const FVector WorldSize = ActiveBoundsExtent * 2.0f;
 
 	ChunkManager->Initialize(ChunkSize, CellSize, SimulationOrigin, WorldSize);
+
+	// Sources resolve their cells against the new chunk layout
+	SourceRegistry.Bind(ChunkManager);
+	ChunkManager->OnChunkUnloadedDelegate.Remove(SourceRegistryUnloadHandle);
+	SourceRegistryUnloadHandle = ChunkManager->OnChunkUnloadedDelegate.AddLambda([this](const FFluidChunkCoord& ChunkCoord)
+	{
+		SourceRegistry.OnChunkUnloaded(ChunkCoord);
+	});
 	
 	double ChunkInitTime = (FPlatformTime::Seconds() - StepStartTime) * 1000.0;
 	UE_LOG(LogTemp, Warning, TEXT("[PROFILING] ChunkManager Initialize: %.2f ms"), ChunkInitTime);
@@ -957,6 +1179,26 @@ void AVoxelFluidActor::InitializeChunkSystem()
 }
 
 void AVoxelFluidActor::UpdateChunkSystem(float DeltaTime)
+{
+	if (!ChunkManager)
+		return;
+
+	FFluidAllocationTracker::BeginStep();
+
+	UpdateChunkStreaming(DeltaTime);
+
+	// Add fluid from all active sources using their individual flow rates (unless paused)
+	if (!bPauseFluidSources && SourceRegistry.Num() > 0)
+	{
+		UpdateFluidSources(DeltaTime);
+	}
+
+	ChunkManager->UpdateSimulation(DeltaTime);
+
+	FFluidAllocationTracker::EndStep();
+}
+
+void AVoxelFluidActor::UpdateChunkStreaming(float DeltaTime)
 {
 	if (!ChunkManager)
 		return;
@@ -982,28 +1224,92 @@ void AVoxelFluidActor::UpdateChunkSystem(float DeltaTime)
 		TArray<FVector> ViewerPositions = GetViewerPositions();
 		ChunkManager->UpdateChunks(DeltaTime, ViewerPositions);
 	}
+}
+
+FFluidSimulationSnapshotPtr AVoxelFluidActor::GetFluidSnapshot() const
+{
+	return SimulationThread ? SimulationThread->GetLatestSnapshot() : FFluidSimulationSnapshotPtr();
+}
+
+FFluidSimulationSnapshotPtr AVoxelFluidActor::GetRenderSnapshot() const
+{
+	return SimulationThread ? SimulationThread->GetLatestSnapshot() : InterpolationSnapshot;
+}
+
+float AVoxelFluidActor::GetSimulationInterpolationAlpha() const
+{
+	if (!bIsSimulating)
+		return 1.0f;
+
+	if (SimulationThread)
+		return SimulationThread->GetInterpolationAlpha();
+
+	if (!bUseFixedTimestep || SimulationTimestep <= 0.0f)
+		return 1.0f;
+
+	return FMath::Clamp(SimulationAccumulator / SimulationTimestep, 0.0f, 1.0f);
+}
+
+void AVoxelFluidActor::CaptureInterpolationSnapshot()
+{
+	// Only marching cubes meshes blend between steps; other modes keep reading live chunks
+	const bool bWantsInterpolation = ChunkManager && VisualizationComponent
+		&& VisualizationComponent->RenderMode == EFluidRenderMode::MarchingCubes
+		&& VisualizationComponent->bInterpolateSimulationSteps;
+	if (!bWantsInterpolation)
+	{
+		InterpolationSnapshot.Reset();
+		return;
+	}
 
-	// Add fluid from all active sources using their individual flow rates (unless paused)
-	if (!bPauseFluidSources && FluidSources.Num() > 0)
+	InterpolationSnapshot = FFluidSimulationSnapshot::Capture(*ChunkManager, InterpolationSnapshot.Get(), GameThreadStepCount, GameThreadStepCount * SimulationTimestep);
+}
+
+float AVoxelFluidActor::GetFluidLevelAtLocation(const FVector& WorldPosition) const
+{
+	if (const FFluidSimulationSnapshotPtr Snapshot = GetFluidSnapshot())
 	{
-		for (const auto& Source : FluidSources)
-		{
-			const FVector& SourcePos = Source.Key;
-			const float SourceFlowRate = Source.Value;
-			ChunkManager->AddFluidAtWorldPosition(SourcePos, SourceFlowRate * DeltaTime);
-		}
-		
-		// Debug log to verify sources are working
-		static float DebugTimer = 0.0f;
-		DebugTimer += DeltaTime;
-		if (DebugTimer > 1.0f)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("VoxelFluid: Processing %d fluid sources"), FluidSources.Num());
-			DebugTimer = 0.0f;
-		}
+		return Snapshot->GetFluidAtWorldPosition(WorldPosition);
 	}
+	return ChunkManager ? ChunkManager->GetFluidAtWorldPosition(WorldPosition) : 0.0f;
+}
 
-	ChunkManager->UpdateSimulation(DeltaTime);
+FVector AVoxelFluidActor::GetFlowVelocityAtLocation(const FVector& WorldPosition) const
+{
+	if (const FFluidSimulationSnapshotPtr Snapshot = GetFluidSnapshot())
+	{
+		return Snapshot->GetFlowVelocityAtWorldPosition(WorldPosition);
+	}
+	return ChunkManager ? ChunkManager->GetFlowVelocityAtWorldPosition(WorldPosition) : FVector::ZeroVector;
+}
+
+float AVoxelFluidActor::GetFluidDepthAtLocation(const FVector& WorldPosition) const
+{
+	if (const FFluidSimulationSnapshotPtr Snapshot = GetFluidSnapshot())
+	{
+		return Snapshot->GetFluidDepthAtWorldPosition(WorldPosition);
+	}
+
+	if (!ChunkManager)
+		return 0.0f;
+
+	// Same column walk as the snapshot, on live cells
+	const float CellHeight = ChunkManager->CellSize;
+	const float CellBottom = ChunkManager->WorldOrigin.Z + FMath::FloorToFloat((WorldPosition.Z - ChunkManager->WorldOrigin.Z) / CellHeight) * CellHeight;
+	FVector Sample(WorldPosition.X, WorldPosition.Y, CellBottom + CellHeight * 0.5f);
+	float ColumnTop = CellBottom;
+	float Level = ChunkManager->GetFluidAtWorldPosition(Sample);
+	while (Level > KINDA_SMALL_NUMBER)
+	{
+		ColumnTop += FMath::Min(Level, 1.0f) * CellHeight;
+		if (Level < 1.0f)
+			break;
+
+		Sample.Z += CellHeight;
+		Level = ChunkManager->GetFluidAtWorldPosition(Sample);
+	}
+
+	return FMath::Max(0.0f, ColumnTop - WorldPosition.Z);
 }
 
 TArray<FVector> AVoxelFluidActor::GetViewerPositions() const
@@ -1146,6 +1452,8 @@ void AVoxelFluidActor::PostEditChangeProperty(FPropertyChangedEvent& PropertyCha
 
 void AVoxelFluidActor::TestPersistenceAtLocation(const FVector& WorldPosition)
 {
+	FFluidSimulationThread::FScopedAccess SimulationAccess(ChunkManager);
+
 	if (!ChunkManager)
 	{
 		return;
@@ -1156,6 +1464,8 @@ void AVoxelFluidActor::TestPersistenceAtLocation(const FVector& WorldPosition)
 
 void AVoxelFluidActor::ForceUnloadAllChunks()
 {
+	FFluidSimulationThread::FScopedAccess SimulationAccess(ChunkManager);
+
 	if (!ChunkManager)
 	{
 		return;
@@ -2318,6 +2628,8 @@ void AVoxelFluidActor::DebugStuttering()
 
 void AVoxelFluidActor::OnStaticWaterActivationRequest(const FVector& Position, float Radius, float WaterLevel)
 {
+	FFluidSimulationThread::FScopedAccess SimulationAccess(ChunkManager);
+
 	if (!bAcceptStaticWaterActivation)
 	{
 		return;
@@ -2379,6 +2691,8 @@ bool AVoxelFluidActor::IsPointInStaticWater(const FVector& WorldPosition, float&
 
 void AVoxelFluidActor::OnTerrainModified(const FVector& ModifiedPosition, float ModifiedRadius)
 {
+	FFluidSimulationThread::FScopedAccess SimulationAccess(ChunkManager);
+
 	// Refresh terrain data
 	if (VoxelIntegration && VoxelIntegration->IsVoxelWorldValid())
 	{
@@ -2397,6 +2711,8 @@ void AVoxelFluidActor::OnTerrainModified(const FVector& ModifiedPosition, float
 
 void AVoxelFluidActor::OnTerrainEdited(const FVector& EditPosition, float EditRadius)
 {
+	FFluidSimulationThread::FScopedAccess SimulationAccess(ChunkManager);
+
 	// Refresh static water in the edited area
 	if (StaticWaterRenderer && bEnableStaticWater)
 	{
@@ -2418,6 +2734,8 @@ void AVoxelFluidActor::OnTerrainEdited(const FVector& EditPosition, float EditRa
 
 void AVoxelFluidActor::SpawnDynamicWaterAroundPlayer()
 {
+	FFluidSimulationThread::FScopedAccess SimulationAccess(ChunkManager);
+
 	if (APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0))
 	{
 		if (APawn* Pawn = PC->GetPawn())
@@ -4,6 +4,7 @@
 #include "StaticWater/StaticWaterRenderer.h"
 #include "StaticWater/WaterActivationManager.h"
 #include "VoxelIntegration/VoxelFluidIntegration.h"
+#include "VoxelFluidDebug.h"
 #include "CellularAutomata/FluidChunk.h"
 #include "CellularAutomata/FluidChunkManager.h"
 #include "Components/BoxComponent.h"
@@ -197,7 +198,7 @@ void AVoxelStaticWaterActor::Tick(float DeltaTime)
 		else if (!bHasOcean && bAutoCreateOcean)
 		{
 			// Create ocean if it doesn't exist yet
-			UE_LOG(LogTemp, Warning, TEXT("VoxelStaticWaterActor: Creating ocean because bHasOcean is false"));
+			VOXELFLUID_LOG(LogVoxelFluidStaticWater, Log, TEXT("VoxelStaticWaterActor: Creating ocean because bHasOcean is false"));
 			CreateTestOcean();
 		}
 
@@ -207,10 +208,15 @@ void AVoxelStaticWaterActor::Tick(float DeltaTime)
 			UpdateBoundsVisualization();
 		}
 
-		// Update renderer with player position for chunk streaming
+		// Update generator and renderer with player position for tile and chunk streaming
+		TArray<FVector> ViewerPositions = GetViewerPositions();
+		if (StaticWaterGenerator && ViewerPositions.Num() > 0)
+		{
+			StaticWaterGenerator->SetViewerPosition(ViewerPositions[0]);
+		}
+		
 		if (StaticWaterRenderer)
 		{
-			TArray<FVector> ViewerPositions = GetViewerPositions();
 			if (ViewerPositions.Num() > 0)
 			{
 				// Update renderer with primary viewer position for LOD and chunk streaming
@@ -397,11 +403,37 @@ void AVoxelStaticWaterActor::CreateOcean(float WaterLevel, float Size)
 	OceanRegion.bInfiniteDepth = true;
 	OceanRegion.MinDepth = 500.0f;
 	OceanRegion.Priority = 0;
+	OceanRegion.bUnboundedXY = bInfiniteOcean;
+	OceanRegion.bIsOcean = true;
 	
-	StaticWaterGenerator->AddWaterRegion(OceanRegion);
+	// A second call replaces the ocean rather than adding another
+	const int32 OceanRegionIndex = StaticWaterGenerator->FindOceanRegion();
+	if (OceanRegionIndex != INDEX_NONE)
+	{
+		const FStaticWaterRegionDef OldRegion = StaticWaterGenerator->WaterRegions[OceanRegionIndex];
+		StaticWaterGenerator->UpdateWaterRegion(OceanRegionIndex, OceanRegion);
+
+		// Streamed renderer tiles keep the old surface until rebuilt; a new level or extent touches every tile
+		if (StaticWaterRenderer)
+		{
+			if (OldRegion.WaterLevel != OceanRegion.WaterLevel || OldRegion.bUnboundedXY != OceanRegion.bUnboundedXY)
+			{
+				StaticWaterRenderer->ForceRebuildAllChunks();
+			}
+			else
+			{
+				StaticWaterRenderer->RebuildChunksForRegionMove(OldRegion.Bounds, OceanRegion.Bounds);
+			}
+		}
+	}
+	else
+	{
+		StaticWaterGenerator->AddWaterRegion(OceanRegion);
+	}
 	
-	UE_LOG(LogTemp, Log, TEXT("Created ocean at %s with water level %.1f and size %.1f"),
-		*OceanCenter.ToString(), WaterLevel, Size);
+	VOXELFLUID_TRACE(OceanCreated, FMath::RoundToInt(OceanCenter.X), FMath::RoundToInt(OceanCenter.Y), bInfiniteOcean ? 1 : 0, WaterLevel);
+	VOXELFLUID_LOG(LogVoxelFluidStaticWater, Log, TEXT("Created %socean at %s with water level %.1f and size %.1f"),
+		bInfiniteOcean ? TEXT("infinite ") : TEXT(""), *OceanCenter.ToString(), WaterLevel, Size);
 }
 
 void AVoxelStaticWaterActor::CreateTestOcean()
@@ -430,7 +462,7 @@ void AVoxelStaticWaterActor::ClearOcean()
 	bHasOcean = false;
 	OceanCenter = FVector::ZeroVector;
 	
-	UE_LOG(LogTemp, Log, TEXT("Cleared ocean"));
+	VOXELFLUID_LOG(LogVoxelFluidStaticWater, Log, TEXT("Cleared ocean"));
 }
 
 void AVoxelStaticWaterActor::CreateLake(const FVector& Center, float Radius, float WaterLevel, float Depth)
@@ -512,6 +544,19 @@ void AVoxelStaticWaterActor::RemoveStaticWaterRegion(const FVector& Center, floa
 	UE_LOG(LogTemp, Warning, TEXT("RemoveStaticWaterRegion not yet implemented"));
 }
 
+void AVoxelStaticWaterActor::CreateBasinLakes(const FVector& Center, float HalfExtent)
+{
+	if (!StaticWaterGenerator)
+	{
+		return;
+	}
+
+	StaticWaterGenerator->GenerateBasinLakes(FBox::BuildAABB(Center, FVector(HalfExtent, HalfExtent, 0.0f)));
+	
+	VOXELFLUID_LOG(LogVoxelFluidStaticWater, Log, TEXT("Started basin lake analysis around %s (half extent %.1f)"),
+		*Center.ToString(), HalfExtent);
+}
+
 bool AVoxelStaticWaterActor::IsPointInStaticWater(const FVector& WorldPosition) const
 {
 	if (!StaticWaterGenerator)
@@ -654,7 +699,7 @@ void AVoxelStaticWaterActor::ApplyStaticWaterToChunkWithTerrain(UFluidChunk* Chu
 	
 	if (AddedCells > 0)
 	{
-		UE_LOG(LogTemp, Verbose, TEXT("Applied static water to chunk at %s: %d cells"), 
+		VOXELFLUID_LOG(LogVoxelFluidStaticWater, Verbose, TEXT("Applied static water to chunk at %s: %d cells"), 
 			*ChunkCenter.ToString(), AddedCells);
 	}
 }
@@ -794,31 +839,46 @@ void AVoxelStaticWaterActor::UpdateOceanPosition()
 		FVector NewCenter = PlayerPos;
 		NewCenter.Z = OceanWaterLevel;
 		
-		// Update ocean position
-		if (StaticWaterGenerator)
+		// An infinite ocean covers every tile already; the generator and renderer stream
+		// world-anchored tiles around the viewer, so there is nothing to regenerate here
+		if (!bInfiniteOcean && StaticWaterGenerator)
 		{
-			StaticWaterGenerator->ClearAllWaterRegions();
-			// Create ocean region definition
 			FStaticWaterRegionDef OceanRegion;
 			OceanRegion.Bounds = FBox::BuildAABB(NewCenter, FVector(OceanSize, OceanSize, 1000.0f));
 			OceanRegion.WaterLevel = OceanWaterLevel;
 			OceanRegion.bInfiniteDepth = true;
 			OceanRegion.MinDepth = 500.0f;
 			OceanRegion.Priority = 0;
+			OceanRegion.bIsOcean = true;
 			
-			StaticWaterGenerator->AddWaterRegion(OceanRegion);
+			const int32 OceanRegionIndex = StaticWaterGenerator->FindOceanRegion();
+			if (OceanRegionIndex != INDEX_NONE)
+			{
+				// Move the region in place; only tiles and chunks along the edges of the footprint change
+				const FBox OldBounds = StaticWaterGenerator->WaterRegions[OceanRegionIndex].Bounds;
+				StaticWaterGenerator->UpdateWaterRegion(OceanRegionIndex, OceanRegion);
+				
+				if (StaticWaterRenderer)
+				{
+					StaticWaterRenderer->RebuildChunksForRegionMove(OldBounds, OceanRegion.Bounds);
+				}
+			}
+			else
+			{
+				StaticWaterGenerator->AddWaterRegion(OceanRegion);
+				
+				if (StaticWaterRenderer)
+				{
+					StaticWaterRenderer->ForceRebuildAllChunks();
+				}
+			}
 		}
 		
 		OceanCenter = NewCenter;
 		LastPlayerPosition = PlayerPos;
 		
-		// Force renderer to rebuild chunks after ocean move
-		if (StaticWaterRenderer)
-		{
-			StaticWaterRenderer->ForceRebuildAllChunks();
-		}
-		
-		UE_LOG(LogTemp, Warning, TEXT("VoxelStaticWaterActor: Ocean moved to %s (player at %s)"), 
+		VOXELFLUID_TRACE(OceanMoved, FMath::RoundToInt(NewCenter.X), FMath::RoundToInt(NewCenter.Y), 0, OceanWaterLevel);
+		VOXELFLUID_CLOG(bEnableDebugVisualization, LogVoxelFluidStaticWater, Log, TEXT("VoxelStaticWaterActor: Ocean moved to %s (player at %s)"), 
 			*NewCenter.ToString(), *PlayerPos.ToString());
 	}
 }
@@ -0,0 +1,418 @@
+#include "Benchmarking/FluidBenchmarkCommandlet.h"
+#include "Benchmarking/FluidScenarioBenchmark.h"
+#include "Benchmarking/FluidKernelBenchmark.h"
+#include "Benchmarking/FluidScalingBenchmark.h"
+#include "Benchmarking/FluidBenchmarkReport.h"
+#include "VoxelFluidMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Interfaces/IPluginManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFluidBenchmark, Log, All);
+
+UFluidBenchmarkCommandlet::UFluidBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UFluidBenchmarkCommandlet::Main(const FString& Params)
+{
+	if (FParse::Param(*Params, TEXT("kernels")) || FCString::Strifind(*Params, TEXT("-kernels=")))
+	{
+		return RunKernelBenchmarks(Params);
+	}
+	if (FParse::Param(*Params, TEXT("golden")) || FCString::Strifind(*Params, TEXT("-golden=")))
+	{
+		return RunGoldenTests(Params);
+	}
+	if (FParse::Param(*Params, TEXT("scaling")))
+	{
+		return RunScalingBenchmark(Params);
+	}
+
+	FFluidScenarioSettings BaseSettings;
+	FParse::Value(*Params, TEXT("steps="), BaseSettings.StepCount);
+	FParse::Value(*Params, TEXT("chunks="), BaseSettings.ChunksPerSide);
+	FParse::Value(*Params, TEXT("chunksize="), BaseSettings.ChunkSize);
+	FParse::Value(*Params, TEXT("cellsize="), BaseSettings.CellSize);
+	FParse::Value(*Params, TEXT("seed="), BaseSettings.Seed);
+
+	// Steady-state allocations per step that any scenario may make before the run fails
+	int32 AllocBudget = -1;
+	FParse::Value(*Params, TEXT("allocbudget="), AllocBudget);
+	BaseSettings.bTrackAllocations = AllocBudget >= 0;
+	if (BaseSettings.bTrackAllocations && !FFluidAllocationTracker::IsAvailable())
+	{
+		UE_LOG(LogFluidBenchmark, Error, TEXT("-allocbudget needs allocation tracking, which is compiled out or was not installed at startup"));
+		return 1;
+	}
+	FParse::Value(*Params, TEXT("massaudit="), BaseSettings.MassAuditInterval);
+
+	TArray<EFluidBenchmarkScenario> Scenarios;
+	FString ScenarioList = TEXT("all");
+	FParse::Value(*Params, TEXT("scenario="), ScenarioList, false);
+	if (ScenarioList.Equals(TEXT("all"), ESearchCase::IgnoreCase))
+	{
+		Scenarios = FFluidScenarioBenchmark::GetAllScenarios();
+	}
+	else
+	{
+		TArray<FString> Names;
+		ScenarioList.ParseIntoArray(Names, TEXT(","));
+		for (const FString& Name : Names)
+		{
+			EFluidBenchmarkScenario Scenario;
+			if (!FFluidScenarioBenchmark::ParseScenarioName(Name.TrimStartAndEnd(), Scenario))
+			{
+				UE_LOG(LogFluidBenchmark, Error, TEXT("Unknown scenario '%s'"), *Name);
+				return 1;
+			}
+			Scenarios.Add(Scenario);
+		}
+	}
+
+	// Load the baseline first so a bad path fails before minutes of benchmarking
+	FFluidBenchmarkReport Baseline;
+	FString BaselinePath;
+	const bool bCompare = FParse::Value(*Params, TEXT("baseline="), BaselinePath);
+	if (bCompare && !Baseline.LoadFromFile(BaselinePath))
+	{
+		UE_LOG(LogFluidBenchmark, Error, TEXT("Failed to load baseline %s"), *BaselinePath);
+		return 1;
+	}
+
+	FFluidBenchmarkReport Report;
+	Report.Machine = FFluidBenchmarkMachineInfo::Capture();
+
+	FString CSVContent = FFluidScenarioResult::GetCSVHeader() + LINE_TERMINATOR;
+	for (EFluidBenchmarkScenario Scenario : Scenarios)
+	{
+		FFluidScenarioSettings Settings = BaseSettings;
+		Settings.Scenario = Scenario;
+
+		FFluidScenarioResult Result = FFluidScenarioBenchmark::RunScenario(Settings);
+		UE_LOG(LogFluidBenchmark, Display, TEXT("%s"), *Result.ToString());
+		CSVContent += Result.ToCSVRow() + LINE_TERMINATOR;
+		Report.Results.Add(MoveTemp(Result));
+
+		// Chunks from the finished scenario are garbage once its manager is released
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	const FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S"));
+	const FString OutputDir = FPaths::ProjectSavedDir() / TEXT("Benchmarks");
+
+	FString CSVPath;
+	if (!FParse::Value(*Params, TEXT("output="), CSVPath))
+	{
+		CSVPath = OutputDir / FString::Printf(TEXT("Scenarios_%s.csv"), *Timestamp);
+	}
+
+	FString JsonPath;
+	if (!FParse::Value(*Params, TEXT("json="), JsonPath))
+	{
+		JsonPath = OutputDir / FString::Printf(TEXT("Scenarios_%s.json"), *Timestamp);
+	}
+
+	if (!FFileHelper::SaveStringToFile(CSVContent, *CSVPath))
+	{
+		UE_LOG(LogFluidBenchmark, Error, TEXT("Failed to write %s"), *CSVPath);
+		return 1;
+	}
+
+	if (!Report.SaveToFile(JsonPath))
+	{
+		UE_LOG(LogFluidBenchmark, Error, TEXT("Failed to write %s"), *JsonPath);
+		return 1;
+	}
+
+	UE_LOG(LogFluidBenchmark, Display, TEXT("Wrote %d scenario results to %s and %s"), Scenarios.Num(), *CSVPath, *JsonPath);
+
+	if (bCompare)
+	{
+		FFluidBenchmarkCompareSettings CompareSettings;
+		FParse::Value(*Params, TEXT("threshold="), CompareSettings.RelativeThreshold);
+		FParse::Value(*Params, TEXT("zscore="), CompareSettings.ZScoreThreshold);
+
+		const FFluidBenchmarkComparison Comparison = FFluidBenchmarkReport::Compare(Baseline, Report, CompareSettings);
+		UE_LOG(LogFluidBenchmark, Display, TEXT("Comparison against %s:\n%s"), *BaselinePath, *Comparison.ToString());
+
+		if (Comparison.HasRegressions())
+		{
+			UE_LOG(LogFluidBenchmark, Error, TEXT("%d benchmark regression(s) against %s"), Comparison.GetRegressionCount(), *BaselinePath);
+			return 2;
+		}
+	}
+
+	if (AllocBudget >= 0)
+	{
+		int32 OverBudget = 0;
+		for (const FFluidScenarioResult& Result : Report.Results)
+		{
+			if (Result.SteadyStateAllocSteps == 0)
+			{
+				UE_LOG(LogFluidBenchmark, Display, TEXT("%s: no allocation budget, the scenario edits or streams every step"), *Result.ScenarioName);
+			}
+			else if (Result.SteadyStateMaxAllocsPerStep > AllocBudget)
+			{
+				UE_LOG(LogFluidBenchmark, Error, TEXT("%s: %lld steady-state allocations in one step, budget is %d (mostly in %s)"),
+					*Result.ScenarioName, Result.SteadyStateMaxAllocsPerStep, AllocBudget, *Result.AllocationHotspot);
+				++OverBudget;
+			}
+		}
+
+		if (OverBudget > 0)
+		{
+			return 3;
+		}
+	}
+
+	return 0;
+}
+
+int32 UFluidBenchmarkCommandlet::RunKernelBenchmarks(const FString& Params)
+{
+	FFluidKernelBenchmarkSettings Settings;
+	FParse::Value(*Params, TEXT("iterations="), Settings.Iterations);
+	FParse::Value(*Params, TEXT("warmup="), Settings.WarmupIterations);
+	FParse::Value(*Params, TEXT("seed="), Settings.Seed);
+
+	FString List;
+	if (FParse::Value(*Params, TEXT("sizes="), List, false))
+	{
+		TArray<FString> Values;
+		List.ParseIntoArray(Values, TEXT(","));
+		Settings.Sizes.Reset();
+		for (const FString& Value : Values)
+		{
+			Settings.Sizes.Add(FCString::Atoi(*Value));
+		}
+	}
+	if (FParse::Value(*Params, TEXT("fills="), List, false))
+	{
+		TArray<FString> Values;
+		List.ParseIntoArray(Values, TEXT(","));
+		Settings.FillRatios.Reset();
+		for (const FString& Value : Values)
+		{
+			Settings.FillRatios.Add(FCString::Atof(*Value));
+		}
+	}
+
+	TArray<EFluidBenchmarkKernel> Kernels;
+	FString KernelList = TEXT("all");
+	FParse::Value(*Params, TEXT("kernels="), KernelList, false);
+	if (KernelList.Equals(TEXT("all"), ESearchCase::IgnoreCase))
+	{
+		Kernels = FFluidKernelBenchmark::GetAllKernels();
+	}
+	else
+	{
+		TArray<FString> Names;
+		KernelList.ParseIntoArray(Names, TEXT(","));
+		for (const FString& Name : Names)
+		{
+			EFluidBenchmarkKernel Kernel;
+			if (!FFluidKernelBenchmark::ParseKernelName(Name.TrimStartAndEnd(), Kernel))
+			{
+				UE_LOG(LogFluidBenchmark, Error, TEXT("Unknown kernel '%s'"), *Name);
+				return 1;
+			}
+			Kernels.Add(Kernel);
+		}
+	}
+
+	const FFluidKernelBenchmark Benchmark(Settings);
+	FString CSVContent = FFluidKernelResult::GetCSVHeader() + LINE_TERMINATOR;
+	int32 ResultCount = 0;
+	for (EFluidBenchmarkKernel Kernel : Kernels)
+	{
+		for (const FFluidKernelResult& Result : Benchmark.Run({ Kernel }))
+		{
+			UE_LOG(LogFluidBenchmark, Display, TEXT("%s"), *Result.ToString());
+			CSVContent += Result.ToCSVRow() + LINE_TERMINATOR;
+			++ResultCount;
+		}
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	FString CSVPath;
+	if (!FParse::Value(*Params, TEXT("output="), CSVPath))
+	{
+		CSVPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("Kernels_%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	}
+
+	if (!FFileHelper::SaveStringToFile(CSVContent, *CSVPath))
+	{
+		UE_LOG(LogFluidBenchmark, Error, TEXT("Failed to write %s"), *CSVPath);
+		return 1;
+	}
+
+	UE_LOG(LogFluidBenchmark, Display, TEXT("Wrote %d kernel results to %s"), ResultCount, *CSVPath);
+	return 0;
+}
+
+int32 UFluidBenchmarkCommandlet::RunScalingBenchmark(const FString& Params)
+{
+	FFluidScalingSettings Settings;
+	FParse::Value(*Params, TEXT("steps="), Settings.StepCount);
+	FParse::Value(*Params, TEXT("seed="), Settings.Seed);
+	FParse::Value(*Params, TEXT("cellsize="), Settings.CellSize);
+	FParse::Value(*Params, TEXT("budget="), Settings.StepBudgetMs);
+	FParse::Value(*Params, TEXT("knee="), Settings.EfficiencyKnee);
+
+	auto ParseIntList = [&Params](const TCHAR* Key, TArray<int32>& OutValues)
+	{
+		FString List;
+		if (FParse::Value(*Params, Key, List, false))
+		{
+			TArray<FString> Values;
+			List.ParseIntoArray(Values, TEXT(","));
+			OutValues.Reset();
+			for (const FString& Value : Values)
+			{
+				OutValues.Add(FMath::Max(1, FCString::Atoi(*Value)));
+			}
+		}
+	};
+	ParseIntList(TEXT("chunks="), Settings.ChunksPerSide);
+	ParseIntList(TEXT("threads="), Settings.ThreadCounts);
+	ParseIntList(TEXT("chunksizes="), Settings.ChunkSizes);
+
+	FString FillList;
+	if (FParse::Value(*Params, TEXT("fills="), FillList, false))
+	{
+		TArray<FString> Names;
+		FillList.ParseIntoArray(Names, TEXT(","));
+		for (const FString& Name : Names)
+		{
+			FFluidScalingFill Fill;
+			if (!FFluidScalingFill::Parse(Name, Fill))
+			{
+				UE_LOG(LogFluidBenchmark, Error, TEXT("Unknown fill '%s'"), *Name);
+				return 1;
+			}
+			Settings.Fills.Add(Fill);
+		}
+	}
+
+	const FFluidScalingBenchmark Benchmark(Settings);
+	const FFluidScalingReport Report = Benchmark.Run([](const FFluidScalingPoint& Point)
+	{
+		UE_LOG(LogFluidBenchmark, Display, TEXT("%s"), *Point.ToString());
+	});
+	UE_LOG(LogFluidBenchmark, Display, TEXT("%s"), *Report.ToString());
+
+	FString CSVPath;
+	if (!FParse::Value(*Params, TEXT("output="), CSVPath))
+	{
+		CSVPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("Scaling_%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+	}
+	const FString SummaryPath = FPaths::ChangeExtension(CSVPath, TEXT("txt"));
+
+	if (!FFileHelper::SaveStringToFile(Report.ToCSV(), *CSVPath) || !FFileHelper::SaveStringToFile(Report.ToString(), *SummaryPath))
+	{
+		UE_LOG(LogFluidBenchmark, Error, TEXT("Failed to write %s"), *CSVPath);
+		return 1;
+	}
+
+	UE_LOG(LogFluidBenchmark, Display, TEXT("Wrote %d scaling points to %s and %s"), Report.Points.Num(), *CSVPath, *SummaryPath);
+	return 0;
+}
+
+int32 UFluidBenchmarkCommandlet::RunGoldenTests(const FString& Params)
+{
+	FFluidScenarioSettings BaseSettings;
+	BaseSettings.StepCount = 240;
+	BaseSettings.FingerprintInterval = 60;
+	FParse::Value(*Params, TEXT("steps="), BaseSettings.StepCount);
+	FParse::Value(*Params, TEXT("interval="), BaseSettings.FingerprintInterval);
+	BaseSettings.FingerprintInterval = FMath::Max(1, BaseSettings.FingerprintInterval);
+
+	TArray<EFluidBenchmarkScenario> Scenarios;
+	FString ScenarioList = TEXT("all");
+	FParse::Value(*Params, TEXT("scenario="), ScenarioList, false);
+	if (ScenarioList.Equals(TEXT("all"), ESearchCase::IgnoreCase))
+	{
+		Scenarios = FFluidScenarioBenchmark::GetAllScenarios();
+	}
+	else
+	{
+		TArray<FString> Names;
+		ScenarioList.ParseIntoArray(Names, TEXT(","));
+		for (const FString& Name : Names)
+		{
+			EFluidBenchmarkScenario Scenario;
+			if (!FFluidScenarioBenchmark::ParseScenarioName(Name.TrimStartAndEnd(), Scenario))
+			{
+				UE_LOG(LogFluidBenchmark, Error, TEXT("Unknown scenario '%s'"), *Name);
+				return 1;
+			}
+			Scenarios.Add(Scenario);
+		}
+	}
+
+	FString GoldenPath;
+	if (!FParse::Value(*Params, TEXT("golden="), GoldenPath))
+	{
+		// The reference ships beside the module, wherever the plugin is installed
+		const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("VoxelFluidSystem"));
+		const FString BaseDir = Plugin.IsValid() ? Plugin->GetBaseDir() : FPaths::GameSourceDir() / TEXT("VoxelFluidSystem");
+		GoldenPath = BaseDir / TEXT("Tests") / TEXT("FluidGolden.json");
+	}
+
+	const bool bUpdate = FParse::Param(*Params, TEXT("update"));
+	FFluidGoldenFile Reference;
+	if (!Reference.LoadFromFile(GoldenPath) && !bUpdate)
+	{
+		UE_LOG(LogFluidBenchmark, Error, TEXT("Failed to load golden reference %s; generate it with -golden -update and commit it"), *GoldenPath);
+		return 1;
+	}
+
+	FFluidGoldenFile Current;
+	for (EFluidBenchmarkScenario Scenario : Scenarios)
+	{
+		FFluidScenarioSettings Settings = BaseSettings;
+		Settings.Scenario = Scenario;
+
+		FFluidScenarioResult Result = FFluidScenarioBenchmark::RunScenario(Settings);
+		FFluidGoldenScenario& Golden = Current.Scenarios.AddDefaulted_GetRef();
+		Golden.ScenarioName = Result.ScenarioName;
+		Golden.ConfigurationHash = Result.ConfigurationHash;
+		Golden.Fingerprints = MoveTemp(Result.Fingerprints);
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	if (bUpdate)
+	{
+		// Scenarios that were not rerun keep their existing reference
+		for (FFluidGoldenScenario& Scenario : Current.Scenarios)
+		{
+			Reference.Scenarios.RemoveAll([&Scenario](const FFluidGoldenScenario& Existing) { return Existing.ScenarioName == Scenario.ScenarioName; });
+		}
+		Reference.Scenarios.Append(MoveTemp(Current.Scenarios));
+
+		if (!Reference.SaveToFile(GoldenPath))
+		{
+			UE_LOG(LogFluidBenchmark, Error, TEXT("Failed to write %s"), *GoldenPath);
+			return 1;
+		}
+		UE_LOG(LogFluidBenchmark, Display, TEXT("Wrote golden fingerprints for %d scenario(s) to %s"), Scenarios.Num(), *GoldenPath);
+		return 0;
+	}
+
+	const FFluidGoldenComparison Comparison = FFluidGoldenFile::Compare(Reference, Current);
+	UE_LOG(LogFluidBenchmark, Display, TEXT("Golden comparison against %s:\n%s"), *GoldenPath, *Comparison.ToString());
+	if (Comparison.HasFailures())
+	{
+		UE_LOG(LogFluidBenchmark, Error, TEXT("%d golden mismatch(es) against %s"), Comparison.Failures.Num(), *GoldenPath);
+		return 4;
+	}
+	return 0;
+}
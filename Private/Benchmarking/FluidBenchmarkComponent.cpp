@@ -6,6 +6,9 @@
 #include "Misc/FileHelper.h"
 #include "Misc/DateTime.h"
 #include "VoxelFluidStats.h"
+#include "VoxelFluidDebug.h"
+#include "VoxelFluidProfiler.h"
+#include "VoxelFluidMemory.h"
 
 UFluidBenchmarkComponent::UFluidBenchmarkComponent()
 {
@@ -71,7 +74,14 @@ void UFluidBenchmarkComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
 			CurrentResult.TestName = TestConfigs.IsValidIndex(CurrentConfigIndex) 
 				? TestConfigs[CurrentConfigIndex].ConfigName 
 				: TEXT("Unknown");
-			
+
+			// Percentiles and hitches cover the measured window only
+			if (FFluidFrameProfiler* Profiler = GetFrameProfiler())
+			{
+				Profiler->Reset();
+				Profiler->SetHitchThresholdMs(FluidActor->HitchThresholdMs);
+				Profiler->SetEnabled(true);
+			}
 		}
 		return;
 	}
@@ -119,6 +129,11 @@ void UFluidBenchmarkComponent::StartBenchmark()
 	OriginalConfig.ChunkSize = FluidActor->ChunkSize;
 	OriginalConfig.MaxActiveChunks = FluidActor->MaxActiveChunks;
 
+	if (const FFluidFrameProfiler* Profiler = GetFrameProfiler())
+	{
+		bProfilerWasEnabled = Profiler->IsEnabled();
+	}
+
 	// Clear previous results
 	BenchmarkResults.Empty();
 	
@@ -148,7 +163,11 @@ void UFluidBenchmarkComponent::StopBenchmark()
 	{
 		RestoreOriginalConfiguration();
 	}
-	
+
+	if (FFluidFrameProfiler* Profiler = GetFrameProfiler())
+	{
+		Profiler->SetEnabled(bProfilerWasEnabled);
+	}
 }
 
 void UFluidBenchmarkComponent::RunComparisonBenchmark()
@@ -166,8 +185,14 @@ void UFluidBenchmarkComponent::CollectSample(float DeltaTime)
 	// In production, you'd use Unreal's profiling tools or add explicit timing
 	const FChunkManagerStats ChunkStats = FluidActor->ChunkManager->GetStats();
 	float SimTime = ChunkStats.AverageChunkUpdateTime; // Use chunk update time as simulation time
-	float MeshTime = 0.0f; // Would need explicit timing in mesh generation
-	float BorderTime = 0.0f; // Would need explicit timing in border sync
+	float MeshTime = 0.0f;
+	float BorderTime = 0.0f;
+	if (const FFluidFrameProfiler* Profiler = GetFrameProfiler())
+	{
+		// Previous frame; the profiler closes a frame when the next one starts
+		MeshTime = Profiler->GetLastFramePhaseMs(EFluidFramePhase::Meshing);
+		BorderTime = Profiler->GetLastFramePhaseMs(EFluidFramePhase::BorderSync);
+	}
 	
 	// Alternative: Use the last frame simulation time from the actor
 	if (FluidActor->GetLastFrameSimulationTime() > 0.0f)
@@ -199,9 +224,39 @@ void UFluidBenchmarkComponent::CollectSample(float DeltaTime)
 
 void UFluidBenchmarkComponent::FinalizeBenchmark()
 {
+	if (const FFluidFrameProfiler* Profiler = GetFrameProfiler())
+	{
+		auto AddPercentiles = [this](const FString& Phase, const FFluidTimingHistogram& Histogram)
+		{
+			FBenchmarkPhasePercentiles& Entry = CurrentResult.PhasePercentiles.AddDefaulted_GetRef();
+			Entry.Phase = Phase;
+			Entry.P50 = Histogram.GetPercentile(50.0);
+			Entry.P90 = Histogram.GetPercentile(90.0);
+			Entry.P99 = Histogram.GetPercentile(99.0);
+			Entry.P999 = Histogram.GetPercentile(99.9);
+			Entry.MaxMs = Histogram.GetMax();
+		};
+
+		CurrentResult.PhasePercentiles.Reset();
+		AddPercentiles(TEXT("Frame"), Profiler->GetFrameHistogram());
+		AddPercentiles(TEXT("Fluid"), Profiler->GetFluidHistogram());
+		AddPercentiles(TEXT("Step"), Profiler->GetStepHistogram());
+		for (int32 i = 0; i < (int32)EFluidFramePhase::Count; ++i)
+		{
+			const EFluidFramePhase Phase = (EFluidFramePhase)i;
+			AddPercentiles(LexToString(Phase), Profiler->GetPhaseHistogram(Phase));
+		}
+
+		CurrentResult.HitchCount = Profiler->GetTotalHitchCount();
+		CurrentResult.HitchLog.Reset();
+		for (const FFluidHitchRecord& Hitch : Profiler->GetHitches())
+		{
+			CurrentResult.HitchLog.Add(Hitch.ToString());
+		}
+	}
+
 	// Add current result to results array
 	BenchmarkResults.Add(CurrentResult);
-	
 }
 
 void UFluidBenchmarkComponent::RunNextConfiguration()
@@ -288,20 +343,18 @@ void UFluidBenchmarkComponent::RestoreOriginalConfiguration()
 	// Optimization properties removed - cannot restore config
 }
 
+FFluidFrameProfiler* UFluidBenchmarkComponent::GetFrameProfiler() const
+{
+	return FluidActor ? FFluidFrameProfiler::Get(FluidActor->ChunkManager) : nullptr;
+}
+
 float UFluidBenchmarkComponent::CalculateMemoryUsage() const
 {
 	if (!FluidActor || !FluidActor->ChunkManager)
 		return 0.0f;
 
-	const FChunkManagerStats Stats = FluidActor->ChunkManager->GetStats();
-	
-	// Calculate memory based on compression settings
-	const float BytesPerCell = 44.0f; // No compression available
-	const float CellMemory = Stats.TotalActiveCells * BytesPerCell;
-	const float ChunkOverhead = Stats.TotalChunks * sizeof(UFluidChunk) * 2; // Rough estimate
-	const float CacheMemory = FluidActor->ChunkManager->GetCacheMemoryUsage() * 1024; // Convert KB to bytes
-	
-	return (CellMemory + ChunkOverhead + CacheMemory) / (1024.0f * 1024.0f); // Convert to MB
+	// Allocated bytes across every registered fluid subsystem, not just the chunks
+	return FFluidMemoryTracker::Capture().GetTotal() / (1024.0f * 1024.0f);
 }
 
 void UFluidBenchmarkComponent::SaveBenchmarkResults()
@@ -311,21 +364,31 @@ void UFluidBenchmarkComponent::SaveBenchmarkResults()
 	
 	const FString CSVContent = GenerateCSVReport();
 	
-	if (FFileHelper::SaveStringToFile(CSVContent, *FileName))
-	{
-	}
-	else
+	if (!FFileHelper::SaveStringToFile(CSVContent, *FileName))
 	{
+		UE_LOG(LogVoxelFluidDebug, Warning, TEXT("FluidBenchmark: failed to write results to %s"), *FileName);
 	}
 }
 
 FString UFluidBenchmarkComponent::GenerateCSVReport() const
 {
-	FString CSV = TEXT("Test Name,Avg Frame (ms),Min Frame (ms),Max Frame (ms),Simulation (ms),Mesh Gen (ms),Border Sync (ms),Active Chunks,Active Cells,Fluid Volume,Memory (MB),Samples\n");
+	FString CSV = TEXT("Test Name,Avg Frame (ms),Min Frame (ms),Max Frame (ms),Simulation (ms),Mesh Gen (ms),Border Sync (ms),Active Chunks,Active Cells,Fluid Volume,Memory (MB),Samples");
+
+	// p50/p99/p99.9 columns per phase, in the order FinalizeBenchmark records them
+	TArray<FString> PercentilePhases = { TEXT("Frame"), TEXT("Fluid") };
+	for (int32 i = 0; i < (int32)EFluidFramePhase::Count; ++i)
+	{
+		PercentilePhases.Add(LexToString((EFluidFramePhase)i));
+	}
+	for (const FString& Phase : PercentilePhases)
+	{
+		CSV += FString::Printf(TEXT(",%s p50 (ms),%s p99 (ms),%s p99.9 (ms)"), *Phase, *Phase, *Phase);
+	}
+	CSV += TEXT(",Hitches\n");
 	
 	for (const FBenchmarkResult& Result : BenchmarkResults)
 	{
-		CSV += FString::Printf(TEXT("%s,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%d,%d,%.1f,%.1f,%d\n"),
+		CSV += FString::Printf(TEXT("%s,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%d,%d,%.1f,%.1f,%d"),
 			*Result.TestName,
 			Result.AverageFrameTime,
 			Result.MinFrameTime,
@@ -339,6 +402,13 @@ FString UFluidBenchmarkComponent::GenerateCSVReport() const
 			Result.MemoryUsageMB,
 			Result.SampleCount
 		);
+
+		for (const FString& Phase : PercentilePhases)
+		{
+			const FBenchmarkPhasePercentiles* Entry = Result.FindPercentiles(Phase);
+			CSV += Entry ? FString::Printf(TEXT(",%.2f,%.2f,%.2f"), Entry->P50, Entry->P99, Entry->P999) : FString(TEXT(",,,"));
+		}
+		CSV += FString::Printf(TEXT(",%d\n"), Result.HitchCount);
 	}
 	
 	return CSV;
@@ -400,6 +470,28 @@ FString UFluidBenchmarkComponent::GetComparisonReport() const
 		);
 	}
 	
+	Report += TEXT("\n=== FRAME TIME PERCENTILES ===\n");
+	for (const FBenchmarkResult& Result : BenchmarkResults)
+	{
+		if (Result.PhasePercentiles.Num() == 0)
+			continue;
+
+		Report += FString::Printf(TEXT("\n%s (%d hitches)\n"), *Result.TestName, Result.HitchCount);
+		Report += TEXT("Phase            |    p50   |    p90   |    p99   |  p99.9   |    max\n");
+		for (const FBenchmarkPhasePercentiles& Entry : Result.PhasePercentiles)
+		{
+			Report += FString::Printf(TEXT("%-16s | %6.2fms | %6.2fms | %6.2fms | %6.2fms | %6.2fms\n"),
+				*Entry.Phase, Entry.P50, Entry.P90, Entry.P99, Entry.P999, Entry.MaxMs);
+		}
+
+		// The latest few are enough to point at a phase and chunk
+		const int32 FirstHitch = FMath::Max(0, Result.HitchLog.Num() - 5);
+		for (int32 i = FirstHitch; i < Result.HitchLog.Num(); ++i)
+		{
+			Report += TEXT("  ") + Result.HitchLog[i] + TEXT("\n");
+		}
+	}
+
 	// Summary
 	if (Baseline && BenchmarkResults.Num() > 1)
 	{
@@ -0,0 +1,466 @@
+#include "Benchmarking/FluidBenchmarkReport.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformMemory.h"
+
+namespace
+{
+	// Bump when the JSON layout changes incompatibly
+	constexpr int32 ReportFormatVersion = 1;
+}
+
+FFluidBenchmarkMachineInfo FFluidBenchmarkMachineInfo::Capture()
+{
+	FFluidBenchmarkMachineInfo Info;
+	Info.CPUBrand = FPlatformMisc::GetCPUBrand().TrimStartAndEnd();
+	Info.LogicalCores = FPlatformMisc::NumberOfCoresIncludingHyperthreads();
+	Info.MemoryGB = FPlatformMemory::GetConstants().TotalPhysicalGB;
+	Info.OSVersion = FPlatformMisc::GetOSVersion();
+	Info.BuildConfiguration = LexToString(FApp::GetBuildConfiguration());
+	Info.EngineVersion = FEngineVersion::Current().ToString();
+	Info.Timestamp = FDateTime::UtcNow().ToIso8601();
+	return Info;
+}
+
+bool FFluidBenchmarkMachineInfo::IsSameMachine(const FFluidBenchmarkMachineInfo& Other) const
+{
+	return CPUBrand == Other.CPUBrand && LogicalCores == Other.LogicalCores && BuildConfiguration == Other.BuildConfiguration;
+}
+
+int32 FFluidBenchmarkComparison::GetRegressionCount() const
+{
+	int32 Count = MassErrorRegressions.Num() + MemoryRegressions.Num();
+	for (const FFluidBenchmarkDelta& Delta : Deltas)
+	{
+		Count += Delta.bRegression ? 1 : 0;
+	}
+	return Count;
+}
+
+FString FFluidBenchmarkComparison::ToString() const
+{
+	FString Report;
+	for (const FString& Warning : Warnings)
+	{
+		Report += FString::Printf(TEXT("WARNING: %s\n"), *Warning);
+	}
+
+	for (const FFluidBenchmarkDelta& Delta : Deltas)
+	{
+		const TCHAR* Verdict = Delta.bRegression ? TEXT("REGRESSION") : (Delta.bImprovement ? TEXT("improved") : TEXT("ok"));
+		Report += FString::Printf(TEXT("%-20s %-12s %9.3fms -> %9.3fms (%+6.1f%%, z=%+.2f) %s\n"),
+			*Delta.Scenario, *Delta.Phase, Delta.BaselineMedianMs, Delta.CurrentMedianMs,
+			Delta.RelativeChange * 100.0, Delta.ZScore, Verdict);
+	}
+
+	for (const FString& MassRegression : MassErrorRegressions)
+	{
+		Report += FString::Printf(TEXT("REGRESSION: %s\n"), *MassRegression);
+	}
+
+	for (const FString& MemoryRegression : MemoryRegressions)
+	{
+		Report += FString::Printf(TEXT("REGRESSION: %s\n"), *MemoryRegression);
+	}
+
+	Report += FString::Printf(TEXT("%d regression(s)"), GetRegressionCount());
+	return Report;
+}
+
+TSharedRef<FJsonObject> FFluidBenchmarkReport::ResultToJson(const FFluidScenarioResult& Result)
+{
+	TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+	Object->SetStringField(TEXT("scenario"), Result.ScenarioName);
+	Object->SetStringField(TEXT("configurationHash"), Result.ConfigurationHash);
+	Object->SetNumberField(TEXT("steps"), Result.StepCount);
+	Object->SetNumberField(TEXT("setupMs"), Result.SetupMs);
+	Object->SetNumberField(TEXT("chunkSteps"), static_cast<double>(Result.ChunkSteps));
+	Object->SetNumberField(TEXT("peakLoadedChunks"), Result.PeakLoadedChunks);
+	Object->SetNumberField(TEXT("peakActiveChunks"), Result.PeakActiveChunks);
+	Object->SetNumberField(TEXT("finalActiveCells"), Result.FinalActiveCells);
+
+	TSharedRef<FJsonObject> Memory = MakeShared<FJsonObject>();
+	Memory->SetNumberField(TEXT("peakChunkMB"), Result.PeakChunkMemoryMB);
+	if (Result.SteadyStateAllocSteps > 0)
+	{
+		Memory->SetNumberField(TEXT("steadyStateAllocSteps"), Result.SteadyStateAllocSteps);
+		Memory->SetNumberField(TEXT("steadyStateMaxAllocsPerStep"), static_cast<double>(Result.SteadyStateMaxAllocsPerStep));
+		Memory->SetNumberField(TEXT("steadyStateMeanAllocsPerStep"), Result.SteadyStateMeanAllocsPerStep);
+		Memory->SetNumberField(TEXT("steadyStateBytesPerStep"), static_cast<double>(Result.SteadyStateBytesPerStep));
+		Memory->SetStringField(TEXT("allocationHotspot"), Result.AllocationHotspot);
+	}
+	Object->SetObjectField(TEXT("memory"), Memory);
+
+	TSharedRef<FJsonObject> Mass = MakeShared<FJsonObject>();
+	Mass->SetNumberField(TEXT("added"), Result.VolumeAdded);
+	Mass->SetNumberField(TEXT("removed"), Result.VolumeRemoved);
+	Mass->SetNumberField(TEXT("discarded"), Result.VolumeDiscarded);
+	Mass->SetNumberField(TEXT("final"), Result.FinalVolume);
+	Mass->SetNumberField(TEXT("error"), Result.GetMassError());
+	Mass->SetNumberField(TEXT("relativeError"), Result.GetRelativeMassError());
+	if (Result.MassAudit.Step > 0)
+	{
+		// Per-category flows and the unexplained remainder, so a drifting build shows which subsystem moved
+		TSharedRef<FJsonObject> Ledger = MakeShared<FJsonObject>();
+		Ledger->SetNumberField(TEXT("measured"), Result.MassAudit.MeasuredVolume);
+		Ledger->SetNumberField(TEXT("expected"), Result.MassAudit.ExpectedVolume);
+		Ledger->SetNumberField(TEXT("drift"), Result.MassAudit.Drift);
+		for (int32 i = 0; i < (int32)EFluidMassCategory::Count; ++i)
+		{
+			Ledger->SetNumberField(LexToString((EFluidMassCategory)i), Result.MassAudit.Flows.Volume[i]);
+		}
+
+		TArray<TSharedPtr<FJsonValue>> WorstChunks;
+		for (const FFluidChunkMassRecord& Record : Result.WorstDriftChunks)
+		{
+			TSharedRef<FJsonObject> ChunkObject = MakeShared<FJsonObject>();
+			ChunkObject->SetNumberField(TEXT("x"), Record.Coord.X);
+			ChunkObject->SetNumberField(TEXT("y"), Record.Coord.Y);
+			ChunkObject->SetNumberField(TEXT("z"), Record.Coord.Z);
+			ChunkObject->SetNumberField(TEXT("drift"), Record.Drift);
+			WorstChunks.Add(MakeShared<FJsonValueObject>(ChunkObject));
+		}
+		Ledger->SetArrayField(TEXT("worstChunks"), WorstChunks);
+		Mass->SetObjectField(TEXT("ledger"), Ledger);
+	}
+	Object->SetObjectField(TEXT("mass"), Mass);
+
+	TArray<TSharedPtr<FJsonValue>> Phases;
+	for (const FFluidBenchmarkPhase& Phase : Result.Phases)
+	{
+		TSharedRef<FJsonObject> PhaseObject = MakeShared<FJsonObject>();
+		PhaseObject->SetStringField(TEXT("name"), Phase.Name);
+		PhaseObject->SetNumberField(TEXT("totalMs"), Phase.GetTotal());
+		PhaseObject->SetNumberField(TEXT("meanMs"), Phase.GetMean());
+		PhaseObject->SetNumberField(TEXT("medianMs"), Phase.GetMedian());
+		PhaseObject->SetNumberField(TEXT("p90Ms"), Phase.GetPercentile(90.0));
+		PhaseObject->SetNumberField(TEXT("p99Ms"), Phase.GetPercentile(99.0));
+		PhaseObject->SetNumberField(TEXT("minMs"), Phase.GetMin());
+		PhaseObject->SetNumberField(TEXT("maxMs"), Phase.GetMax());
+
+		// Raw samples let a later run test against this one, not just compare summaries
+		TArray<TSharedPtr<FJsonValue>> Samples;
+		Samples.Reserve(Phase.SamplesMs.Num());
+		for (double Sample : Phase.SamplesMs)
+		{
+			Samples.Add(MakeShared<FJsonValueNumber>(Sample));
+		}
+		PhaseObject->SetArrayField(TEXT("samplesMs"), Samples);
+
+		Phases.Add(MakeShared<FJsonValueObject>(PhaseObject));
+	}
+	Object->SetArrayField(TEXT("phases"), Phases);
+
+	return Object;
+}
+
+bool FFluidBenchmarkReport::ResultFromJson(const TSharedPtr<FJsonObject>& Object, FFluidScenarioResult& OutResult)
+{
+	if (!Object.IsValid() || !Object->TryGetStringField(TEXT("scenario"), OutResult.ScenarioName))
+		return false;
+
+	Object->TryGetStringField(TEXT("configurationHash"), OutResult.ConfigurationHash);
+	Object->TryGetNumberField(TEXT("steps"), OutResult.StepCount);
+	Object->TryGetNumberField(TEXT("setupMs"), OutResult.SetupMs);
+	Object->TryGetNumberField(TEXT("chunkSteps"), OutResult.ChunkSteps);
+	Object->TryGetNumberField(TEXT("peakLoadedChunks"), OutResult.PeakLoadedChunks);
+	Object->TryGetNumberField(TEXT("peakActiveChunks"), OutResult.PeakActiveChunks);
+	Object->TryGetNumberField(TEXT("finalActiveCells"), OutResult.FinalActiveCells);
+
+	const TSharedPtr<FJsonObject>* Memory = nullptr;
+	if (Object->TryGetObjectField(TEXT("memory"), Memory))
+	{
+		double PeakChunkMB = 0.0;
+		(*Memory)->TryGetNumberField(TEXT("peakChunkMB"), PeakChunkMB);
+		OutResult.PeakChunkMemoryMB = PeakChunkMB;
+		(*Memory)->TryGetNumberField(TEXT("steadyStateAllocSteps"), OutResult.SteadyStateAllocSteps);
+		(*Memory)->TryGetNumberField(TEXT("steadyStateMaxAllocsPerStep"), OutResult.SteadyStateMaxAllocsPerStep);
+		(*Memory)->TryGetNumberField(TEXT("steadyStateMeanAllocsPerStep"), OutResult.SteadyStateMeanAllocsPerStep);
+		(*Memory)->TryGetNumberField(TEXT("steadyStateBytesPerStep"), OutResult.SteadyStateBytesPerStep);
+		(*Memory)->TryGetStringField(TEXT("allocationHotspot"), OutResult.AllocationHotspot);
+	}
+
+	const TSharedPtr<FJsonObject>* Mass = nullptr;
+	if (Object->TryGetObjectField(TEXT("mass"), Mass))
+	{
+		double Added = 0.0, Removed = 0.0, Discarded = 0.0, Final = 0.0;
+		(*Mass)->TryGetNumberField(TEXT("added"), Added);
+		(*Mass)->TryGetNumberField(TEXT("removed"), Removed);
+		(*Mass)->TryGetNumberField(TEXT("discarded"), Discarded);
+		(*Mass)->TryGetNumberField(TEXT("final"), Final);
+		OutResult.VolumeAdded = Added;
+		OutResult.VolumeRemoved = Removed;
+		OutResult.VolumeDiscarded = Discarded;
+		OutResult.FinalVolume = Final;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* Phases = nullptr;
+	if (!Object->TryGetArrayField(TEXT("phases"), Phases))
+		return false;
+
+	for (const TSharedPtr<FJsonValue>& PhaseValue : *Phases)
+	{
+		const TSharedPtr<FJsonObject> PhaseObject = PhaseValue->AsObject();
+		if (!PhaseObject.IsValid())
+			continue;
+
+		FFluidBenchmarkPhase& Phase = OutResult.Phases.AddDefaulted_GetRef();
+		PhaseObject->TryGetStringField(TEXT("name"), Phase.Name);
+
+		const TArray<TSharedPtr<FJsonValue>>* Samples = nullptr;
+		if (PhaseObject->TryGetArrayField(TEXT("samplesMs"), Samples))
+		{
+			Phase.SamplesMs.Reserve(Samples->Num());
+			for (const TSharedPtr<FJsonValue>& Sample : *Samples)
+			{
+				Phase.SamplesMs.Add(Sample->AsNumber());
+			}
+		}
+	}
+
+	// Summary fields are derived from the samples so they always agree with them
+	auto PhaseTotal = [&OutResult](const TCHAR* Name)
+	{
+		const FFluidBenchmarkPhase* Phase = OutResult.FindPhase(Name);
+		return Phase ? Phase->GetTotal() : 0.0;
+	};
+	OutResult.EditMs = PhaseTotal(TEXT("Edit"));
+	OutResult.StreamingMs = PhaseTotal(TEXT("Streaming"));
+	OutResult.GatherMs = PhaseTotal(TEXT("Gather"));
+	OutResult.ChunkUpdateMs = PhaseTotal(TEXT("ChunkUpdate"));
+	OutResult.BorderSyncMs = PhaseTotal(TEXT("BorderSync"));
+	OutResult.FinalizeMs = PhaseTotal(TEXT("Finalize"));
+	if (const FFluidBenchmarkPhase* Step = OutResult.FindPhase(TEXT("Step")))
+	{
+		OutResult.MeanStepMs = Step->GetMean();
+		OutResult.MinStepMs = Step->GetMin();
+		OutResult.MaxStepMs = Step->GetMax();
+	}
+
+	return true;
+}
+
+FString FFluidBenchmarkReport::ToJson() const
+{
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("formatVersion"), ReportFormatVersion);
+
+	TSharedRef<FJsonObject> MachineObject = MakeShared<FJsonObject>();
+	MachineObject->SetStringField(TEXT("cpu"), Machine.CPUBrand);
+	MachineObject->SetNumberField(TEXT("logicalCores"), Machine.LogicalCores);
+	MachineObject->SetNumberField(TEXT("memoryGB"), Machine.MemoryGB);
+	MachineObject->SetStringField(TEXT("os"), Machine.OSVersion);
+	MachineObject->SetStringField(TEXT("buildConfiguration"), Machine.BuildConfiguration);
+	MachineObject->SetStringField(TEXT("engineVersion"), Machine.EngineVersion);
+	MachineObject->SetStringField(TEXT("timestamp"), Machine.Timestamp);
+	Root->SetObjectField(TEXT("machine"), MachineObject);
+
+	TArray<TSharedPtr<FJsonValue>> ResultValues;
+	for (const FFluidScenarioResult& Result : Results)
+	{
+		ResultValues.Add(MakeShared<FJsonValueObject>(ResultToJson(Result)));
+	}
+	Root->SetArrayField(TEXT("results"), ResultValues);
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Output;
+}
+
+bool FFluidBenchmarkReport::FromJson(const FString& JsonString)
+{
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+		return false;
+
+	int32 FormatVersion = 0;
+	if (!Root->TryGetNumberField(TEXT("formatVersion"), FormatVersion) || FormatVersion != ReportFormatVersion)
+		return false;
+
+	Machine = FFluidBenchmarkMachineInfo();
+	const TSharedPtr<FJsonObject>* MachineObject = nullptr;
+	if (Root->TryGetObjectField(TEXT("machine"), MachineObject))
+	{
+		(*MachineObject)->TryGetStringField(TEXT("cpu"), Machine.CPUBrand);
+		(*MachineObject)->TryGetNumberField(TEXT("logicalCores"), Machine.LogicalCores);
+		(*MachineObject)->TryGetNumberField(TEXT("memoryGB"), Machine.MemoryGB);
+		(*MachineObject)->TryGetStringField(TEXT("os"), Machine.OSVersion);
+		(*MachineObject)->TryGetStringField(TEXT("buildConfiguration"), Machine.BuildConfiguration);
+		(*MachineObject)->TryGetStringField(TEXT("engineVersion"), Machine.EngineVersion);
+		(*MachineObject)->TryGetStringField(TEXT("timestamp"), Machine.Timestamp);
+	}
+
+	Results.Reset();
+	const TArray<TSharedPtr<FJsonValue>>* ResultValues = nullptr;
+	if (!Root->TryGetArrayField(TEXT("results"), ResultValues))
+		return false;
+
+	for (const TSharedPtr<FJsonValue>& Value : *ResultValues)
+	{
+		FFluidScenarioResult Result;
+		if (ResultFromJson(Value->AsObject(), Result))
+		{
+			Results.Add(MoveTemp(Result));
+		}
+	}
+	return true;
+}
+
+bool FFluidBenchmarkReport::SaveToFile(const FString& FilePath) const
+{
+	return FFileHelper::SaveStringToFile(ToJson(), *FilePath);
+}
+
+bool FFluidBenchmarkReport::LoadFromFile(const FString& FilePath)
+{
+	FString JsonString;
+	return FFileHelper::LoadFileToString(JsonString, *FilePath) && FromJson(JsonString);
+}
+
+const FFluidScenarioResult* FFluidBenchmarkReport::FindResult(const FString& ScenarioName) const
+{
+	return Results.FindByPredicate([&ScenarioName](const FFluidScenarioResult& Result) { return Result.ScenarioName == ScenarioName; });
+}
+
+double FFluidBenchmarkReport::ComputeMannWhitneyZ(const TArray<double>& Baseline, const TArray<double>& Current)
+{
+	const int32 NumBaseline = Baseline.Num();
+	const int32 NumCurrent = Current.Num();
+	if (NumBaseline == 0 || NumCurrent == 0)
+		return 0.0;
+
+	struct FRankedSample
+	{
+		double Value;
+		bool bCurrent;
+	};
+
+	TArray<FRankedSample> Combined;
+	Combined.Reserve(NumBaseline + NumCurrent);
+	for (double Value : Baseline)
+	{
+		Combined.Add({ Value, false });
+	}
+	for (double Value : Current)
+	{
+		Combined.Add({ Value, true });
+	}
+	Combined.Sort([](const FRankedSample& A, const FRankedSample& B) { return A.Value < B.Value; });
+
+	// Tied values share the average of their ranks
+	double CurrentRankSum = 0.0;
+	for (int32 First = 0; First < Combined.Num();)
+	{
+		int32 Last = First;
+		while (Last + 1 < Combined.Num() && Combined[Last + 1].Value == Combined[First].Value)
+		{
+			++Last;
+		}
+
+		const double AverageRank = (First + Last) * 0.5 + 1.0;
+		for (int32 Index = First; Index <= Last; ++Index)
+		{
+			CurrentRankSum += Combined[Index].bCurrent ? AverageRank : 0.0;
+		}
+		First = Last + 1;
+	}
+
+	const double N1 = NumBaseline;
+	const double N2 = NumCurrent;
+	const double U = CurrentRankSum - N2 * (N2 + 1.0) * 0.5;
+	const double Mean = N1 * N2 * 0.5;
+	const double Sigma = FMath::Sqrt(N1 * N2 * (N1 + N2 + 1.0) / 12.0);
+	return Sigma > 0.0 ? (U - Mean) / Sigma : 0.0;
+}
+
+FFluidBenchmarkComparison FFluidBenchmarkReport::Compare(const FFluidBenchmarkReport& Baseline, const FFluidBenchmarkReport& Current,
+	const FFluidBenchmarkCompareSettings& Settings)
+{
+	FFluidBenchmarkComparison Comparison;
+
+	if (!Current.Machine.IsSameMachine(Baseline.Machine))
+	{
+		Comparison.Warnings.Add(FString::Printf(TEXT("Baseline ran on '%s' (%d cores, %s), this run on '%s' (%d cores, %s)"),
+			*Baseline.Machine.CPUBrand, Baseline.Machine.LogicalCores, *Baseline.Machine.BuildConfiguration,
+			*Current.Machine.CPUBrand, Current.Machine.LogicalCores, *Current.Machine.BuildConfiguration));
+	}
+
+	for (const FFluidScenarioResult& Result : Current.Results)
+	{
+		const FFluidScenarioResult* BaselineResult = Baseline.FindResult(Result.ScenarioName);
+		if (!BaselineResult)
+		{
+			Comparison.Warnings.Add(FString::Printf(TEXT("%s has no baseline"), *Result.ScenarioName));
+			continue;
+		}
+
+		if (BaselineResult->ConfigurationHash != Result.ConfigurationHash)
+		{
+			Comparison.Warnings.Add(FString::Printf(TEXT("%s configuration changed (%s -> %s), skipped"),
+				*Result.ScenarioName, *BaselineResult->ConfigurationHash, *Result.ConfigurationHash));
+			continue;
+		}
+
+		for (const FFluidBenchmarkPhase& Phase : Result.Phases)
+		{
+			const FFluidBenchmarkPhase* BaselinePhase = BaselineResult->FindPhase(Phase.Name);
+			if (!BaselinePhase || BaselinePhase->GetMedian() < Settings.MinMedianMs)
+				continue;
+
+			FFluidBenchmarkDelta& Delta = Comparison.Deltas.AddDefaulted_GetRef();
+			Delta.Scenario = Result.ScenarioName;
+			Delta.Phase = Phase.Name;
+			Delta.BaselineMedianMs = BaselinePhase->GetMedian();
+			Delta.CurrentMedianMs = Phase.GetMedian();
+			Delta.RelativeChange = Delta.CurrentMedianMs / Delta.BaselineMedianMs - 1.0;
+			Delta.ZScore = ComputeMannWhitneyZ(BaselinePhase->SamplesMs, Phase.SamplesMs);
+
+			// Both the size of the shift and its significance must clear their thresholds
+			Delta.bRegression = Delta.RelativeChange > Settings.RelativeThreshold && Delta.ZScore > Settings.ZScoreThreshold;
+			Delta.bImprovement = Delta.RelativeChange < -Settings.RelativeThreshold && Delta.ZScore < -Settings.ZScoreThreshold;
+		}
+
+		const double BaselineMassError = FMath::Abs(BaselineResult->GetRelativeMassError());
+		const double CurrentMassError = FMath::Abs(Result.GetRelativeMassError());
+		if (CurrentMassError > BaselineMassError + Settings.MassErrorTolerance)
+		{
+			Comparison.MassErrorRegressions.Add(FString::Printf(TEXT("%s mass error grew from %.4f%% to %.4f%%"),
+				*Result.ScenarioName, BaselineMassError * 100.0, CurrentMassError * 100.0));
+		}
+
+		// Growth past the threshold is a regression; a baseline of zero allows none
+		auto CheckGrowth = [&Comparison, &Result, &Settings](const TCHAR* Name, double BaselineValue, double CurrentValue)
+		{
+			if (CurrentValue > BaselineValue * (1.0 + Settings.RelativeThreshold) && CurrentValue > 0.0)
+			{
+				Comparison.MemoryRegressions.Add(FString::Printf(TEXT("%s %s grew from %.2f to %.2f"),
+					*Result.ScenarioName, Name, BaselineValue, CurrentValue));
+			}
+		};
+
+		CheckGrowth(TEXT("peak chunk MB"), BaselineResult->PeakChunkMemoryMB, Result.PeakChunkMemoryMB);
+
+		// Allocation counts exist only when both runs tracked allocations
+		if (BaselineResult->SteadyStateAllocSteps > 0 && Result.SteadyStateAllocSteps > 0)
+		{
+			CheckGrowth(TEXT("mean allocs/step"), BaselineResult->SteadyStateMeanAllocsPerStep, Result.SteadyStateMeanAllocsPerStep);
+			CheckGrowth(TEXT("max allocs/step"), (double)BaselineResult->SteadyStateMaxAllocsPerStep, (double)Result.SteadyStateMaxAllocsPerStep);
+			CheckGrowth(TEXT("bytes/step"), (double)BaselineResult->SteadyStateBytesPerStep, (double)Result.SteadyStateBytesPerStep);
+		}
+		else if (BaselineResult->SteadyStateAllocSteps > 0)
+		{
+			Comparison.Warnings.Add(FString::Printf(TEXT("%s baseline has allocation counts but this run did not track allocations"), *Result.ScenarioName));
+		}
+	}
+
+	return Comparison;
+}
@@ -0,0 +1,392 @@
+#include "Benchmarking/FluidGoldenState.h"
+#include "CellularAutomata/FluidChunkManager.h"
+#include "Algo/Sort.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/FileHelper.h"
+
+const FFluidChunkFingerprint* FFluidStateFingerprint::FindChunk(const FFluidChunkCoord& Coord) const
+{
+	return Chunks.FindByPredicate([&Coord](const FFluidChunkFingerprint& Chunk) { return Chunk.Coord == Coord; });
+}
+
+FFluidStateFingerprint FFluidStateFingerprint::Capture(const UFluidChunkManager& ChunkManager, int32 Step, int32 SurfaceResolution)
+{
+	FFluidStateFingerprint Fingerprint;
+	Fingerprint.Step = Step;
+
+	// Map order is not stable across runs; sums and the stored layout follow coordinates
+	TArray<UFluidChunk*> LoadedChunks = ChunkManager.GetLoadedChunks();
+	LoadedChunks.RemoveAll([](const UFluidChunk* Chunk) { return Chunk == nullptr; });
+	Algo::Sort(LoadedChunks, [](const UFluidChunk* A, const UFluidChunk* B)
+	{
+		const FFluidChunkCoord& CA = A->ChunkCoord;
+		const FFluidChunkCoord& CB = B->ChunkCoord;
+		return CA.Z != CB.Z ? CA.Z < CB.Z : (CA.Y != CB.Y ? CA.Y < CB.Y : CA.X < CB.X);
+	});
+
+	int64 FluidCells = 0;
+	int64 SettledCells = 0;
+	for (const UFluidChunk* Chunk : LoadedChunks)
+	{
+		FFluidChunkFingerprint& ChunkPrint = Fingerprint.Chunks.AddDefaulted_GetRef();
+		ChunkPrint.Coord = Chunk->ChunkCoord;
+
+		auto AddCell = [Chunk, &ChunkPrint](const FCAFluidCell& Cell)
+		{
+			ChunkPrint.Mass += Cell.FluidLevel;
+			if (Cell.FluidLevel > Chunk->MinFluidLevel)
+			{
+				++ChunkPrint.FluidCells;
+				ChunkPrint.SettledCells += Cell.bSettled ? 1 : 0;
+			}
+		};
+		auto FindCell = [Chunk](int32 Index) -> const FCAFluidCell*
+		{
+			return Chunk->bUseSparseRepresentation ? Chunk->SparseCells.Find(Index) : (Chunk->Cells.IsValidIndex(Index) ? &Chunk->Cells[Index] : nullptr);
+		};
+
+		if (Chunk->bUseSparseRepresentation)
+		{
+			for (const TPair<int32, FCAFluidCell>& Pair : Chunk->SparseCells)
+			{
+				AddCell(Pair.Value);
+			}
+		}
+		else
+		{
+			for (const FCAFluidCell& Cell : Chunk->Cells)
+			{
+				AddCell(Cell);
+			}
+		}
+
+		// Topmost wet cell of each column, averaged over square blocks of columns
+		const int32 Size = Chunk->ChunkSize;
+		const int32 Blocks = SurfaceResolution > 0 && Size % SurfaceResolution == 0 ? SurfaceResolution : 1;
+		const int32 BlockSize = Size / Blocks;
+		const float ColumnWeight = 1.0f / (BlockSize * BlockSize);
+		ChunkPrint.SurfaceHeights.SetNumZeroed(Blocks * Blocks);
+		for (int32 Y = 0; Y < Size; ++Y)
+		{
+			for (int32 X = 0; X < Size; ++X)
+			{
+				float Surface = 0.0f;
+				for (int32 Z = Size - 1; Z >= 0; --Z)
+				{
+					const FCAFluidCell* Cell = FindCell(Chunk->GetLocalCellIndex(X, Y, Z));
+					if (Cell && Cell->FluidLevel > Chunk->MinFluidLevel)
+					{
+						Surface = Z + FMath::Min(Cell->FluidLevel, 1.0f);
+						break;
+					}
+				}
+				ChunkPrint.SurfaceHeights[X / BlockSize + (Y / BlockSize) * Blocks] += Surface * ColumnWeight;
+			}
+		}
+
+		Fingerprint.TotalMass += ChunkPrint.Mass;
+		FluidCells += ChunkPrint.FluidCells;
+		SettledCells += ChunkPrint.SettledCells;
+	}
+
+	Fingerprint.SettledFraction = FluidCells > 0 ? (double)SettledCells / FluidCells : 0.0;
+	return Fingerprint;
+}
+
+FString FFluidGoldenComparison::ToString() const
+{
+	FString Result;
+	for (const FString& Failure : Failures)
+	{
+		Result += TEXT("FAILED ") + Failure + LINE_TERMINATOR;
+	}
+	for (const FString& Note : Notes)
+	{
+		Result += Note + LINE_TERMINATOR;
+	}
+	return Result;
+}
+
+const FFluidGoldenScenario* FFluidGoldenFile::FindScenario(const FString& ScenarioName) const
+{
+	return Scenarios.FindByPredicate([&ScenarioName](const FFluidGoldenScenario& Scenario) { return Scenario.ScenarioName == ScenarioName; });
+}
+
+TSharedRef<FJsonObject> FFluidGoldenFile::FingerprintToJson(const FFluidStateFingerprint& Fingerprint)
+{
+	TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+	Object->SetNumberField(TEXT("step"), Fingerprint.Step);
+	Object->SetNumberField(TEXT("totalMass"), Fingerprint.TotalMass);
+	Object->SetNumberField(TEXT("settledFraction"), Fingerprint.SettledFraction);
+
+	TArray<TSharedPtr<FJsonValue>> ChunkValues;
+	for (const FFluidChunkFingerprint& Chunk : Fingerprint.Chunks)
+	{
+		TSharedRef<FJsonObject> ChunkObject = MakeShared<FJsonObject>();
+		ChunkObject->SetNumberField(TEXT("x"), Chunk.Coord.X);
+		ChunkObject->SetNumberField(TEXT("y"), Chunk.Coord.Y);
+		ChunkObject->SetNumberField(TEXT("z"), Chunk.Coord.Z);
+		ChunkObject->SetNumberField(TEXT("mass"), Chunk.Mass);
+		ChunkObject->SetNumberField(TEXT("fluidCells"), Chunk.FluidCells);
+		ChunkObject->SetNumberField(TEXT("settledCells"), Chunk.SettledCells);
+
+		TArray<TSharedPtr<FJsonValue>> Heights;
+		Heights.Reserve(Chunk.SurfaceHeights.Num());
+		for (float Height : Chunk.SurfaceHeights)
+		{
+			Heights.Add(MakeShared<FJsonValueNumber>(Height));
+		}
+		ChunkObject->SetArrayField(TEXT("surface"), Heights);
+		ChunkValues.Add(MakeShared<FJsonValueObject>(ChunkObject));
+	}
+	Object->SetArrayField(TEXT("chunks"), ChunkValues);
+	return Object;
+}
+
+bool FFluidGoldenFile::FingerprintFromJson(const TSharedPtr<FJsonObject>& Object, FFluidStateFingerprint& OutFingerprint)
+{
+	if (!Object.IsValid() || !Object->TryGetNumberField(TEXT("step"), OutFingerprint.Step))
+		return false;
+
+	Object->TryGetNumberField(TEXT("totalMass"), OutFingerprint.TotalMass);
+	Object->TryGetNumberField(TEXT("settledFraction"), OutFingerprint.SettledFraction);
+
+	const TArray<TSharedPtr<FJsonValue>>* ChunkValues = nullptr;
+	if (Object->TryGetArrayField(TEXT("chunks"), ChunkValues))
+	{
+		for (const TSharedPtr<FJsonValue>& Value : *ChunkValues)
+		{
+			const TSharedPtr<FJsonObject> ChunkObject = Value->AsObject();
+			if (!ChunkObject.IsValid())
+				continue;
+
+			FFluidChunkFingerprint& Chunk = OutFingerprint.Chunks.AddDefaulted_GetRef();
+			ChunkObject->TryGetNumberField(TEXT("x"), Chunk.Coord.X);
+			ChunkObject->TryGetNumberField(TEXT("y"), Chunk.Coord.Y);
+			ChunkObject->TryGetNumberField(TEXT("z"), Chunk.Coord.Z);
+			ChunkObject->TryGetNumberField(TEXT("mass"), Chunk.Mass);
+			ChunkObject->TryGetNumberField(TEXT("fluidCells"), Chunk.FluidCells);
+			ChunkObject->TryGetNumberField(TEXT("settledCells"), Chunk.SettledCells);
+
+			const TArray<TSharedPtr<FJsonValue>>* Heights = nullptr;
+			if (ChunkObject->TryGetArrayField(TEXT("surface"), Heights))
+			{
+				for (const TSharedPtr<FJsonValue>& Height : *Heights)
+				{
+					Chunk.SurfaceHeights.Add(Height->AsNumber());
+				}
+			}
+		}
+	}
+	return true;
+}
+
+FString FFluidGoldenFile::ToJson() const
+{
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("formatVersion"), Version);
+
+	TArray<TSharedPtr<FJsonValue>> ScenarioValues;
+	for (const FFluidGoldenScenario& Scenario : Scenarios)
+	{
+		TSharedRef<FJsonObject> ScenarioObject = MakeShared<FJsonObject>();
+		ScenarioObject->SetStringField(TEXT("scenario"), Scenario.ScenarioName);
+		ScenarioObject->SetStringField(TEXT("configurationHash"), Scenario.ConfigurationHash);
+
+		TArray<TSharedPtr<FJsonValue>> FingerprintValues;
+		for (const FFluidStateFingerprint& Fingerprint : Scenario.Fingerprints)
+		{
+			FingerprintValues.Add(MakeShared<FJsonValueObject>(FingerprintToJson(Fingerprint)));
+		}
+		ScenarioObject->SetArrayField(TEXT("fingerprints"), FingerprintValues);
+		ScenarioValues.Add(MakeShared<FJsonValueObject>(ScenarioObject));
+	}
+	Root->SetArrayField(TEXT("scenarios"), ScenarioValues);
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Output;
+}
+
+bool FFluidGoldenFile::FromJson(const FString& JsonString)
+{
+	TSharedPtr<FJsonObject> Root;
+	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+		return false;
+
+	int32 FormatVersion = 0;
+	if (!Root->TryGetNumberField(TEXT("formatVersion"), FormatVersion) || FormatVersion != Version)
+		return false;
+
+	Scenarios.Reset();
+	const TArray<TSharedPtr<FJsonValue>>* ScenarioValues = nullptr;
+	if (!Root->TryGetArrayField(TEXT("scenarios"), ScenarioValues))
+		return false;
+
+	for (const TSharedPtr<FJsonValue>& Value : *ScenarioValues)
+	{
+		const TSharedPtr<FJsonObject> ScenarioObject = Value->AsObject();
+		FFluidGoldenScenario Scenario;
+		if (!ScenarioObject.IsValid() || !ScenarioObject->TryGetStringField(TEXT("scenario"), Scenario.ScenarioName))
+			continue;
+
+		ScenarioObject->TryGetStringField(TEXT("configurationHash"), Scenario.ConfigurationHash);
+		const TArray<TSharedPtr<FJsonValue>>* FingerprintValues = nullptr;
+		if (ScenarioObject->TryGetArrayField(TEXT("fingerprints"), FingerprintValues))
+		{
+			for (const TSharedPtr<FJsonValue>& FingerprintValue : *FingerprintValues)
+			{
+				FFluidStateFingerprint Fingerprint;
+				if (FingerprintFromJson(FingerprintValue->AsObject(), Fingerprint))
+				{
+					Scenario.Fingerprints.Add(MoveTemp(Fingerprint));
+				}
+			}
+		}
+		Scenarios.Add(MoveTemp(Scenario));
+	}
+	return true;
+}
+
+bool FFluidGoldenFile::SaveToFile(const FString& FilePath) const
+{
+	return FFileHelper::SaveStringToFile(ToJson(), *FilePath);
+}
+
+bool FFluidGoldenFile::LoadFromFile(const FString& FilePath)
+{
+	FString JsonString;
+	return FFileHelper::LoadFileToString(JsonString, *FilePath) && FromJson(JsonString);
+}
+
+FFluidGoldenComparison FFluidGoldenFile::Compare(const FFluidGoldenFile& Reference, const FFluidGoldenFile& Current, const FFluidGoldenTolerances& Tolerances)
+{
+	FFluidGoldenComparison Comparison;
+	for (const FFluidGoldenScenario& Scenario : Current.Scenarios)
+	{
+		const FFluidGoldenScenario* ReferenceScenario = Reference.FindScenario(Scenario.ScenarioName);
+		if (!ReferenceScenario)
+		{
+			Comparison.Failures.Add(FString::Printf(TEXT("%s: no reference fingerprints"), *Scenario.ScenarioName));
+			continue;
+		}
+		CompareScenario(*ReferenceScenario, Scenario, Tolerances, Comparison);
+	}
+	return Comparison;
+}
+
+void FFluidGoldenFile::CompareScenario(const FFluidGoldenScenario& Reference, const FFluidGoldenScenario& Current,
+	const FFluidGoldenTolerances& Tolerances, FFluidGoldenComparison& OutComparison)
+{
+	const FString& Name = Current.ScenarioName;
+	if (Reference.ConfigurationHash != Current.ConfigurationHash)
+	{
+		OutComparison.Failures.Add(FString::Printf(TEXT("%s: reference is for configuration %s, this run is %s; regenerate it if the scenario change is intended"),
+			*Name, *Reference.ConfigurationHash, *Current.ConfigurationHash));
+		return;
+	}
+
+	double WorstMass = 0.0;
+	double WorstChunkMass = 0.0;
+	double WorstSettled = 0.0;
+	double WorstSurfaceRMS = 0.0;
+	double WorstSurfaceMax = 0.0;
+	for (const FFluidStateFingerprint& Expected : Reference.Fingerprints)
+	{
+		const FFluidStateFingerprint* Actual = Current.Fingerprints.FindByPredicate([&Expected](const FFluidStateFingerprint& Fingerprint) { return Fingerprint.Step == Expected.Step; });
+		if (!Actual)
+		{
+			OutComparison.Failures.Add(FString::Printf(TEXT("%s step %d: not captured"), *Name, Expected.Step));
+			continue;
+		}
+
+		const double MassError = FMath::Abs(Actual->TotalMass - Expected.TotalMass) / FMath::Max(Expected.TotalMass, 1.0);
+		WorstMass = FMath::Max(WorstMass, MassError);
+		if (MassError > Tolerances.TotalMassRelative)
+		{
+			OutComparison.Failures.Add(FString::Printf(TEXT("%s step %d: total mass %.3f, reference %.3f (%.4f%%)"),
+				*Name, Expected.Step, Actual->TotalMass, Expected.TotalMass, MassError * 100.0));
+		}
+
+		const double SettledError = FMath::Abs(Actual->SettledFraction - Expected.SettledFraction);
+		WorstSettled = FMath::Max(WorstSettled, SettledError);
+		if (SettledError > Tolerances.SettledFraction)
+		{
+			OutComparison.Failures.Add(FString::Printf(TEXT("%s step %d: settled fraction %.3f, reference %.3f"),
+				*Name, Expected.Step, Actual->SettledFraction, Expected.SettledFraction));
+		}
+
+		// Per chunk: only the worst chunk is reported, with how many others are out of tolerance
+		int32 ChunksOver = 0;
+		const FFluidChunkFingerprint* WorstChunk = nullptr;
+		double WorstChunkError = 0.0;
+		double SquaredSurfaceError = 0.0;
+		double StepSurfaceMax = 0.0;
+		int32 SurfaceSamples = 0;
+		for (const FFluidChunkFingerprint& ExpectedChunk : Expected.Chunks)
+		{
+			const FFluidChunkFingerprint* ActualChunk = Actual->FindChunk(ExpectedChunk.Coord);
+			if (!ActualChunk)
+			{
+				OutComparison.Failures.Add(FString::Printf(TEXT("%s step %d: chunk %s not loaded"), *Name, Expected.Step, *ExpectedChunk.Coord.ToString()));
+				continue;
+			}
+
+			const double ChunkError = FMath::Abs(ActualChunk->Mass - ExpectedChunk.Mass) / FMath::Max(ExpectedChunk.Mass, 1.0);
+			if (ChunkError > Tolerances.ChunkMassRelative)
+			{
+				++ChunksOver;
+			}
+			if (ChunkError > WorstChunkError)
+			{
+				WorstChunkError = ChunkError;
+				WorstChunk = &ExpectedChunk;
+			}
+
+			if (ActualChunk->SurfaceHeights.Num() == ExpectedChunk.SurfaceHeights.Num())
+			{
+				for (int32 i = 0; i < ExpectedChunk.SurfaceHeights.Num(); ++i)
+				{
+					const double Error = FMath::Abs(ActualChunk->SurfaceHeights[i] - ExpectedChunk.SurfaceHeights[i]);
+					SquaredSurfaceError += Error * Error;
+					StepSurfaceMax = FMath::Max(StepSurfaceMax, Error);
+					++SurfaceSamples;
+				}
+			}
+		}
+
+		for (const FFluidChunkFingerprint& ActualChunk : Actual->Chunks)
+		{
+			if (!Expected.FindChunk(ActualChunk.Coord) && ActualChunk.Mass > 1.0)
+			{
+				OutComparison.Failures.Add(FString::Printf(TEXT("%s step %d: chunk %s holds %.3f but is not in the reference"),
+					*Name, Expected.Step, *ActualChunk.Coord.ToString(), ActualChunk.Mass));
+			}
+		}
+
+		WorstChunkMass = FMath::Max(WorstChunkMass, WorstChunkError);
+		if (ChunksOver > 0)
+		{
+			const FFluidChunkFingerprint* ActualChunk = Actual->FindChunk(WorstChunk->Coord);
+			OutComparison.Failures.Add(FString::Printf(TEXT("%s step %d: %d chunk(s) off in mass, worst %s holds %.3f, reference %.3f"),
+				*Name, Expected.Step, ChunksOver, *WorstChunk->Coord.ToString(), ActualChunk->Mass, WorstChunk->Mass));
+		}
+
+		const double SurfaceRMS = SurfaceSamples > 0 ? FMath::Sqrt(SquaredSurfaceError / SurfaceSamples) : 0.0;
+		WorstSurfaceRMS = FMath::Max(WorstSurfaceRMS, SurfaceRMS);
+		WorstSurfaceMax = FMath::Max(WorstSurfaceMax, StepSurfaceMax);
+		if (SurfaceRMS > Tolerances.SurfaceRMSCells || StepSurfaceMax > Tolerances.SurfaceMaxCells)
+		{
+			OutComparison.Failures.Add(FString::Printf(TEXT("%s step %d: surface height off by %.3f cells RMS, %.3f at most"),
+				*Name, Expected.Step, SurfaceRMS, StepSurfaceMax));
+		}
+	}
+
+	OutComparison.Notes.Add(FString::Printf(TEXT("%s: %d fingerprints, worst mass %.4f%%, chunk mass %.4f%%, settled %.3f, surface %.3f RMS / %.3f max cells"),
+		*Name, Reference.Fingerprints.Num(), WorstMass * 100.0, WorstChunkMass * 100.0, WorstSettled, WorstSurfaceRMS, WorstSurfaceMax));
+}
@@ -0,0 +1,343 @@
+#include "Benchmarking/FluidKernelBenchmark.h"
+#include "CellularAutomata/CAFluidGrid.h"
+#include "CellularAutomata/FluidChunk.h"
+#include "CellularAutomata/FluidChunkManager.h"
+#include "CellularAutomata/MultiResolutionSolver.h"
+#include "Visualization/MarchingCubes.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+double FFluidKernelResult::GetNsPerCell() const
+{
+	return Cells > 0 ? Timing.GetMedian() * 1.0e6 / Cells : 0.0;
+}
+
+double FFluidKernelResult::GetCellsPerSecond() const
+{
+	const double MedianMs = Timing.GetMedian();
+	return MedianMs > 0.0 ? Cells / (MedianMs * 1.0e-3) : 0.0;
+}
+
+double FFluidKernelResult::GetGBPerSecond() const
+{
+	const double MedianMs = Timing.GetMedian();
+	return MedianMs > 0.0 ? BytesTouched / (MedianMs * 1.0e-3) / 1.0e9 : 0.0;
+}
+
+FString FFluidKernelResult::ToString() const
+{
+	return FString::Printf(TEXT("%-20s size %3d fill %.2f: median %.4fms (min %.4fms, p90 %.4fms), %.2f ns/cell, %.1f Mcells/s, %.2f GB/s"),
+		FFluidKernelBenchmark::GetKernelName(Kernel), Size, FillRatio, Timing.GetMedian(), Timing.GetMin(), Timing.GetPercentile(90.0),
+		GetNsPerCell(), GetCellsPerSecond() / 1.0e6, GetGBPerSecond());
+}
+
+FString FFluidKernelResult::GetCSVHeader()
+{
+	return TEXT("Kernel,Size,FillRatio,Cells,Iterations,MeanMs,MedianMs,MinMs,P90Ms,MaxMs,NsPerCell,CellsPerSecond,BytesTouched,GBPerSecond");
+}
+
+FString FFluidKernelResult::ToCSVRow() const
+{
+	return FString::Printf(TEXT("%s,%d,%.2f,%lld,%d,%.5f,%.5f,%.5f,%.5f,%.5f,%.3f,%.0f,%lld,%.3f"),
+		FFluidKernelBenchmark::GetKernelName(Kernel), Size, FillRatio, Cells, Timing.SamplesMs.Num(),
+		Timing.GetMean(), Timing.GetMedian(), Timing.GetMin(), Timing.GetPercentile(90.0), Timing.GetMax(),
+		GetNsPerCell(), GetCellsPerSecond(), BytesTouched, GetGBPerSecond());
+}
+
+FFluidKernelBenchmark::FFluidKernelBenchmark(const FFluidKernelBenchmarkSettings& InSettings)
+	: Settings(InSettings)
+{
+	Settings.WarmupIterations = FMath::Max(0, Settings.WarmupIterations);
+	Settings.Iterations = FMath::Max(1, Settings.Iterations);
+}
+
+const TCHAR* FFluidKernelBenchmark::GetKernelName(EFluidBenchmarkKernel Kernel)
+{
+	switch (Kernel)
+	{
+	case EFluidBenchmarkKernel::GridCombinedPhysics: return TEXT("GridCombinedPhysics");
+	case EFluidBenchmarkKernel::GridHorizontalFlow: return TEXT("GridHorizontalFlow");
+	case EFluidBenchmarkKernel::GridEqualization: return TEXT("GridEqualization");
+	case EFluidBenchmarkKernel::ChunkGravity: return TEXT("ChunkGravity");
+	case EFluidBenchmarkKernel::ChunkFlowRules: return TEXT("ChunkFlowRules");
+	case EFluidBenchmarkKernel::ChunkPressure: return TEXT("ChunkPressure");
+	case EFluidBenchmarkKernel::ChunkColumnPressure: return TEXT("ChunkColumnPressure");
+	case EFluidBenchmarkKernel::ChunkStep: return TEXT("ChunkStep");
+	case EFluidBenchmarkKernel::CrossChunkFlow: return TEXT("CrossChunkFlow");
+	case EFluidBenchmarkKernel::MarchingCubes: return TEXT("MarchingCubes");
+	case EFluidBenchmarkKernel::MultiResPressure: return TEXT("MultiResPressure");
+	default: return TEXT("Unknown");
+	}
+}
+
+bool FFluidKernelBenchmark::ParseKernelName(const FString& Name, EFluidBenchmarkKernel& OutKernel)
+{
+	for (EFluidBenchmarkKernel Kernel : GetAllKernels())
+	{
+		if (Name.Equals(GetKernelName(Kernel), ESearchCase::IgnoreCase))
+		{
+			OutKernel = Kernel;
+			return true;
+		}
+	}
+	return false;
+}
+
+TArray<EFluidBenchmarkKernel> FFluidKernelBenchmark::GetAllKernels()
+{
+	TArray<EFluidBenchmarkKernel> Kernels;
+	for (int32 i = 0; i < (int32)EFluidBenchmarkKernel::Count; ++i)
+	{
+		Kernels.Add((EFluidBenchmarkKernel)i);
+	}
+	return Kernels;
+}
+
+TArray<FFluidKernelResult> FFluidKernelBenchmark::Run(const TArray<EFluidBenchmarkKernel>& Kernels) const
+{
+	TArray<FFluidKernelResult> Results;
+	for (EFluidBenchmarkKernel Kernel : Kernels)
+	{
+		for (int32 Size : Settings.Sizes)
+		{
+			for (float FillRatio : Settings.FillRatios)
+			{
+				Results.Add(RunKernel(Kernel, Size, FillRatio));
+			}
+		}
+	}
+	return Results;
+}
+
+FFluidKernelResult FFluidKernelBenchmark::RunKernel(EFluidBenchmarkKernel Kernel, int32 Size, float FillRatio) const
+{
+	FFluidKernelResult Result;
+	Result.Kernel = Kernel;
+	Result.Size = FMath::Max(4, Size);
+	Result.FillRatio = FMath::Clamp(FillRatio, 0.0f, 1.0f);
+	Result.Cells = (int64)Result.Size * Result.Size * Result.Size;
+	Result.Timing = FFluidBenchmarkPhase(GetKernelName(Kernel));
+
+	TArray<FCAFluidCell> Input;
+	BuildInput(Result.Size, Result.FillRatio, Input);
+
+	// Cell kernels read the current buffer and write the next one
+	Result.BytesTouched = 2 * Result.Cells * (int64)sizeof(FCAFluidCell);
+
+	switch (Kernel)
+	{
+	case EFluidBenchmarkKernel::GridCombinedPhysics:
+	case EFluidBenchmarkKernel::GridHorizontalFlow:
+	case EFluidBenchmarkKernel::GridEqualization:
+	case EFluidBenchmarkKernel::MultiResPressure:
+		RunGridKernel(Result, Input);
+		break;
+	case EFluidBenchmarkKernel::ChunkGravity:
+	case EFluidBenchmarkKernel::ChunkFlowRules:
+	case EFluidBenchmarkKernel::ChunkPressure:
+	case EFluidBenchmarkKernel::ChunkColumnPressure:
+	case EFluidBenchmarkKernel::ChunkStep:
+		RunChunkKernel(Result, Input);
+		break;
+	case EFluidBenchmarkKernel::CrossChunkFlow:
+		RunCrossChunkFlow(Result, Input);
+		break;
+	case EFluidBenchmarkKernel::MarchingCubes:
+		RunMarchingCubes(Result, Input);
+		break;
+	default:
+		break;
+	}
+
+	return Result;
+}
+
+void FFluidKernelBenchmark::BuildInput(int32 Size, float FillRatio, TArray<FCAFluidCell>& OutCells) const
+{
+	// Seeded per size and fill so each configuration gets the same input whatever else runs
+	FRandomStream Random(HashCombine(HashCombine(GetTypeHash(Settings.Seed), GetTypeHash(Size)), GetTypeHash(FillRatio)));
+
+	OutCells.SetNum(Size * Size * Size);
+	for (int32 Y = 0; Y < Size; ++Y)
+	{
+		for (int32 X = 0; X < Size; ++X)
+		{
+			// Rough floor up to an eighth of the height, so flow meets obstacles and steps
+			const int32 FloorHeight = 1 + Random.RandHelper(FMath::Max(1, Size / 8));
+			for (int32 Z = 0; Z < Size; ++Z)
+			{
+				FCAFluidCell& Cell = OutCells[X + (Y + Z * Size) * Size];
+				Cell = FCAFluidCell();
+				Cell.TerrainHeight = FloorHeight * Settings.CellSize;
+				Cell.bIsSolid = Z < FloorHeight;
+
+				if (!Cell.bIsSolid && Random.FRand() < FillRatio)
+				{
+					Cell.FluidLevel = Random.FRandRange(0.05f, 1.0f);
+					Cell.LastFluidLevel = Cell.FluidLevel;
+				}
+			}
+		}
+	}
+}
+
+void FFluidKernelBenchmark::Measure(FFluidKernelResult& Result, TFunctionRef<void()> Setup, TFunctionRef<void()> Kernel) const
+{
+	Result.Timing.SamplesMs.Reset(Settings.Iterations);
+
+	for (int32 Iteration = 0; Iteration < Settings.WarmupIterations + Settings.Iterations; ++Iteration)
+	{
+		Setup();
+
+		const double StartTime = FPlatformTime::Seconds();
+		Kernel();
+		const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+		if (Iteration >= Settings.WarmupIterations)
+		{
+			Result.Timing.SamplesMs.Add(ElapsedMs);
+		}
+	}
+}
+
+void FFluidKernelBenchmark::RunGridKernel(FFluidKernelResult& Result, const TArray<FCAFluidCell>& Input) const
+{
+	TStrongObjectPtr<UCAFluidGrid> Grid(NewObject<UCAFluidGrid>(GetTransientPackage()));
+	Grid->InitializeGrid(Result.Size, Result.Size, Result.Size, Settings.CellSize);
+	Grid->bEnableSettling = false;
+
+	const float DeltaTime = Settings.DeltaTime;
+	UCAFluidGrid* GridPtr = Grid.Get();
+	auto Setup = [GridPtr, &Input]()
+	{
+		GridPtr->Cells = Input;
+		GridPtr->NextCells = Input;
+	};
+
+	switch (Result.Kernel)
+	{
+	case EFluidBenchmarkKernel::GridCombinedPhysics:
+		Measure(Result, Setup, [GridPtr, DeltaTime]() { GridPtr->ProcessCombinedPhysics(DeltaTime); });
+		break;
+	case EFluidBenchmarkKernel::GridHorizontalFlow:
+		Measure(Result, Setup, [GridPtr, DeltaTime]() { GridPtr->ProcessHorizontalFlow(DeltaTime); });
+		break;
+	case EFluidBenchmarkKernel::GridEqualization:
+		Measure(Result, Setup, [GridPtr, DeltaTime]() { GridPtr->ProcessEqualization(DeltaTime); });
+		break;
+	case EFluidBenchmarkKernel::MultiResPressure:
+		Measure(Result, Setup, [GridPtr, DeltaTime]() { FMultiResolutionSolver::SolvePressureMultiRes(GridPtr, 2, 4, DeltaTime); });
+		break;
+	default:
+		break;
+	}
+}
+
+void FFluidKernelBenchmark::RunChunkKernel(FFluidKernelResult& Result, const TArray<FCAFluidCell>& Input) const
+{
+	TStrongObjectPtr<UFluidChunk> Chunk(NewObject<UFluidChunk>(GetTransientPackage()));
+	Chunk->Initialize(FFluidChunkCoord(0, 0, 0), Result.Size, Settings.CellSize, FVector::ZeroVector);
+	Chunk->ActivateChunk();
+
+	const float DeltaTime = Settings.DeltaTime;
+	UFluidChunk* ChunkPtr = Chunk.Get();
+	auto Setup = [ChunkPtr, &Input, DeltaTime]()
+	{
+		// A full step may switch the chunk to sparse storage; start every iteration dense and unsettled
+		ChunkPtr->bUseSparseRepresentation = false;
+		ChunkPtr->SparseCells.Reset();
+		ChunkPtr->SparseNextCells.Reset();
+		ChunkPtr->bFullySettled = false;
+		ChunkPtr->Cells = Input;
+		ChunkPtr->NextCells = Input;
+		ChunkPtr->FlowField.BeginStep(ChunkPtr->ChunkSize, DeltaTime);
+	};
+
+	switch (Result.Kernel)
+	{
+	case EFluidBenchmarkKernel::ChunkGravity:
+		Measure(Result, Setup, [ChunkPtr, DeltaTime]() { ChunkPtr->ApplyGravity(DeltaTime); });
+		break;
+	case EFluidBenchmarkKernel::ChunkFlowRules:
+		Measure(Result, Setup, [ChunkPtr, DeltaTime]() { ChunkPtr->ApplyFlowRules(DeltaTime); });
+		break;
+	case EFluidBenchmarkKernel::ChunkPressure:
+		Measure(Result, Setup, [ChunkPtr, DeltaTime]() { ChunkPtr->ApplyPressure(DeltaTime); });
+		break;
+	case EFluidBenchmarkKernel::ChunkColumnPressure:
+		Measure(Result, Setup, [ChunkPtr]() { ChunkPtr->ApplyColumnPressure(); });
+		break;
+	case EFluidBenchmarkKernel::ChunkStep:
+		Measure(Result, Setup, [ChunkPtr, DeltaTime]()
+		{
+			ChunkPtr->UpdateSimulation(DeltaTime);
+			ChunkPtr->FinalizeSimulationStep();
+		});
+		break;
+	default:
+		break;
+	}
+}
+
+void FFluidKernelBenchmark::RunCrossChunkFlow(FFluidKernelResult& Result, const TArray<FCAFluidCell>& Input) const
+{
+	TStrongObjectPtr<UFluidChunkManager> Manager(NewObject<UFluidChunkManager>(GetTransientPackage()));
+	TStrongObjectPtr<UFluidChunk> ChunkA(NewObject<UFluidChunk>(GetTransientPackage()));
+	TStrongObjectPtr<UFluidChunk> ChunkB(NewObject<UFluidChunk>(GetTransientPackage()));
+	ChunkA->Initialize(FFluidChunkCoord(0, 0, 0), Result.Size, Settings.CellSize, FVector::ZeroVector);
+	ChunkB->Initialize(FFluidChunkCoord(1, 0, 0), Result.Size, Settings.CellSize, FVector::ZeroVector);
+	ChunkA->ActivateChunk();
+	ChunkB->ActivateChunk();
+
+	// Only the shared X face is exchanged
+	Result.Cells = 2 * (int64)Result.Size * Result.Size;
+	Result.BytesTouched = 2 * Result.Cells * (int64)sizeof(FCAFluidCell);
+
+	const float DeltaTime = Settings.DeltaTime;
+	UFluidChunkManager* ManagerPtr = Manager.Get();
+	UFluidChunk* APtr = ChunkA.Get();
+	UFluidChunk* BPtr = ChunkB.Get();
+	Measure(Result,
+		[APtr, BPtr, &Input, DeltaTime]()
+		{
+			for (UFluidChunk* Chunk : { APtr, BPtr })
+			{
+				Chunk->Cells = Input;
+				Chunk->NextCells = Input;
+				Chunk->FlowField.BeginStep(Chunk->ChunkSize, DeltaTime);
+			}
+		},
+		[ManagerPtr, APtr, BPtr, DeltaTime]() { ManagerPtr->ProcessCrossChunkFlow(APtr, BPtr, DeltaTime); });
+}
+
+void FFluidKernelBenchmark::RunMarchingCubes(FFluidKernelResult& Result, const TArray<FCAFluidCell>& Input) const
+{
+	TArray<float> Density;
+	Density.SetNumUninitialized(Input.Num());
+	for (int32 i = 0; i < Input.Num(); ++i)
+	{
+		Density[i] = Input[i].bIsSolid ? 0.0f : Input[i].FluidLevel;
+	}
+
+	const FIntVector GridSize(Result.Size);
+	const float CellSize = Settings.CellSize;
+	TArray<FMarchingCubes::FMarchingCubesVertex> Vertices;
+	TArray<FMarchingCubes::FMarchingCubesTriangle> Triangles;
+
+	Measure(Result,
+		[&Vertices, &Triangles]()
+		{
+			Vertices.Reset();
+			Triangles.Reset();
+		},
+		[&Density, &GridSize, CellSize, &Vertices, &Triangles]()
+		{
+			FMarchingCubes::GenerateGridMesh(Density, GridSize, CellSize, FVector::ZeroVector, 0.5f, Vertices, Triangles);
+		});
+
+	// Density read once, generated mesh written once
+	Result.BytesTouched = Density.Num() * (int64)sizeof(float)
+		+ Vertices.Num() * (int64)sizeof(FMarchingCubes::FMarchingCubesVertex)
+		+ Triangles.Num() * (int64)sizeof(FMarchingCubes::FMarchingCubesTriangle);
+}
@@ -0,0 +1,275 @@
+#include "Benchmarking/FluidScalingBenchmark.h"
+#include "UObject/UObjectGlobals.h"
+
+FString FFluidScalingFill::GetName() const
+{
+	const FString Name = FFluidScenarioBenchmark::GetScenarioName(Scenario);
+	return Scenario == EFluidBenchmarkScenario::Pool ? FString::Printf(TEXT("%s:%.2f"), *Name, FillFraction) : Name;
+}
+
+bool FFluidScalingFill::Parse(const FString& Text, FFluidScalingFill& OutFill)
+{
+	FString Name = Text.TrimStartAndEnd();
+	FString Fraction;
+	const bool bHasFraction = Name.Split(TEXT(":"), &Name, &Fraction);
+
+	FFluidScalingFill Fill;
+	if (!FFluidScenarioBenchmark::ParseScenarioName(Name, Fill.Scenario))
+		return false;
+
+	if (bHasFraction)
+	{
+		if (Fill.Scenario != EFluidBenchmarkScenario::Pool || !Fraction.IsNumeric())
+			return false;
+		Fill.FillFraction = FMath::Clamp(FCString::Atof(*Fraction), 0.0f, 0.66f);
+	}
+
+	OutFill = Fill;
+	return true;
+}
+
+double FFluidScalingPoint::GetCellsPerSecond() const
+{
+	const double SimulationMs = GetSimulationMs();
+	return SimulationMs > 0.0 ? MeanChunksSimulated * FMath::Cube((double)ChunkSize) / (SimulationMs * 1.0e-3) : 0.0;
+}
+
+double FFluidScalingPoint::GetChunkStepsPerSecond() const
+{
+	const double SimulationMs = GetSimulationMs();
+	return SimulationMs > 0.0 ? MeanChunksSimulated / (SimulationMs * 1.0e-3) : 0.0;
+}
+
+double FFluidScalingPoint::GetSerialShare() const
+{
+	const double SimulationMs = GetSimulationMs();
+	return SimulationMs > 0.0 ? (GatherMs + BorderSyncMs + FinalizeMs) / SimulationMs : 0.0;
+}
+
+FString FFluidScalingPoint::ToString() const
+{
+	return FString::Printf(TEXT("%-10s size %2d, %3d chunks, %2d threads: %.3fms/step (update %.3f, border %.3f, serial %.0f%%), %.1f Mcells/s, speedup %.2fx, efficiency %.0f%%"),
+		*Fill.GetName(), ChunkSize, GetChunkCount(), Threads, GetSimulationMs(), ChunkUpdateMs, BorderSyncMs, GetSerialShare() * 100.0,
+		GetCellsPerSecond() / 1.0e6, Speedup, Efficiency * 100.0);
+}
+
+FString FFluidScalingPoint::GetCSVHeader()
+{
+	return TEXT("Fill,ChunkSize,ChunkCount,Threads,ChunksSimulated,GatherMs,ChunkUpdateMs,BorderSyncMs,FinalizeMs,SimulationMs,SerialShare,CellsPerSecond,ChunkStepsPerSecond,Speedup,Efficiency");
+}
+
+FString FFluidScalingPoint::ToCSVRow() const
+{
+	return FString::Printf(TEXT("%s,%d,%d,%d,%.1f,%.5f,%.5f,%.5f,%.5f,%.5f,%.4f,%.0f,%.1f,%.3f,%.3f"),
+		*Fill.GetName(), ChunkSize, GetChunkCount(), Threads, MeanChunksSimulated, GatherMs, ChunkUpdateMs, BorderSyncMs, FinalizeMs,
+		GetSimulationMs(), GetSerialShare(), GetCellsPerSecond(), GetChunkStepsPerSecond(), Speedup, Efficiency);
+}
+
+FString FFluidScalingReport::ToString() const
+{
+	FString Result = TEXT("Knees:");
+	for (const FString& Knee : Knees)
+	{
+		Result += TEXT("\n  ") + Knee;
+	}
+	Result += TEXT("\nMaxActiveChunks:");
+	for (const FString& Recommendation : Recommendations)
+	{
+		Result += TEXT("\n  ") + Recommendation;
+	}
+	return Result;
+}
+
+FString FFluidScalingReport::ToCSV() const
+{
+	FString Result = FFluidScalingPoint::GetCSVHeader() + LINE_TERMINATOR;
+	for (const FFluidScalingPoint& Point : Points)
+	{
+		Result += Point.ToCSVRow() + LINE_TERMINATOR;
+	}
+	return Result;
+}
+
+FFluidScalingBenchmark::FFluidScalingBenchmark(const FFluidScalingSettings& InSettings)
+	: Settings(InSettings)
+{
+	if (Settings.Fills.Num() == 0)
+	{
+		Settings.Fills.Add({ EFluidBenchmarkScenario::Pool, 0.25f });
+		Settings.Fills.Add({ EFluidBenchmarkScenario::Pool, 0.6f });
+	}
+
+	// Curves are read in ascending order
+	Settings.ChunksPerSide.Sort();
+	Settings.ThreadCounts.Sort();
+	Settings.ChunkSizes.Sort();
+	Settings.StepCount = FMath::Max(1, Settings.StepCount);
+}
+
+FFluidScalingReport FFluidScalingBenchmark::Run(TFunction<void(const FFluidScalingPoint&)> OnPoint) const
+{
+	FFluidScalingReport Report;
+	for (const FFluidScalingFill& Fill : Settings.Fills)
+	{
+		for (int32 ChunkSize : Settings.ChunkSizes)
+		{
+			for (int32 ChunksPerSide : Settings.ChunksPerSide)
+			{
+				for (int32 Threads : Settings.ThreadCounts)
+				{
+					Report.Points.Add(RunPoint(Fill, ChunkSize, ChunksPerSide, Threads));
+					if (OnPoint)
+					{
+						OnPoint(Report.Points.Last());
+					}
+
+					// Chunks from the finished run are garbage once its manager is released
+					CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+				}
+			}
+		}
+	}
+
+	Analyze(Report);
+	return Report;
+}
+
+FFluidScalingPoint FFluidScalingBenchmark::RunPoint(const FFluidScalingFill& Fill, int32 ChunkSize, int32 ChunksPerSide, int32 Threads) const
+{
+	FFluidScenarioSettings ScenarioSettings;
+	ScenarioSettings.Scenario = Fill.Scenario;
+	ScenarioSettings.FillFraction = Fill.FillFraction;
+	ScenarioSettings.StepCount = Settings.StepCount;
+	ScenarioSettings.Seed = Settings.Seed;
+	ScenarioSettings.CellSize = Settings.CellSize;
+	ScenarioSettings.ChunkSize = ChunkSize;
+	ScenarioSettings.ChunksPerSide = ChunksPerSide;
+	ScenarioSettings.SimulationThreads = Threads;
+
+	const FFluidScenarioResult Result = FFluidScenarioBenchmark::RunScenario(ScenarioSettings);
+
+	FFluidScalingPoint Point;
+	Point.Fill = Fill;
+	Point.ChunkSize = ChunkSize;
+	Point.ChunksPerSide = ChunksPerSide;
+	Point.Threads = Threads;
+	Point.MeanChunksSimulated = (double)Result.ChunkSteps / FMath::Max(1, Result.StepCount);
+
+	auto GetMedian = [&Result](const TCHAR* PhaseName)
+	{
+		const FFluidBenchmarkPhase* Phase = Result.FindPhase(PhaseName);
+		return Phase ? Phase->GetMedian() : 0.0;
+	};
+	Point.GatherMs = GetMedian(TEXT("Gather"));
+	Point.ChunkUpdateMs = GetMedian(TEXT("ChunkUpdate"));
+	Point.BorderSyncMs = GetMedian(TEXT("BorderSync"));
+	Point.FinalizeMs = GetMedian(TEXT("Finalize"));
+	return Point;
+}
+
+void FFluidScalingBenchmark::Analyze(FFluidScalingReport& Report) const
+{
+	// Points of one curve, in the order they were run
+	TMap<FString, TArray<int32>> ThreadCurves;
+	TMap<FString, TArray<int32>> ChunkCurves;
+	for (int32 i = 0; i < Report.Points.Num(); ++i)
+	{
+		const FFluidScalingPoint& Point = Report.Points[i];
+		ThreadCurves.FindOrAdd(FString::Printf(TEXT("%s size %d, %d chunks"), *Point.Fill.GetName(), Point.ChunkSize, Point.GetChunkCount())).Add(i);
+		ChunkCurves.FindOrAdd(FString::Printf(TEXT("%s size %d, %d threads"), *Point.Fill.GetName(), Point.ChunkSize, Point.Threads)).Add(i);
+	}
+
+	for (TPair<FString, TArray<int32>>& Curve : ThreadCurves)
+	{
+		Curve.Value.Sort([&Report](int32 A, int32 B) { return Report.Points[A].Threads < Report.Points[B].Threads; });
+
+		const FFluidScalingPoint& Base = Report.Points[Curve.Value[0]];
+		const double BaseMs = Base.GetSimulationMs();
+		int32 KneeIndex = INDEX_NONE;
+		for (int32 Index : Curve.Value)
+		{
+			FFluidScalingPoint& Point = Report.Points[Index];
+			const double PointMs = Point.GetSimulationMs();
+			Point.Speedup = PointMs > 0.0 ? BaseMs / PointMs : 1.0;
+			Point.Efficiency = Point.Speedup * Base.Threads / FMath::Max(1, Point.Threads);
+			if (KneeIndex == INDEX_NONE && Point.Efficiency < Settings.EfficiencyKnee)
+			{
+				KneeIndex = Index;
+			}
+		}
+
+		// Amdahl: the serial phases of the slowest run bound the speedup any thread count can reach
+		const double SerialShare = Base.GetSerialShare();
+		const FString Limit = SerialShare > 0.0 ? FString::Printf(TEXT("%.1fx"), 1.0 / SerialShare) : FString(TEXT("none"));
+		if (KneeIndex != INDEX_NONE)
+		{
+			const FFluidScalingPoint& Knee = Report.Points[KneeIndex];
+			Report.Knees.Add(FString::Printf(TEXT("%s: efficiency %.0f%% at %d threads (%.2fx); serial share %.0f%%, speedup limit %s"),
+				*Curve.Key, Knee.Efficiency * 100.0, Knee.Threads, Knee.Speedup, SerialShare * 100.0, *Limit));
+		}
+		else if (Curve.Value.Num() > 1)
+		{
+			const FFluidScalingPoint& Last = Report.Points[Curve.Value.Last()];
+			Report.Knees.Add(FString::Printf(TEXT("%s: scales to %d threads (%.2fx, efficiency %.0f%%); serial share %.0f%%, speedup limit %s"),
+				*Curve.Key, Last.Threads, Last.Speedup, Last.Efficiency * 100.0, SerialShare * 100.0, *Limit));
+		}
+	}
+
+	for (TPair<FString, TArray<int32>>& Curve : ChunkCurves)
+	{
+		Curve.Value.Sort([&Report](int32 A, int32 B) { return Report.Points[A].ChunksPerSide < Report.Points[B].ChunksPerSide; });
+
+		int32 BorderKnee = INDEX_NONE;
+		int32 SerialKnee = INDEX_NONE;
+		int32 LastInBudget = INDEX_NONE;
+		for (int32 Index : Curve.Value)
+		{
+			const FFluidScalingPoint& Point = Report.Points[Index];
+			if (BorderKnee == INDEX_NONE && Point.BorderSyncMs >= Point.ChunkUpdateMs)
+			{
+				BorderKnee = Index;
+			}
+			if (SerialKnee == INDEX_NONE && Point.GetSerialShare() > 0.5)
+			{
+				SerialKnee = Index;
+			}
+			if (Point.GetSimulationMs() <= Settings.StepBudgetMs)
+			{
+				LastInBudget = Index;
+			}
+		}
+
+		if (BorderKnee != INDEX_NONE)
+		{
+			const FFluidScalingPoint& Knee = Report.Points[BorderKnee];
+			Report.Knees.Add(FString::Printf(TEXT("%s: border sync outgrows the chunk update from %d chunks (%.3fms vs %.3fms)"),
+				*Curve.Key, Knee.GetChunkCount(), Knee.BorderSyncMs, Knee.ChunkUpdateMs));
+		}
+		if (SerialKnee != INDEX_NONE)
+		{
+			const FFluidScalingPoint& Knee = Report.Points[SerialKnee];
+			Report.Knees.Add(FString::Printf(TEXT("%s: serial phases take %.0f%% of the step from %d chunks"),
+				*Curve.Key, Knee.GetSerialShare() * 100.0, Knee.GetChunkCount()));
+		}
+
+		// Past the largest measured count, extrapolate from its cost per chunk, which only grows with count
+		const FFluidScalingPoint& Largest = Report.Points[Curve.Value.Last()];
+		if (LastInBudget == INDEX_NONE)
+		{
+			Report.Recommendations.Add(FString::Printf(TEXT("%s: none, %d chunks already take %.3fms of the %.1fms budget"),
+				*Curve.Key, Report.Points[Curve.Value[0]].GetChunkCount(), Report.Points[Curve.Value[0]].GetSimulationMs(), Settings.StepBudgetMs));
+		}
+		else if (LastInBudget == Curve.Value.Last() && Largest.GetSimulationMs() > 0.0)
+		{
+			const int32 Estimate = FMath::FloorToInt(Settings.StepBudgetMs / (Largest.GetSimulationMs() / Largest.GetChunkCount()));
+			Report.Recommendations.Add(FString::Printf(TEXT("%s: at most ~%d (measured up to %d at %.3fms)"),
+				*Curve.Key, Estimate, Largest.GetChunkCount(), Largest.GetSimulationMs()));
+		}
+		else
+		{
+			const FFluidScalingPoint& Point = Report.Points[LastInBudget];
+			Report.Recommendations.Add(FString::Printf(TEXT("%s: %d (%.3fms of the %.1fms budget)"),
+				*Curve.Key, Point.GetChunkCount(), Point.GetSimulationMs(), Settings.StepBudgetMs));
+		}
+	}
+}
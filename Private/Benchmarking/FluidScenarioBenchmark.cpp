@@ -0,0 +1,605 @@
+#include "Benchmarking/FluidScenarioBenchmark.h"
+#include "CellularAutomata/FluidChunkManager.h"
+#include "CellularAutomata/FluidBulkEdit.h"
+#include "VoxelFluidMemory.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+
+double FFluidBenchmarkPhase::GetTotal() const
+{
+	double Total = 0.0;
+	for (double Sample : SamplesMs)
+	{
+		Total += Sample;
+	}
+	return Total;
+}
+
+double FFluidBenchmarkPhase::GetMean() const
+{
+	return SamplesMs.Num() > 0 ? GetTotal() / SamplesMs.Num() : 0.0;
+}
+
+double FFluidBenchmarkPhase::GetMin() const
+{
+	return SamplesMs.Num() > 0 ? FMath::Min(SamplesMs) : 0.0;
+}
+
+double FFluidBenchmarkPhase::GetMax() const
+{
+	return SamplesMs.Num() > 0 ? FMath::Max(SamplesMs) : 0.0;
+}
+
+double FFluidBenchmarkPhase::GetPercentile(double Percentile) const
+{
+	if (SamplesMs.Num() == 0)
+		return 0.0;
+
+	TArray<double> Sorted = SamplesMs;
+	Sorted.Sort();
+	const int32 Rank = FMath::CeilToInt(FMath::Clamp(Percentile, 0.0, 100.0) / 100.0 * Sorted.Num());
+	return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+}
+
+const FFluidBenchmarkPhase* FFluidScenarioResult::FindPhase(const FString& PhaseName) const
+{
+	return Phases.FindByPredicate([&PhaseName](const FFluidBenchmarkPhase& Phase) { return Phase.Name == PhaseName; });
+}
+
+FString FFluidScenarioResult::ToString() const
+{
+	FString Result = FString::Printf(
+		TEXT("%s (%d steps):\n")
+		TEXT("  Step: %.3fms (min: %.3fms, max: %.3fms)\n")
+		TEXT("  Setup: %.2fms, Edits: %.2fms, Streaming: %.2fms\n")
+		TEXT("  Gather: %.2fms, Chunk Update: %.2fms, Border: %.2fms, Finalize: %.2fms\n")
+		TEXT("  Chunks: %d loaded, %d active (peak), %lld chunk steps\n")
+		TEXT("  Volume: +%.1f -%.1f (discarded %.1f), final %.1f in %d cells, mass error %.4f%%\n")
+		TEXT("  Memory: %.1f MB peak"),
+		*ScenarioName, StepCount,
+		MeanStepMs, MinStepMs, MaxStepMs,
+		SetupMs, EditMs, StreamingMs,
+		GatherMs, ChunkUpdateMs, BorderSyncMs, FinalizeMs,
+		PeakLoadedChunks, PeakActiveChunks, ChunkSteps,
+		VolumeAdded, VolumeRemoved, VolumeDiscarded, FinalVolume, FinalActiveCells, GetRelativeMassError() * 100.0f,
+		PeakChunkMemoryMB
+	);
+
+	if (MassAudit.Step > 0)
+	{
+		Result += TEXT("\n  Mass ledger: ") + MassAudit.ToString().Replace(TEXT("\n"), TEXT("\n  "));
+	}
+
+	if (SteadyStateAllocSteps > 0)
+	{
+		Result += FString::Printf(TEXT("\n  Steady-state allocations over %d steps: %.1f per step (max %lld, %.1f KB)%s%s"),
+			SteadyStateAllocSteps, SteadyStateMeanAllocsPerStep, SteadyStateMaxAllocsPerStep, SteadyStateBytesPerStep / 1024.0,
+			AllocationHotspot.IsEmpty() ? TEXT("") : TEXT(", mostly in "), *AllocationHotspot);
+	}
+	return Result;
+}
+
+FString FFluidScenarioResult::GetCSVHeader()
+{
+	return TEXT("Scenario,Steps,MeanStepMs,MinStepMs,MaxStepMs,SetupMs,EditMs,StreamingMs,GatherMs,ChunkUpdateMs,BorderSyncMs,FinalizeMs,")
+		TEXT("PeakLoadedChunks,PeakActiveChunks,ChunkSteps,VolumeAdded,VolumeRemoved,VolumeDiscarded,FinalVolume,FinalActiveCells,PeakChunkMemoryMB");
+}
+
+FString FFluidScenarioResult::ToCSVRow() const
+{
+	return FString::Printf(TEXT("%s,%d,%.4f,%.4f,%.4f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%d,%d,%lld,%.3f,%.3f,%.3f,%.3f,%d,%.2f"),
+		*ScenarioName, StepCount, MeanStepMs, MinStepMs, MaxStepMs,
+		SetupMs, EditMs, StreamingMs, GatherMs, ChunkUpdateMs, BorderSyncMs, FinalizeMs,
+		PeakLoadedChunks, PeakActiveChunks, ChunkSteps, VolumeAdded, VolumeRemoved, VolumeDiscarded, FinalVolume, FinalActiveCells,
+		PeakChunkMemoryMB);
+}
+
+FFluidScenarioBenchmark::FFluidScenarioBenchmark(const FFluidScenarioSettings& InSettings)
+	: Settings(InSettings)
+	, Random(InSettings.Seed)
+{
+	Settings.StepCount = FMath::Max(1, Settings.StepCount);
+	Settings.ChunkSize = FMath::Max(4, Settings.ChunkSize);
+	Settings.ChunksPerSide = FMath::Max(1, Settings.ChunksPerSide);
+	Settings.StepDeltaTime = FMath::Max(0.001f, Settings.StepDeltaTime);
+}
+
+FFluidScenarioBenchmark::~FFluidScenarioBenchmark()
+{
+	if (ChunkManager.IsValid())
+	{
+		ChunkManager->OnChunkLoadedDelegate.Remove(ChunkLoadedHandle);
+		ChunkManager->ClearAllChunks();
+	}
+}
+
+FFluidScenarioResult FFluidScenarioBenchmark::RunScenario(const FFluidScenarioSettings& Settings)
+{
+	FFluidScenarioBenchmark Benchmark(Settings);
+	return Benchmark.Run();
+}
+
+FString FFluidScenarioBenchmark::GetScenarioName(EFluidBenchmarkScenario Scenario)
+{
+	switch (Scenario)
+	{
+	case EFluidBenchmarkScenario::DamBreak: return TEXT("DamBreak");
+	case EFluidBenchmarkScenario::RiverChannel: return TEXT("RiverChannel");
+	case EFluidBenchmarkScenario::LakeFill: return TEXT("LakeFill");
+	case EFluidBenchmarkScenario::RainOverTerrain: return TEXT("RainOverTerrain");
+	case EFluidBenchmarkScenario::StreamingFlythrough: return TEXT("StreamingFlythrough");
+	case EFluidBenchmarkScenario::Pool: return TEXT("Pool");
+	default: return TEXT("Unknown");
+	}
+}
+
+bool FFluidScenarioBenchmark::ParseScenarioName(const FString& Name, EFluidBenchmarkScenario& OutScenario)
+{
+	for (EFluidBenchmarkScenario Scenario : GetAllScenarios())
+	{
+		if (Name.Equals(GetScenarioName(Scenario), ESearchCase::IgnoreCase))
+		{
+			OutScenario = Scenario;
+			return true;
+		}
+	}
+	return false;
+}
+
+FString FFluidScenarioBenchmark::GetConfigurationHash(const FFluidScenarioSettings& Settings)
+{
+	uint32 Hash = GetTypeHash(ScenarioVersion);
+	Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Settings.Scenario)));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.StepCount));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.StepDeltaTime));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.Seed));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.ChunkSize));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.CellSize));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.ChunksPerSide));
+	Hash = HashCombine(Hash, GetTypeHash(Settings.FlythroughChunksPerSecond));
+
+	// Only hashed where they apply, so existing baselines keep matching
+	if (Settings.Scenario == EFluidBenchmarkScenario::Pool)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Settings.FillFraction));
+	}
+	if (Settings.SimulationThreads > 0)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Settings.SimulationThreads));
+	}
+	return FString::Printf(TEXT("%08x"), Hash);
+}
+
+TArray<EFluidBenchmarkScenario> FFluidScenarioBenchmark::GetAllScenarios()
+{
+	return {
+		EFluidBenchmarkScenario::DamBreak,
+		EFluidBenchmarkScenario::RiverChannel,
+		EFluidBenchmarkScenario::LakeFill,
+		EFluidBenchmarkScenario::RainOverTerrain,
+		EFluidBenchmarkScenario::StreamingFlythrough,
+		EFluidBenchmarkScenario::Pool
+	};
+}
+
+FFluidScenarioResult FFluidScenarioBenchmark::Run()
+{
+	FFluidScenarioResult Result;
+	Result.ScenarioName = GetScenarioName(Settings.Scenario);
+	Result.StepCount = Settings.StepCount;
+	Result.ConfigurationHash = GetConfigurationHash(Settings);
+
+	enum EPhase { Step, Edit, Streaming, Gather, ChunkUpdate, BorderSync, Finalize, PhaseCount };
+	const TCHAR* PhaseNames[PhaseCount] = { TEXT("Step"), TEXT("Edit"), TEXT("Streaming"), TEXT("Gather"), TEXT("ChunkUpdate"), TEXT("BorderSync"), TEXT("Finalize") };
+	for (int32 Phase = 0; Phase < PhaseCount; ++Phase)
+	{
+		Result.Phases.Emplace(PhaseNames[Phase]);
+		Result.Phases.Last().SamplesMs.Reserve(Settings.StepCount);
+	}
+
+	const double SetupStart = FPlatformTime::Seconds();
+	SetupWorld();
+	{
+		FFluidBulkEdit InitialEdit(*ChunkManager);
+		ApplyInitialFluid(InitialEdit);
+		if (!InitialEdit.IsEmpty())
+		{
+			Result.VolumeAdded += ChunkManager->ApplyBulkEdit(InitialEdit).VolumeAdded;
+		}
+	}
+	Result.SetupMs = (FPlatformTime::Seconds() - SetupStart) * 1000.0;
+
+	// The first audit baselines on the seeded world
+	FFluidMassLedger& MassLedger = ChunkManager->GetMassLedger();
+	MassLedger.SetAuditInterval(Settings.MassAuditInterval);
+
+	const bool bStreaming = Settings.Scenario == EFluidBenchmarkScenario::StreamingFlythrough;
+	FFluidBulkEdit StepEdit(*ChunkManager);
+	TArray<FVector> ViewerPositions;
+
+	if (Settings.bTrackAllocations)
+	{
+		FFluidAllocationTracker::SetEnabled(true);
+		FFluidAllocationTracker::Reset();
+	}
+	const int32 SteadyStateStart = Settings.StepCount - FMath::Max(1, Settings.StepCount / 4);
+	int64 SteadyStateAllocs = 0;
+	int64 SteadyStateBytes = 0;
+	TMap<FString, int64> SteadyStateSites;
+
+	for (int32 StepIndex = 0; StepIndex < Settings.StepCount; ++StepIndex)
+	{
+		FFluidAllocationTracker::BeginStep();
+
+		const double EditStart = FPlatformTime::Seconds();
+		StepEdit.Reset();
+		ApplyStepEdits(StepIndex, StepEdit);
+		if (!StepEdit.IsEmpty())
+		{
+			const FFluidBulkEditResult EditResult = ChunkManager->ApplyBulkEdit(StepEdit);
+			Result.VolumeAdded += EditResult.VolumeAdded;
+			Result.VolumeRemoved += EditResult.VolumeRemoved;
+		}
+		const double EditMs = (FPlatformTime::Seconds() - EditStart) * 1000.0;
+
+		// Volume probes sit outside the timed regions
+		double StreamingMs = 0.0;
+		if (bStreaming)
+		{
+			const float VolumeBefore = GetLoadedVolume();
+			const float StreamedBefore = StreamedVolume;
+
+			ViewerPositions.Reset();
+			ViewerPositions.Add(GetViewerPosition(StepIndex));
+			const double StreamingStart = FPlatformTime::Seconds();
+			ChunkManager->UpdateChunks(Settings.StepDeltaTime, ViewerPositions);
+			StreamingMs = (FPlatformTime::Seconds() - StreamingStart) * 1000.0;
+
+			// Whatever the new lakes don't account for left with unloaded chunks
+			Result.VolumeDiscarded += FMath::Max(0.0f, VolumeBefore + (StreamedVolume - StreamedBefore) - GetLoadedVolume());
+		}
+
+		const double SimulationStart = FPlatformTime::Seconds();
+		ChunkManager->UpdateSimulation(Settings.StepDeltaTime);
+		const double SimulationMs = (FPlatformTime::Seconds() - SimulationStart) * 1000.0;
+
+		const FFluidAllocationReport StepAllocations = FFluidAllocationTracker::EndStep();
+		if (Settings.bTrackAllocations && StepIndex >= SteadyStateStart && StepEdit.IsEmpty() && !bStreaming)
+		{
+			++Result.SteadyStateAllocSteps;
+			Result.SteadyStateMaxAllocsPerStep = FMath::Max(Result.SteadyStateMaxAllocsPerStep, StepAllocations.Allocs);
+			SteadyStateAllocs += StepAllocations.Allocs;
+			SteadyStateBytes += StepAllocations.Bytes;
+			for (const FFluidAllocationSite& Site : StepAllocations.Sites)
+			{
+				SteadyStateSites.FindOrAdd(Site.Site) += Site.Allocs;
+			}
+		}
+
+		const FFluidStepTimings& Timings = ChunkManager->GetLastStepTimings();
+		Result.Phases[Step].SamplesMs.Add(EditMs + StreamingMs + SimulationMs);
+		Result.Phases[Edit].SamplesMs.Add(EditMs);
+		Result.Phases[Streaming].SamplesMs.Add(StreamingMs);
+		Result.Phases[Gather].SamplesMs.Add(Timings.GatherMs);
+		Result.Phases[ChunkUpdate].SamplesMs.Add(Timings.ChunkUpdateMs);
+		Result.Phases[BorderSync].SamplesMs.Add(Timings.BorderSyncMs);
+		Result.Phases[Finalize].SamplesMs.Add(Timings.FinalizeMs);
+		Result.ChunkSteps += Timings.ChunksSimulated;
+
+		Result.PeakLoadedChunks = FMath::Max(Result.PeakLoadedChunks, ChunkManager->GetLoadedChunkCount());
+		Result.PeakActiveChunks = FMath::Max(Result.PeakActiveChunks, ChunkManager->GetActiveChunkCount());
+		Result.PeakChunkMemoryMB = FMath::Max(Result.PeakChunkMemoryMB, GetLoadedChunkMemoryMB());
+
+		const int32 StepsDone = StepIndex + 1;
+		if (Settings.FingerprintInterval > 0 && (StepsDone % Settings.FingerprintInterval == 0 || StepsDone == Settings.StepCount))
+		{
+			Result.Fingerprints.Add(FFluidStateFingerprint::Capture(*ChunkManager, StepsDone));
+		}
+	}
+
+	Result.EditMs = Result.Phases[Edit].GetTotal();
+	Result.StreamingMs = Result.Phases[Streaming].GetTotal();
+	Result.GatherMs = Result.Phases[Gather].GetTotal();
+	Result.ChunkUpdateMs = Result.Phases[ChunkUpdate].GetTotal();
+	Result.BorderSyncMs = Result.Phases[BorderSync].GetTotal();
+	Result.FinalizeMs = Result.Phases[Finalize].GetTotal();
+	Result.MeanStepMs = Result.Phases[Step].GetMean();
+	Result.MinStepMs = Result.Phases[Step].GetMin();
+	Result.MaxStepMs = Result.Phases[Step].GetMax();
+
+	if (Settings.bTrackAllocations && Result.SteadyStateAllocSteps > 0)
+	{
+		Result.SteadyStateMeanAllocsPerStep = (double)SteadyStateAllocs / Result.SteadyStateAllocSteps;
+		Result.SteadyStateBytesPerStep = SteadyStateBytes / Result.SteadyStateAllocSteps;
+
+		int64 HotspotAllocs = 0;
+		for (const TPair<FString, int64>& Site : SteadyStateSites)
+		{
+			if (Site.Value > HotspotAllocs)
+			{
+				HotspotAllocs = Site.Value;
+				Result.AllocationHotspot = Site.Key;
+			}
+		}
+	}
+	if (Settings.bTrackAllocations)
+	{
+		FFluidAllocationTracker::SetEnabled(false);
+	}
+
+	// Flythrough lakes are created as chunks stream in
+	Result.VolumeAdded += StreamedVolume;
+
+	if (MassLedger.IsEnabled())
+	{
+		MassLedger.Audit(ChunkManager->GetLoadedChunks());
+		Result.MassAudit = MassLedger.GetLastAudit();
+		Result.WorstDriftChunks = MassLedger.GetWorstChunks(5);
+	}
+
+	const FChunkManagerStats Stats = ChunkManager->GetStats();
+	Result.FinalVolume = Stats.TotalFluidVolume;
+	Result.FinalActiveCells = Stats.TotalActiveCells;
+
+	return Result;
+}
+
+void FFluidScenarioBenchmark::SetupWorld()
+{
+	ChunkManager.Reset(NewObject<UFluidChunkManager>(GetTransientPackage()));
+
+	const float ChunkWorldSize = GetChunkWorldSize();
+	const bool bStreaming = Settings.Scenario == EFluidBenchmarkScenario::StreamingFlythrough;
+
+	// The flythrough travels along +X; size the world to cover the whole path
+	const float PathLength = bStreaming ? Settings.FlythroughChunksPerSecond * ChunkWorldSize * Settings.StepCount * Settings.StepDeltaTime : 0.0f;
+	const FVector WorldSize(GetAreaSize() + PathLength, GetAreaSize(), ChunkWorldSize);
+	ChunkManager->Initialize(Settings.ChunkSize, Settings.CellSize, FVector::ZeroVector, WorldSize);
+
+	// Distance-based activation with no persistence: nothing depends on wall-clock settle timers or the disk cache
+	FChunkStreamingConfig Config = ChunkManager->GetStreamingConfig();
+	Config.ActivationMode = EChunkActivationMode::DistanceBased;
+	Config.bEnablePersistence = false;
+	Config.ChunkUpdateInterval = Settings.StepDeltaTime;
+	if (bStreaming)
+	{
+		Config.ActiveDistance = ChunkWorldSize * Settings.ChunksPerSide * 0.5f;
+		Config.LoadDistance = Config.ActiveDistance + ChunkWorldSize;
+		Config.UnloadDistance = Config.LoadDistance + ChunkWorldSize;
+	}
+	ChunkManager->SetStreamingConfig(Config);
+	ChunkManager->SetMaxSimulationThreads(Settings.SimulationThreads);
+
+	ChunkLoadedHandle = ChunkManager->OnChunkLoadedDelegate.AddRaw(this, &FFluidScenarioBenchmark::OnChunkLoaded);
+
+	// Fixed scenarios simulate one layer of chunks covering the whole area, all active for the entire run
+	if (!bStreaming)
+	{
+		TArray<FFluidChunkCoord> Coords;
+		Coords.Reserve(Settings.ChunksPerSide * Settings.ChunksPerSide);
+		for (int32 Y = 0; Y < Settings.ChunksPerSide; ++Y)
+		{
+			for (int32 X = 0; X < Settings.ChunksPerSide; ++X)
+			{
+				Coords.Add(FFluidChunkCoord(X, Y, 0));
+			}
+		}
+		ChunkManager->PrepareChunksForBulkFill(Coords);
+	}
+}
+
+void FFluidScenarioBenchmark::OnChunkLoaded(const FFluidChunkCoord& Coord)
+{
+	UFluidChunk* Chunk = ChunkManager->GetChunk(Coord);
+	if (!Chunk)
+		return;
+
+	const int32 ChunkSize = Settings.ChunkSize;
+	const float CellSize = Settings.CellSize;
+	const FVector ChunkOrigin = ChunkManager->GetChunkWorldPosition(Coord);
+
+	// Flythrough terrain carries lakes up to a fixed water table so every streamed chunk has work to do
+	const bool bFillLakes = Settings.Scenario == EFluidBenchmarkScenario::StreamingFlythrough;
+	const float WaterTable = GetChunkWorldSize() * 0.3f;
+	TArray<FFluidColumnSpan> Spans;
+	if (bFillLakes)
+	{
+		Spans.SetNum(ChunkSize * ChunkSize);
+	}
+
+	bool bHasLake = false;
+	for (int32 Y = 0; Y < ChunkSize; ++Y)
+	{
+		for (int32 X = 0; X < ChunkSize; ++X)
+		{
+			const float Height = GetTerrainHeight(ChunkOrigin.X + (X + 0.5f) * CellSize, ChunkOrigin.Y + (Y + 0.5f) * CellSize);
+			Chunk->SetTerrainHeight(X, Y, Height);
+
+			if (bFillLakes && Height < WaterTable)
+			{
+				Spans[X + Y * ChunkSize].SurfaceZ = WaterTable;
+				bHasLake = true;
+			}
+		}
+	}
+
+	if (bHasLake)
+	{
+		StreamedVolume += Chunk->FillColumnsFromSpans(Spans);
+	}
+}
+
+void FFluidScenarioBenchmark::ApplyInitialFluid(FFluidBulkEdit& Edit)
+{
+	const float AreaSize = GetAreaSize();
+	const float CellSize = Settings.CellSize;
+
+	if (Settings.Scenario == EFluidBenchmarkScenario::DamBreak)
+	{
+		// Water column held against the -X wall, released at step 0
+		const FBox Column(FVector(CellSize, CellSize, CellSize), FVector(AreaSize * 0.3f, AreaSize - CellSize, GetChunkWorldSize() * 0.75f));
+		Edit.AddBox(Column, 1.0f);
+	}
+	else if (Settings.Scenario == EFluidBenchmarkScenario::Pool)
+	{
+		// One slab per cell column along X, 1.5x the mean depth at -X down to 0.5x at +X
+		const float OpenHeight = GetChunkWorldSize() - CellSize;
+		const int32 Columns = FMath::Max(1, FMath::RoundToInt(AreaSize / CellSize) - 2);
+		for (int32 i = 0; i < Columns; ++i)
+		{
+			const float X = CellSize * (i + 1);
+			const float Tilt = 1.5f - (i + 0.5f) / Columns;
+			const float Depth = FMath::Min(OpenHeight * Settings.FillFraction * Tilt, OpenHeight);
+			if (Depth > 0.0f)
+			{
+				Edit.AddBox(FBox(FVector(X, CellSize, CellSize), FVector(X + CellSize, AreaSize - CellSize, CellSize + Depth)), 1.0f);
+			}
+		}
+	}
+}
+
+void FFluidScenarioBenchmark::ApplyStepEdits(int32 StepIndex, FFluidBulkEdit& Edit)
+{
+	const float AreaSize = GetAreaSize();
+	const float ChunkWorldSize = GetChunkWorldSize();
+	const float CellSize = Settings.CellSize;
+
+	switch (Settings.Scenario)
+	{
+	case EFluidBenchmarkScenario::RiverChannel:
+	{
+		// Spring at the upstream end, drain across the full width at the downstream end
+		const float SourceX = CellSize * 3.0f;
+		const float SourceY = GetRiverCenterY(SourceX);
+		const FVector Source(SourceX, SourceY, GetTerrainHeight(SourceX, SourceY) + CellSize * 3.0f);
+		Edit.AddSphere(Source, CellSize * 2.5f, 0.5f);
+
+		const FBox Drain(FVector(AreaSize - CellSize * 4.0f, 0.0f, 0.0f), FVector(AreaSize - CellSize, AreaSize, ChunkWorldSize));
+		Edit.AddBox(Drain, 1.0f, EFluidEditOp::Remove);
+		break;
+	}
+	case EFluidBenchmarkScenario::LakeFill:
+	{
+		const FVector Inflow(AreaSize * 0.5f, AreaSize * 0.5f, ChunkWorldSize * 0.7f);
+		Edit.AddSphere(Inflow, CellSize * 2.0f, 1.0f);
+		break;
+	}
+	case EFluidBenchmarkScenario::RainOverTerrain:
+	{
+		// Same drops every run for a given seed
+		const int32 DropsPerStep = Settings.ChunksPerSide * Settings.ChunksPerSide * 4;
+		TArray<FVector> Drops;
+		Drops.Reserve(DropsPerStep);
+		for (int32 i = 0; i < DropsPerStep; ++i)
+		{
+			Drops.Add(FVector(
+				Random.FRandRange(CellSize, AreaSize - CellSize),
+				Random.FRandRange(CellSize, AreaSize - CellSize),
+				ChunkWorldSize * 0.85f));
+		}
+		Edit.AddPoints(Drops, 0.25f);
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+float FFluidScenarioBenchmark::GetTerrainHeight(float WorldX, float WorldY) const
+{
+	const float AreaSize = GetAreaSize();
+	const float ChunkWorldSize = GetChunkWorldSize();
+	const float CellSize = Settings.CellSize;
+
+	// Fixed scenarios are enclosed by a one-cell wall of solid terrain
+	if (Settings.Scenario != EFluidBenchmarkScenario::StreamingFlythrough &&
+		(WorldX < CellSize || WorldY < CellSize || WorldX > AreaSize - CellSize || WorldY > AreaSize - CellSize))
+	{
+		return ChunkWorldSize;
+	}
+
+	switch (Settings.Scenario)
+	{
+	case EFluidBenchmarkScenario::DamBreak:
+	case EFluidBenchmarkScenario::Pool:
+		return CellSize;
+
+	case EFluidBenchmarkScenario::RiverChannel:
+	{
+		// Banks fall along +X; a meandering channel is carved down the middle
+		const float T = WorldX / AreaSize;
+		const float Bank = ChunkWorldSize * (0.55f - 0.3f * T);
+		const float HalfWidth = AreaSize * 0.08f;
+		const float Distance = FMath::Abs(WorldY - GetRiverCenterY(WorldX)) / HalfWidth;
+		const float Carve = Distance < 1.0f ? ChunkWorldSize * 0.2f * (1.0f - Distance * Distance) : 0.0f;
+		return Bank - Carve + GetValueNoise(WorldX, WorldY, CellSize * 6.0f) * CellSize;
+	}
+
+	case EFluidBenchmarkScenario::LakeFill:
+	{
+		const float Radius = FVector2D(WorldX - AreaSize * 0.5f, WorldY - AreaSize * 0.5f).Size() / (AreaSize * 0.5f);
+		return ChunkWorldSize * (0.1f + 0.5f * FMath::Min(Radius * Radius, 1.0f)) + GetValueNoise(WorldX, WorldY, CellSize * 8.0f) * CellSize * 2.0f;
+	}
+
+	case EFluidBenchmarkScenario::RainOverTerrain:
+		return ChunkWorldSize * (0.1f + 0.35f * GetValueNoise(WorldX, WorldY, CellSize * 10.0f) + 0.15f * GetValueNoise(WorldX, WorldY, CellSize * 3.0f));
+
+	case EFluidBenchmarkScenario::StreamingFlythrough:
+		return ChunkWorldSize * (0.1f + 0.4f * GetValueNoise(WorldX, WorldY, ChunkWorldSize * 0.75f) + 0.05f * GetValueNoise(WorldX, WorldY, CellSize * 4.0f));
+
+	default:
+		return 0.0f;
+	}
+}
+
+float FFluidScenarioBenchmark::GetValueNoise(float X, float Y, float Scale) const
+{
+	const float FX = X / Scale;
+	const float FY = Y / Scale;
+	const int32 IX = FMath::FloorToInt(FX);
+	const int32 IY = FMath::FloorToInt(FY);
+	const float TX = FMath::SmoothStep(0.0f, 1.0f, FX - IX);
+	const float TY = FMath::SmoothStep(0.0f, 1.0f, FY - IY);
+
+	// Lattice values depend only on the seed, never on evaluation order
+	const uint32 Seed = static_cast<uint32>(Settings.Seed);
+	auto Lattice = [Seed](int32 LX, int32 LY)
+	{
+		const uint32 Hash = HashCombine(HashCombine(GetTypeHash(LX), GetTypeHash(LY)), Seed);
+		return (Hash & 0xFFFF) / 65535.0f;
+	};
+
+	const float Bottom = FMath::Lerp(Lattice(IX, IY), Lattice(IX + 1, IY), TX);
+	const float Top = FMath::Lerp(Lattice(IX, IY + 1), Lattice(IX + 1, IY + 1), TX);
+	return FMath::Lerp(Bottom, Top, TY);
+}
+
+float FFluidScenarioBenchmark::GetRiverCenterY(float WorldX) const
+{
+	const float AreaSize = GetAreaSize();
+	return AreaSize * (0.5f + 0.15f * FMath::Sin(WorldX / AreaSize * 2.0f * PI));
+}
+
+FVector FFluidScenarioBenchmark::GetViewerPosition(int32 StepIndex) const
+{
+	const float ChunkWorldSize = GetChunkWorldSize();
+	const float Travelled = Settings.FlythroughChunksPerSecond * ChunkWorldSize * StepIndex * Settings.StepDeltaTime;
+	return FVector(ChunkWorldSize * 0.5f + Travelled, GetAreaSize() * 0.5f, ChunkWorldSize * 0.5f);
+}
+
+float FFluidScenarioBenchmark::GetLoadedVolume() const
+{
+	float Volume = 0.0f;
+	for (const UFluidChunk* Chunk : ChunkManager->GetLoadedChunks())
+	{
+		Volume += Chunk ? Chunk->GetTotalFluidVolume() : 0.0f;
+	}
+	return Volume;
+}
+
+float FFluidScenarioBenchmark::GetLoadedChunkMemoryMB() const
+{
+	FFluidMemoryReport Report;
+	ChunkManager->ReportMemory(Report);
+	return Report.GetChunkTotal() / (1024.0f * 1024.0f);
+}
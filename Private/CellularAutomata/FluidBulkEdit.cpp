@@ -0,0 +1,178 @@
+#include "CellularAutomata/FluidBulkEdit.h"
+#include "CellularAutomata/FluidChunkManager.h"
+
+FFluidBulkEdit::FFluidBulkEdit(const UFluidChunkManager& ChunkManager)
+	: ChunkSize(FMath::Max(ChunkManager.ChunkSize, 1))
+	, CellSize(FMath::Max(ChunkManager.CellSize, KINDA_SMALL_NUMBER))
+	, WorldOrigin(ChunkManager.WorldOrigin)
+{
+}
+
+FIntVector FFluidBulkEdit::WorldToCell(const FVector& WorldPosition) const
+{
+	const FVector Local = (WorldPosition - WorldOrigin) / CellSize;
+	return FIntVector(FMath::FloorToInt(Local.X), FMath::FloorToInt(Local.Y), FMath::FloorToInt(Local.Z));
+}
+
+FVector FFluidBulkEdit::GetCellCenter(const FIntVector& Cell) const
+{
+	return WorldOrigin + (FVector(Cell) + FVector(0.5f)) * CellSize;
+}
+
+void FFluidBulkEdit::AddCell(FFluidChunkCellEdits& Edits, const FIntVector& LocalCell, float Value, EFluidEditOp Op)
+{
+	Edits.CellIndices.Add(LocalCell.X + LocalCell.Y * ChunkSize + LocalCell.Z * ChunkSize * ChunkSize);
+	Edits.Values.Add(Value);
+	Edits.Ops.Add(Op);
+	++CellCount;
+}
+
+void FFluidBulkEdit::AddPoint(const FVector& WorldPosition, float Value, EFluidEditOp Op)
+{
+	const FIntVector Cell = WorldToCell(WorldPosition);
+	const FFluidChunkCoord ChunkCoord(FloorDiv(Cell.X, ChunkSize), FloorDiv(Cell.Y, ChunkSize), FloorDiv(Cell.Z, ChunkSize));
+	const FIntVector Local = Cell - FIntVector(ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z) * ChunkSize;
+	AddCell(ChunkEdits.FindOrAdd(ChunkCoord), Local, Value, Op);
+}
+
+void FFluidBulkEdit::AddPoints(const TArray<FVector>& WorldPositions, float Value, EFluidEditOp Op)
+{
+	// Scattered sets (rain) tend to hit the same few chunks, so remember the last one
+	FFluidChunkCoord LastCoord(MAX_int32, MAX_int32, MAX_int32);
+	FFluidChunkCellEdits* LastEdits = nullptr;
+
+	for (const FVector& WorldPosition : WorldPositions)
+	{
+		const FIntVector Cell = WorldToCell(WorldPosition);
+		const FFluidChunkCoord ChunkCoord(FloorDiv(Cell.X, ChunkSize), FloorDiv(Cell.Y, ChunkSize), FloorDiv(Cell.Z, ChunkSize));
+		if (!LastEdits || !(ChunkCoord == LastCoord))
+		{
+			LastEdits = &ChunkEdits.FindOrAdd(ChunkCoord);
+			LastCoord = ChunkCoord;
+		}
+
+		AddCell(*LastEdits, Cell - FIntVector(ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z) * ChunkSize, Value, Op);
+	}
+}
+
+void FFluidBulkEdit::AddPoints(const TArray<FVector>& WorldPositions, const TArray<float>& Values, EFluidEditOp Op)
+{
+	if (WorldPositions.Num() != Values.Num())
+		return;
+
+	for (int32 i = 0; i < WorldPositions.Num(); ++i)
+	{
+		AddPoint(WorldPositions[i], Values[i], Op);
+	}
+}
+
+void FFluidBulkEdit::AddSphere(const FVector& Center, float Radius, float Value, EFluidEditOp Op, bool bFalloff)
+{
+	if (Radius <= 0.0f)
+		return;
+
+	const float RadiusSq = Radius * Radius;
+	const bool bScale = bFalloff && Op != EFluidEditOp::SetLevel;
+
+	AddCellRange(WorldToCell(Center - FVector(Radius)), WorldToCell(Center + FVector(Radius)), Value, Op,
+		[&](const FIntVector&, const FVector& CellCenter)
+		{
+			const float DistSq = FVector::DistSquared(CellCenter, Center);
+			if (DistSq > RadiusSq)
+				return 0.0f;
+			return bScale ? FMath::Max(1.0f - FMath::Sqrt(DistSq) / Radius, KINDA_SMALL_NUMBER) : 1.0f;
+		});
+}
+
+void FFluidBulkEdit::AddBox(const FBox& Box, float Value, EFluidEditOp Op)
+{
+	if (!Box.IsValid)
+		return;
+
+	AddCellRange(WorldToCell(Box.Min), WorldToCell(Box.Max), Value, Op,
+		[&](const FIntVector&, const FVector& CellCenter)
+		{
+			return Box.IsInsideOrOn(CellCenter) ? 1.0f : 0.0f;
+		});
+}
+
+void FFluidBulkEdit::AddHeightfield(const FVector2D& GridOrigin, float GridSpacing, int32 SizeX, int32 SizeY,
+	const TArray<float>& SurfaceHeights, float FloorZ, float Value, EFluidEditOp Op)
+{
+	if (SizeX <= 0 || SizeY <= 0 || GridSpacing <= 0.0f || SurfaceHeights.Num() != SizeX * SizeY)
+		return;
+
+	float MaxSurface = -FLT_MAX;
+	for (const float Height : SurfaceHeights)
+	{
+		MaxSurface = FMath::Max(MaxSurface, Height);
+	}
+	if (MaxSurface <= FloorZ)
+		return;
+
+	const FVector MinCorner(GridOrigin.X, GridOrigin.Y, FloorZ);
+	const FVector MaxCorner(GridOrigin.X + SizeX * GridSpacing, GridOrigin.Y + SizeY * GridSpacing, MaxSurface);
+	const bool bScale = Op != EFluidEditOp::Remove;
+
+	AddCellRange(WorldToCell(MinCorner), WorldToCell(MaxCorner), Value, Op,
+		[&](const FIntVector&, const FVector& CellCenter)
+		{
+			const int32 GX = FMath::FloorToInt((CellCenter.X - GridOrigin.X) / GridSpacing);
+			const int32 GY = FMath::FloorToInt((CellCenter.Y - GridOrigin.Y) / GridSpacing);
+			if (GX < 0 || GY < 0 || GX >= SizeX || GY >= SizeY)
+				return 0.0f;
+
+			const float SurfaceZ = SurfaceHeights[GX + GY * SizeX];
+			const float CellBottom = CellCenter.Z - CellSize * 0.5f;
+			const float WetBottom = FMath::Max(CellBottom, FloorZ);
+			const float WetTop = FMath::Min(CellBottom + CellSize, SurfaceZ);
+			const float WetFraction = FMath::Clamp((WetTop - WetBottom) / CellSize, 0.0f, 1.0f);
+
+			// Remove takes the full Value from every wet cell; Add puts Value times the wet fraction on top of the
+			// current level, and SetLevel sets each cell to exactly that, so only SetLevel fills to the surface
+			if (WetFraction <= 0.0f)
+				return 0.0f;
+			return bScale ? WetFraction : 1.0f;
+		});
+}
+
+void FFluidBulkEdit::AddCellRange(const FIntVector& MinCell, const FIntVector& MaxCell, float Value, EFluidEditOp Op,
+	TFunctionRef<float(const FIntVector& Cell, const FVector& CellCenter)> Weight)
+{
+	const FIntVector MinChunk(FloorDiv(MinCell.X, ChunkSize), FloorDiv(MinCell.Y, ChunkSize), FloorDiv(MinCell.Z, ChunkSize));
+	const FIntVector MaxChunk(FloorDiv(MaxCell.X, ChunkSize), FloorDiv(MaxCell.Y, ChunkSize), FloorDiv(MaxCell.Z, ChunkSize));
+
+	for (int32 CZ = MinChunk.Z; CZ <= MaxChunk.Z; ++CZ)
+	{
+		for (int32 CY = MinChunk.Y; CY <= MaxChunk.Y; ++CY)
+		{
+			for (int32 CX = MinChunk.X; CX <= MaxChunk.X; ++CX)
+			{
+				const FIntVector ChunkBase = FIntVector(CX, CY, CZ) * ChunkSize;
+				const FIntVector Lo(FMath::Max(MinCell.X, ChunkBase.X), FMath::Max(MinCell.Y, ChunkBase.Y), FMath::Max(MinCell.Z, ChunkBase.Z));
+				const FIntVector Hi(FMath::Min(MaxCell.X, ChunkBase.X + ChunkSize - 1), FMath::Min(MaxCell.Y, ChunkBase.Y + ChunkSize - 1), FMath::Min(MaxCell.Z, ChunkBase.Z + ChunkSize - 1));
+
+				FFluidChunkCellEdits* Edits = nullptr;
+				for (int32 Z = Lo.Z; Z <= Hi.Z; ++Z)
+				{
+					for (int32 Y = Lo.Y; Y <= Hi.Y; ++Y)
+					{
+						for (int32 X = Lo.X; X <= Hi.X; ++X)
+						{
+							const FIntVector Cell(X, Y, Z);
+							const float CellWeight = Weight(Cell, GetCellCenter(Cell));
+							if (CellWeight <= 0.0f)
+								continue;
+
+							if (!Edits)
+							{
+								Edits = &ChunkEdits.FindOrAdd(FFluidChunkCoord(CX, CY, CZ));
+							}
+							AddCell(*Edits, Cell - ChunkBase, Value * CellWeight, Op);
+						}
+					}
+				}
+			}
+		}
+	}
+}
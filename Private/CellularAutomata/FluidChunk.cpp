@@ -1,5 +1,6 @@
 #include "CellularAutomata/FluidChunk.h"
 #include "VoxelFluidStats.h"
+#include "VoxelFluidMemory.h"
 #include "Math/UnrealMathUtility.h"
 #include "HAL/UnrealMemory.h"
 
@@ -115,6 +116,7 @@ void UFluidChunk::UpdateSimulation(float DeltaTime)
 		return;
 	
 	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_UpdateSimulation);
+	VOXELFLUID_ALLOC_SCOPE("ChunkUpdate");
 	
 	// CRITICAL: First remove any water from solid cells (terrain)
 	// This prevents water from existing inside terrain
@@ -137,6 +139,7 @@ void UFluidChunk::UpdateSimulation(float DeltaTime)
 				
 			}
 			
+			MassFlows.Add(EFluidMassCategory::Terrain, -Cells[i].FluidLevel);
 			Cells[i].FluidLevel = 0.0f;
 			Cells[i].bSettled = false;
 			Cells[i].bSourceBlock = false;
@@ -153,13 +156,13 @@ void UFluidChunk::UpdateSimulation(float DeltaTime)
 	// Smart optimization: If chunk has been fully settled for a while, reduce update frequency
 	if (bFullySettled && TotalFluidActivity < 0.001f)
 	{
-		static float SkipTimer = 0.0f;
-		SkipTimer += DeltaTime;
-		if (SkipTimer < 0.1f) // Only update every 100ms for settled chunks
+		SettledSkipTimer += DeltaTime;
+		if (SettledSkipTimer < 0.1f) // Only update every 100ms for settled chunks
 		{
+			Activity.CellsProcessed = 0;
 			return;
 		}
-		SkipTimer = 0.0f;
+		SettledSkipTimer = 0.0f;
 		DeltaTime *= 0.5f; // Use slower timestep for settled chunks
 	}
 	
@@ -170,7 +173,11 @@ void UFluidChunk::UpdateSimulation(float DeltaTime)
 	if (bUseSparseRepresentation)
 	{
 		if (SparseCells.Num() == 0)
+		{
+			Activity = FFluidChunkActivity();
+			Activity.bValid = true;
 			return;
+		}
 	}
 	else
 	{
@@ -181,6 +188,8 @@ void UFluidChunk::UpdateSimulation(float DeltaTime)
 	// Track total fluid change for mesh update decision
 	float TotalFluidChange = 0.0f;
 	
+	FlowField.BeginStep(ChunkSize, DeltaTime);
+	
 	if (bUseSparseRepresentation)
 	{
 		// Sparse path: only update cells with fluid
@@ -201,12 +210,19 @@ void UFluidChunk::UpdateSimulation(float DeltaTime)
 	}
 	
 	// Simplified simulation without settling-related functions
-	if (CurrentLOD == 0)
+	const bool bCoarseStep = CurrentLOD > 0 && SimulateCoarse(DeltaTime);
+	if (bCoarseStep)
+	{
+		// Downsampled solve at the full timestep; evaporation stays per cell
+		ApplyEvaporation(DeltaTime);
+	}
+	else if (CurrentLOD == 0)
 	{
 		// Full quality simulation
 		ApplyGravity(DeltaTime);
 		ApplyFlowRules(DeltaTime);
 		ApplyPressure(DeltaTime);
+		ApplyColumnPressure();
 		ApplyEvaporation(DeltaTime);
 	}
 	else if (CurrentLOD == 1)
@@ -233,8 +249,14 @@ void UFluidChunk::UpdateSimulation(float DeltaTime)
 	// Calculate total change and activity metrics
 	int32 SettledCount = 0;
 	int32 FluidCellCount = 0;
+	int32 UnsettledCount = 0;
+	float NetFluidChange = 0.0f;
+	float FluidVolume = 0.0f;
 	TotalFluidActivity = 0.0f;
 	
+	// The settle rate is per second so region tests read the same whatever the step length
+	const float UnsettledChange = SettleChangeRate * DeltaTime;
+	
 	if (bUseSparseRepresentation)
 	{
 		// Sparse mode: iterate through sparse cells
@@ -247,13 +269,21 @@ void UFluidChunk::UpdateSimulation(float DeltaTime)
 				LastLevel = LastCell->LastFluidLevel;
 			}
 			
-			const float Change = FMath::Abs(NextCell.FluidLevel - LastLevel);
+			const float SignedChange = NextCell.FluidLevel - LastLevel;
+			const float Change = FMath::Abs(SignedChange);
 			TotalFluidChange += Change;
 			TotalFluidActivity += Change;
+			NetFluidChange += SignedChange;
+			
+			if (Change > UnsettledChange)
+			{
+				UnsettledCount++;
+			}
 			
 			if (NextCell.FluidLevel > MinFluidLevel && !NextCell.bIsSolid)
 			{
 				FluidCellCount++;
+				FluidVolume += NextCell.FluidLevel;
 				if (NextCell.bSettled)
 				{
 					SettledCount++;
@@ -266,13 +296,21 @@ void UFluidChunk::UpdateSimulation(float DeltaTime)
 		// Dense mode: original implementation
 		for (int32 i = 0; i < NextCells.Num(); ++i)
 		{
-			const float Change = FMath::Abs(NextCells[i].FluidLevel - NextCells[i].LastFluidLevel);
+			const float SignedChange = NextCells[i].FluidLevel - NextCells[i].LastFluidLevel;
+			const float Change = FMath::Abs(SignedChange);
 			TotalFluidChange += Change;
 			TotalFluidActivity += Change;
+			NetFluidChange += SignedChange;
+			
+			if (Change > UnsettledChange)
+			{
+				UnsettledCount++;
+			}
 			
 			if (NextCells[i].FluidLevel > MinFluidLevel && !NextCells[i].bIsSolid)
 			{
 				FluidCellCount++;
+				FluidVolume += NextCells[i].FluidLevel;
 				if (NextCells[i].bSettled)
 				{
 					SettledCount++;
@@ -281,6 +319,16 @@ void UFluidChunk::UpdateSimulation(float DeltaTime)
 		}
 	}
 	
+	// Publish the step summary for region-level settle detection
+	const float InvDeltaTime = DeltaTime > KINDA_SMALL_NUMBER ? 1.0f / DeltaTime : 0.0f;
+	Activity.TotalVolume = FluidVolume;
+	Activity.NetFlux = NetFluidChange * InvDeltaTime;
+	Activity.AbsoluteFlux = TotalFluidActivity * InvDeltaTime;
+	Activity.FluidCellCount = FluidCellCount;
+	Activity.UnsettledCellCount = UnsettledCount;
+	Activity.CellsProcessed = bUseSparseRepresentation ? SparseNextCells.Num() : (bCoarseStep ? CoarseGrid->Cells.Num() : NextCells.Num());
+	Activity.bValid = true;
+	
 	// Update activity tracking
 	if (TotalFluidActivity < 0.0001f)
 	{
@@ -323,6 +371,8 @@ void UFluidChunk::UpdateSimulation(float DeltaTime)
 
 void UFluidChunk::FinalizeSimulationStep()
 {
+	VOXELFLUID_ALLOC_SCOPE("ChunkFinalize");
+
 	// Swap buffers after border synchronization
 	if (bUseSparseRepresentation)
 	{
@@ -343,6 +393,8 @@ void UFluidChunk::FinalizeSimulationStep()
 		// Dense mode: swap dense buffers
 		Cells = NextCells;
 	}
+	
+	ResolveFlowField();
 }
 
 void UFluidChunk::ActivateChunk()
@@ -403,31 +455,214 @@ void UFluidChunk::UnloadChunk()
 	Cells.Empty();
 	NextCells.Empty();
 	ActiveNeighbors.Empty();
+	FlowField.Reset();
 	
 	State = EChunkState::Unloaded;
 }
 
 void UFluidChunk::AddFluid(int32 LocalX, int32 LocalY, int32 LocalZ, float Amount)
 {
+	// Edits go to the dense buffers; a sparse chunk would drop them at its next step
+	if (bUseSparseRepresentation)
+	{
+		ConvertToDense();
+	}
+
 	const int32 Idx = GetLocalCellIndex(LocalX, LocalY, LocalZ);
 	if (Idx >= 0 && Idx < Cells.Num() && !Cells[Idx].bIsSolid)
 	{
 		const float OldLevel = Cells[Idx].FluidLevel;
 		Cells[Idx].FluidLevel = FMath::Min(Cells[Idx].FluidLevel + Amount, MaxFluidLevel);
 		const float Change = FMath::Abs(Cells[Idx].FluidLevel - OldLevel);
+		MassFlows.Add(EFluidMassCategory::Edit, Cells[Idx].FluidLevel - OldLevel);
 		bDirty = true;
 		ConsiderMeshUpdate(Change); // Only mark dirty if change is significant
 	}
 }
 
+float UFluidChunk::FillColumnsFromSpans(const TArray<FFluidColumnSpan>& Spans)
+{
+	const int32 ColumnCount = ChunkSize * ChunkSize;
+	if (Spans.Num() != ColumnCount || Cells.Num() == 0)
+		return 0.0f;
+
+	// Column writes go straight into the dense buffers
+	if (bUseSparseRepresentation)
+	{
+		ConvertToDense();
+	}
+
+	const int32 LayerSize = ChunkSize * ChunkSize;
+	float AddedVolume = 0.0f;
+
+	for (int32 ColumnIdx = 0; ColumnIdx < ColumnCount; ++ColumnIdx)
+	{
+		const FFluidColumnSpan& Span = Spans[ColumnIdx];
+		if (!Span.HasWater())
+			continue;
+
+		// Skip layers that sit entirely above the surface or below the floor
+		const float ChunkTop = ChunkWorldPosition.Z + ChunkSize * CellSize;
+		const int32 MinZ = Span.FloorZ > ChunkWorldPosition.Z ?
+			FMath::FloorToInt((FMath::Min(Span.FloorZ, ChunkTop) - ChunkWorldPosition.Z) / CellSize) : 0;
+		const int32 MaxZ = Span.SurfaceZ < ChunkTop ?
+			FMath::FloorToInt((Span.SurfaceZ - ChunkWorldPosition.Z) / CellSize) : ChunkSize - 1;
+
+		for (int32 z = MinZ; z <= MaxZ; ++z)
+		{
+			const int32 Idx = ColumnIdx + z * LayerSize;
+			FCAFluidCell& Cell = Cells[Idx];
+			if (Cell.bIsSolid)
+				continue;
+
+			const float CellBottom = ChunkWorldPosition.Z + z * CellSize;
+
+			// Cells below known terrain stay dry, same rule as static water application
+			if (Cell.TerrainHeight > -10000.0f && CellBottom + CellSize * 0.5f <= Cell.TerrainHeight)
+				continue;
+
+			const float WetBottom = FMath::Max(CellBottom, Span.FloorZ);
+			const float WetTop = FMath::Min(CellBottom + CellSize, Span.SurfaceZ);
+			const float TargetLevel = FMath::Min(FMath::Clamp((WetTop - WetBottom) / CellSize, 0.0f, 1.0f), MaxFluidLevel);
+
+			// Never remove fluid the simulation already placed here
+			if (TargetLevel > Cell.FluidLevel)
+			{
+				AddedVolume += TargetLevel - Cell.FluidLevel;
+				Cell.FluidLevel = TargetLevel;
+				Cell.LastFluidLevel = TargetLevel;
+				Cell.bSettled = false;
+				Cell.SettledCounter = 0;
+				NextCells[Idx] = Cell;
+			}
+		}
+	}
+
+	if (AddedVolume > 0.0f)
+	{
+		MassFlows.Add(EFluidMassCategory::Fill, AddedVolume);
+		bDirty = true;
+		MarkMeshDataDirty();
+	}
+
+	return AddedVolume;
+}
+
+float UFluidChunk::AddFluidToCells(const TArray<int32>& CellIndices, const TArray<float>& Rates, float DeltaTime)
+{
+	if (CellIndices.Num() != Rates.Num() || CellIndices.Num() == 0)
+		return 0.0f;
+
+	if (bUseSparseRepresentation)
+	{
+		ConvertToDense();
+	}
+
+	float AddedVolume = 0.0f;
+	for (int32 i = 0; i < CellIndices.Num(); ++i)
+	{
+		const int32 Idx = CellIndices[i];
+		if (!Cells.IsValidIndex(Idx) || Cells[Idx].bIsSolid)
+			continue;
+
+		FCAFluidCell& Cell = Cells[Idx];
+		const float OldLevel = Cell.FluidLevel;
+		Cell.FluidLevel = FMath::Min(OldLevel + Rates[i] * DeltaTime, MaxFluidLevel);
+		AddedVolume += FMath::Abs(Cell.FluidLevel - OldLevel);
+	}
+
+	if (AddedVolume > 0.0f)
+	{
+		MassFlows.Add(EFluidMassCategory::Edit, AddedVolume);
+		bDirty = true;
+		ConsiderMeshUpdate(AddedVolume);
+	}
+
+	return AddedVolume;
+}
+
+bool UFluidChunk::ApplyCellEdits(const FFluidChunkCellEdits& Edits, float& OutAdded, float& OutRemoved)
+{
+	OutAdded = 0.0f;
+	OutRemoved = 0.0f;
+
+	if (Edits.Num() == 0)
+		return false;
+
+	if (bUseSparseRepresentation)
+	{
+		ConvertToDense();
+	}
+
+	for (int32 i = 0; i < Edits.Num(); ++i)
+	{
+		const int32 Idx = Edits.CellIndices[i];
+		if (!Cells.IsValidIndex(Idx) || Cells[Idx].bIsSolid)
+			continue;
+
+		FCAFluidCell& Cell = Cells[Idx];
+		const float OldLevel = Cell.FluidLevel;
+		float NewLevel = OldLevel;
+
+		switch (Edits.Ops[i])
+		{
+		case EFluidEditOp::Add:      NewLevel = OldLevel + Edits.Values[i]; break;
+		case EFluidEditOp::Remove:   NewLevel = OldLevel - Edits.Values[i]; break;
+		case EFluidEditOp::SetLevel: NewLevel = Edits.Values[i]; break;
+		}
+
+		NewLevel = FMath::Clamp(NewLevel, 0.0f, MaxFluidLevel);
+		if (NewLevel < MinFluidLevel)
+		{
+			NewLevel = 0.0f;
+		}
+		if (NewLevel == OldLevel)
+			continue;
+
+		if (NewLevel > OldLevel)
+		{
+			OutAdded += NewLevel - OldLevel;
+		}
+		else
+		{
+			OutRemoved += OldLevel - NewLevel;
+		}
+
+		Cell.FluidLevel = NewLevel;
+		Cell.LastFluidLevel = NewLevel;
+		Cell.bSettled = false;
+		Cell.SettledCounter = 0;
+		if (NextCells.IsValidIndex(Idx))
+		{
+			NextCells[Idx] = Cell;
+		}
+	}
+
+	if (OutAdded > 0.0f || OutRemoved > 0.0f)
+	{
+		MassFlows.Add(EFluidMassCategory::Edit, OutAdded - OutRemoved);
+		bDirty = true;
+		bFullySettled = false;
+		MarkMeshDataDirty();
+		return true;
+	}
+	return false;
+}
+
 void UFluidChunk::RemoveFluid(int32 LocalX, int32 LocalY, int32 LocalZ, float Amount)
 {
+	if (bUseSparseRepresentation)
+	{
+		ConvertToDense();
+	}
+
 	const int32 Idx = GetLocalCellIndex(LocalX, LocalY, LocalZ);
 	if (Idx >= 0 && Idx < Cells.Num())
 	{
 		const float OldLevel = Cells[Idx].FluidLevel;
 		Cells[Idx].FluidLevel = FMath::Max(Cells[Idx].FluidLevel - Amount, 0.0f);
 		const float Change = FMath::Abs(OldLevel - Cells[Idx].FluidLevel);
+		MassFlows.Add(EFluidMassCategory::Edit, Cells[Idx].FluidLevel - OldLevel);
 		bDirty = true;
 		ConsiderMeshUpdate(Change); // Only mark dirty if change is significant
 	}
@@ -486,6 +721,7 @@ void UFluidChunk::SetCellSolid(int32 LocalX, int32 LocalY, int32 LocalZ, bool bS
 		// If cell became solid, remove any fluid
 		if (bSolid && !bWasSolid)
 		{
+			MassFlows.Add(EFluidMassCategory::Terrain, -Cells[Idx].FluidLevel);
 			Cells[Idx].FluidLevel = 0.0f;
 			Cells[Idx].bSettled = false;
 			Cells[Idx].SettledCounter = 0;
@@ -622,9 +858,27 @@ bool UFluidChunk::HasActiveFluid() const
 	return false;
 }
 
+void UFluidChunk::SetIdleActivity()
+{
+	Activity = FFluidChunkActivity();
+	Activity.TotalVolume = GetTotalFluidVolume();
+	Activity.bValid = true;
+}
+
 float UFluidChunk::GetTotalFluidVolume() const
 {
 	float TotalVolume = 0.0f;
+
+	// Sparse chunks keep their dense arrays sized but empty
+	if (bUseSparseRepresentation)
+	{
+		for (const auto& Pair : SparseCells)
+		{
+			TotalVolume += Pair.Value.FluidLevel;
+		}
+		return TotalVolume;
+	}
+
 	for (const FCAFluidCell& Cell : Cells)
 	{
 		TotalVolume += Cell.FluidLevel;
@@ -661,10 +915,173 @@ void UFluidChunk::SetLODLevel(int32 NewLODLevel)
 	// Force LOD 0 for all chunks to ensure full speed simulation
 	// CurrentLOD = 0; // Ignore requested LOD, always use full quality
 	CurrentLOD = FMath::Clamp(NewLODLevel, 0, 2);
+
+	// The fine cells stay authoritative, so switching LOD needs no transfer; only the solver comes and goes
+	const int32 Factor = GetCoarseFactor();
+	if (Factor <= 1)
+	{
+		CoarseGrid = nullptr;
+		CoarseStartLevels.Empty();
+		return;
+	}
+
+	const int32 CoarseSize = ChunkSize / Factor;
+	if (!CoarseGrid)
+	{
+		CoarseGrid = NewObject<UCAFluidGrid>(this);
+		CoarseGrid->bEnableSettling = false;
+		CoarseGrid->bUseSleepChains = false;
+		CoarseGrid->bUsePredictiveSettling = false;
+		CoarseGrid->bPublishStats = false;
+	}
+	if (CoarseGrid->GridSizeX != CoarseSize || CoarseGrid->Cells.Num() == 0)
+	{
+		CoarseGrid->InitializeGrid(CoarseSize, CoarseSize, CoarseSize, CellSize * Factor, ChunkWorldPosition);
+	}
+	CoarseGrid->FlowRate = FlowRate;
+	CoarseGrid->MinFluidLevel = MinFluidLevel / (Factor * Factor * Factor); // Coarse levels are block means
+	CoarseGrid->MaxFluidLevel = MaxFluidLevel;
+}
+
+int32 UFluidChunk::GetCoarseFactor() const
+{
+	if (!bCoarseLODSimulation || CurrentLOD <= 0)
+		return 1;
+
+	int32 Factor = CurrentLOD == 1 ? 2 : 4;
+	while (Factor > 1 && (ChunkSize % Factor != 0 || ChunkSize / Factor < 2))
+	{
+		Factor /= 2;
+	}
+	return Factor;
+}
+
+bool UFluidChunk::SimulateCoarse(float DeltaTime)
+{
+	const int32 Factor = GetCoarseFactor();
+	if (Factor <= 1 || !CoarseGrid || bUseSparseRepresentation || CoarseGrid->GridSizeX * Factor != ChunkSize || NextCells.Num() != ChunkSize * ChunkSize * ChunkSize)
+		return false;
+
+	const int32 CoarseSize = CoarseGrid->GridSizeX;
+	const int32 BlockCells = Factor * Factor * Factor;
+	CoarseStartLevels.SetNumUninitialized(CoarseGrid->Cells.Num());
+
+	// Restrict: a coarse cell holds the mean level of its block, so coarse volume times BlockCells is the fine volume.
+	// Mostly solid blocks are solid; the fluid in their few open cells sits out the coarse step untouched
+	int32 CoarseIndex = 0;
+	for (int32 CZ = 0; CZ < CoarseSize; ++CZ)
+	{
+		for (int32 CY = 0; CY < CoarseSize; ++CY)
+		{
+			for (int32 CX = 0; CX < CoarseSize; ++CX, ++CoarseIndex)
+			{
+				float Volume = 0.0f;
+				int32 SolidCells = 0;
+				for (int32 DZ = 0; DZ < Factor; ++DZ)
+				{
+					for (int32 DY = 0; DY < Factor; ++DY)
+					{
+						const int32 RowStart = GetLocalCellIndex(CX * Factor, CY * Factor + DY, CZ * Factor + DZ);
+						for (int32 DX = 0; DX < Factor; ++DX)
+						{
+							const FCAFluidCell& Cell = NextCells[RowStart + DX];
+							Volume += Cell.FluidLevel;
+							SolidCells += Cell.bIsSolid ? 1 : 0;
+						}
+					}
+				}
+
+				FCAFluidCell& Coarse = CoarseGrid->Cells[CoarseIndex];
+				Coarse.bIsSolid = SolidCells * 2 > BlockCells;
+				Coarse.FluidLevel = Coarse.bIsSolid ? 0.0f : Volume / BlockCells;
+				Coarse.TerrainHeight = NextCells[GetLocalCellIndex(CX * Factor, CY * Factor, CZ * Factor)].TerrainHeight;
+				Coarse.bSettled = false;
+				Coarse.SettledCounter = 0;
+				CoarseStartLevels[CoarseIndex] = Coarse.FluidLevel;
+			}
+		}
+	}
+
+	CoarseGrid->UpdateSimulation(DeltaTime);
+
+	// Prolong: spread each block's change over its open cells, filling free capacity first and draining in
+	// proportion to level, so the fine surface keeps its detail and the block's volume changes exactly as the coarse cell's
+	TArray<int32, TInlineAllocator<64>> OpenCells;
+	double AppliedVolume = 0.0; // Flow between blocks cancels; what remains was created or destroyed
+	CoarseIndex = 0;
+	for (int32 CZ = 0; CZ < CoarseSize; ++CZ)
+	{
+		for (int32 CY = 0; CY < CoarseSize; ++CY)
+		{
+			for (int32 CX = 0; CX < CoarseSize; ++CX, ++CoarseIndex)
+			{
+				const FCAFluidCell& Coarse = CoarseGrid->Cells[CoarseIndex];
+				const float Delta = (Coarse.FluidLevel - CoarseStartLevels[CoarseIndex]) * BlockCells;
+				if (Coarse.bIsSolid || Delta == 0.0f)
+					continue;
+
+				OpenCells.Reset();
+				float FreeCapacity = 0.0f;
+				float LevelSum = 0.0f;
+				for (int32 DZ = 0; DZ < Factor; ++DZ)
+				{
+					for (int32 DY = 0; DY < Factor; ++DY)
+					{
+						const int32 RowStart = GetLocalCellIndex(CX * Factor, CY * Factor + DY, CZ * Factor + DZ);
+						for (int32 DX = 0; DX < Factor; ++DX)
+						{
+							const FCAFluidCell& Cell = NextCells[RowStart + DX];
+							if (!Cell.bIsSolid)
+							{
+								OpenCells.Add(RowStart + DX);
+								FreeCapacity += FMath::Max(0.0f, MaxFluidLevel - Cell.FluidLevel);
+								LevelSum += Cell.FluidLevel;
+							}
+						}
+					}
+				}
+				if (OpenCells.Num() == 0)
+					continue;
+
+				if (Delta > 0.0f)
+				{
+					const float FillRatio = FreeCapacity > 0.0f ? FMath::Min(1.0f, Delta / FreeCapacity) : 0.0f;
+					const float Overflow = (Delta - FillRatio * FreeCapacity) / OpenCells.Num();
+					for (int32 Index : OpenCells)
+					{
+						FCAFluidCell& Cell = NextCells[Index];
+						Cell.FluidLevel += FMath::Max(0.0f, MaxFluidLevel - Cell.FluidLevel) * FillRatio + Overflow;
+						Cell.bSettled = false;
+					}
+					AppliedVolume += Delta;
+				}
+				else if (LevelSum > 0.0f)
+				{
+					const float DrainRatio = FMath::Min(1.0f, -Delta / LevelSum);
+					for (int32 Index : OpenCells)
+					{
+						FCAFluidCell& Cell = NextCells[Index];
+						Cell.FluidLevel -= Cell.FluidLevel * DrainRatio;
+						Cell.bSettled = false;
+					}
+					AppliedVolume -= LevelSum * DrainRatio;
+				}
+			}
+		}
+	}
+
+	MassFlows.Add(EFluidMassCategory::CoarseSolve, AppliedVolume);
+	return true;
 }
 
 void UFluidChunk::ClearChunk()
 {
+	if (bUseSparseRepresentation)
+	{
+		ConvertToDense();
+	}
+
+	MassFlows.Add(EFluidMassCategory::Edit, -GetTotalFluidVolume());
 	for (FCAFluidCell& Cell : Cells)
 	{
 		Cell.FluidLevel = 0.0f;
@@ -673,6 +1090,7 @@ void UFluidChunk::ClearChunk()
 		Cell.LastFluidLevel = 0.0f;
 	}
 	NextCells = Cells;
+	FlowField.Reset();
 	bDirty = true;
 }
 
@@ -808,6 +1226,7 @@ void UFluidChunk::ApplyGravity(float DeltaTime)
 				{
 					GravityTransfers.Add(TPair<int32, float>(CurrentIdx, -FlowAmount));
 					GravityTransfers.Add(TPair<int32, float>(BelowIdx, FlowAmount));
+					FlowField.Record(x, y, z, FVector3f(0.0f, 0.0f, -FlowAmount));
 				}
 			}
 		}
@@ -821,6 +1240,7 @@ void UFluidChunk::ApplyGravity(float DeltaTime)
 				if (Cell->FluidLevel <= MinFluidLevel && Transfer.Value < 0)
 				{
 					// Remove cell if it's now empty
+					MassFlows.Add(EFluidMassCategory::MinLevelClamp, -Cell->FluidLevel);
 					SparseNextCells.Remove(Transfer.Key);
 					ActiveCellIndices.Remove(Transfer.Key);
 				}
@@ -877,7 +1297,7 @@ void UFluidChunk::ApplyGravity(float DeltaTime)
 					{
 						NextCells[CurrentIdx].FluidLevel -= FlowAmount;
 						NextCells[BelowIdx].FluidLevel += FlowAmount;
-						// Removed velocity tracking - using simplified CA
+						FlowField.Record(x, y, z, FVector3f(0.0f, 0.0f, -FlowAmount));
 					}
 				}
 			}
@@ -955,6 +1375,7 @@ void UFluidChunk::ApplyFlowRules(float DeltaTime)
 						{
 							FlowTransfers.Add(TPair<int32, float>(CurrentIdx, -ActualFlow));
 							FlowTransfers.Add(TPair<int32, float>(NeighborIdx, ActualFlow));
+							FlowField.Record(x, y, z, FVector3f(Dir.X, Dir.Y, 0.0f) * ActualFlow);
 						}
 					}
 				}
@@ -969,6 +1390,7 @@ void UFluidChunk::ApplyFlowRules(float DeltaTime)
 				Cell->FluidLevel += Transfer.Value;
 				if (Cell->FluidLevel <= MinFluidLevel && Transfer.Value < 0)
 				{
+					MassFlows.Add(EFluidMassCategory::MinLevelClamp, -Cell->FluidLevel);
 					SparseNextCells.Remove(Transfer.Key);
 					ActiveCellIndices.Remove(Transfer.Key);
 				}
@@ -1032,6 +1454,12 @@ void UFluidChunk::ApplyFlowRules(float DeltaTime)
 					{x, y + 1},
 					{x, y - 1}
 				};
+				static const FVector3f NeighborDirections[4] = {
+					FVector3f(1.0f, 0.0f, 0.0f),
+					FVector3f(-1.0f, 0.0f, 0.0f),
+					FVector3f(0.0f, 1.0f, 0.0f),
+					FVector3f(0.0f, -1.0f, 0.0f)
+				};
 				
 				float TotalOutflow = 0.0f;
 				float OutflowToNeighbor[4] = {0.0f};
@@ -1102,7 +1530,7 @@ void UFluidChunk::ApplyFlowRules(float DeltaTime)
 							NextCells[NeighborIdx].FluidLevel += OutflowToNeighbor[i];
 						}
 						
-						// Removed velocity tracking - using simplified CA
+						FlowField.Record(x, y, z, NeighborDirections[i] * OutflowToNeighbor[i]);
 					}
 				}
 			}
@@ -1153,6 +1581,7 @@ void UFluidChunk::ApplyPressure(float DeltaTime)
 				{
 					PressureTransfers.Add(TPair<int32, float>(CurrentIdx, -PushUp));
 					PressureTransfers.Add(TPair<int32, float>(AboveIdx, PushUp));
+					FlowField.Record(x, y, z, FVector3f(0.0f, 0.0f, PushUp));
 				}
 			}
 		}
@@ -1165,6 +1594,7 @@ void UFluidChunk::ApplyPressure(float DeltaTime)
 				Cell->FluidLevel += Transfer.Value;
 				if (Cell->FluidLevel <= MinFluidLevel && Transfer.Value < 0)
 				{
+					MassFlows.Add(EFluidMassCategory::MinLevelClamp, -Cell->FluidLevel);
 					SparseNextCells.Remove(Transfer.Key);
 					ActiveCellIndices.Remove(Transfer.Key);
 				}
@@ -1212,6 +1642,7 @@ void UFluidChunk::ApplyPressure(float DeltaTime)
 						AboveCell.FluidLevel += TransferAmount;
 						AboveCell.bSettled = false;
 						AboveCell.SettledCounter = 0;
+						FlowField.Record(x, y, z, FVector3f(0.0f, 0.0f, TransferAmount));
 					}
 				}
 			}
@@ -1219,6 +1650,274 @@ void UFluidChunk::ApplyPressure(float DeltaTime)
 	}
 }
 
+void UFluidChunk::ApplyColumnPressure()
+{
+	if (!bUseColumnPressure || bUseSparseRepresentation || ColumnPressureRelaxation <= 0.0f || MaxColumnHeadChange <= 0.0f)
+		return;
+
+	const int32 Size = ChunkSize;
+	const int32 ColumnCount = Size * Size;
+	const int32 LayerStride = Size * Size;
+	if (NextCells.Num() != ColumnCount * Size)
+		return;
+
+	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_ApplyColumnPressure);
+
+	const float FullLevel = MaxFluidLevel * 0.99f;
+	const float InvMaxLevel = 1.0f / MaxFluidLevel;
+
+	// Segments, column by column from the bottom up; ColumnSegmentStart is their prefix sum per column
+	ColumnSegments.Reset();
+	ColumnSegmentStart.SetNumUninitialized(ColumnCount + 1);
+	for (int32 Column = 0; Column < ColumnCount; ++Column)
+	{
+		ColumnSegmentStart[Column] = ColumnSegments.Num();
+		int32 OpenSegment = INDEX_NONE; // Still looking for its ceiling
+		int32 Z = 0;
+		while (Z < Size)
+		{
+			const FCAFluidCell& Cell = NextCells[Column + Z * LayerStride];
+			if (Cell.bIsSolid || Cell.FluidLevel <= MinFluidLevel)
+			{
+				if (Cell.bIsSolid && OpenSegment != INDEX_NONE)
+				{
+					ColumnSegments[OpenSegment].Ceiling = Z;
+					OpenSegment = INDEX_NONE;
+				}
+				++Z;
+				continue;
+			}
+
+			if (OpenSegment != INDEX_NONE)
+			{
+				ColumnSegments[OpenSegment].Ceiling = Z;
+			}
+
+			FFluidColumnSegment& Segment = ColumnSegments.AddDefaulted_GetRef();
+			Segment.Column = Column;
+			Segment.Parent = ColumnSegments.Num() - 1;
+			Segment.Bottom = Z;
+			Segment.FullTop = Z - 1;
+			Segment.Ceiling = Size;
+			while (Z < Size)
+			{
+				const FCAFluidCell& Run = NextCells[Column + Z * LayerStride];
+				if (Run.bIsSolid || Run.FluidLevel < FullLevel)
+					break;
+				Segment.FullTop = Z++;
+			}
+
+			// At most one partial cell caps the run
+			Segment.Head = Segment.FullTop + 1;
+			if (Z < Size)
+			{
+				const FCAFluidCell& Top = NextCells[Column + Z * LayerStride];
+				if (!Top.bIsSolid && Top.FluidLevel > MinFluidLevel)
+				{
+					Segment.Head = Z + Top.FluidLevel * InvMaxLevel;
+					++Z;
+				}
+			}
+			OpenSegment = ColumnSegments.Num() - 1;
+		}
+	}
+	ColumnSegmentStart[ColumnCount] = ColumnSegments.Num();
+
+	auto FindRoot = [this](int32 Index)
+	{
+		while (ColumnSegments[Index].Parent != Index)
+		{
+			ColumnSegments[Index].Parent = ColumnSegments[ColumnSegments[Index].Parent].Parent;
+			Index = ColumnSegments[Index].Parent;
+		}
+		return Index;
+	};
+
+	// Segments in neighbouring columns are one body where their full cells share a height.
+	// Both columns list segments bottom-up, so one merge pass finds every overlap
+	bool bAnyConnection = false;
+	auto ConnectColumns = [&](int32 ColumnA, int32 ColumnB)
+	{
+		int32 A = ColumnSegmentStart[ColumnA];
+		int32 B = ColumnSegmentStart[ColumnB];
+		const int32 EndA = ColumnSegmentStart[ColumnA + 1];
+		const int32 EndB = ColumnSegmentStart[ColumnB + 1];
+		while (A < EndA && B < EndB)
+		{
+			const FFluidColumnSegment& SegA = ColumnSegments[A];
+			const FFluidColumnSegment& SegB = ColumnSegments[B];
+			if (FMath::Max(SegA.Bottom, SegB.Bottom) <= FMath::Min(SegA.FullTop, SegB.FullTop))
+			{
+				const int32 RootA = FindRoot(A);
+				const int32 RootB = FindRoot(B);
+				if (RootA != RootB)
+				{
+					ColumnSegments[RootB].Parent = RootA;
+					bAnyConnection = true;
+				}
+			}
+
+			if (SegA.FullTop < SegB.FullTop)
+				++A;
+			else
+				++B;
+		}
+	};
+
+	for (int32 Y = 0; Y < Size; ++Y)
+	{
+		for (int32 X = 0; X < Size; ++X)
+		{
+			const int32 Column = X + Y * Size;
+			if (ColumnSegmentStart[Column] == ColumnSegmentStart[Column + 1])
+				continue;
+			if (X + 1 < Size)
+				ConnectColumns(Column, Column + 1);
+			if (Y + 1 < Size)
+				ConnectColumns(Column, Column + Size);
+		}
+	}
+
+	if (!bAnyConnection)
+		return;
+
+	// Group segments by body with a counting sort on the root
+	const int32 SegmentCount = ColumnSegments.Num();
+	TArray<int32, TInlineAllocator<256>> BodyStart;
+	BodyStart.SetNumZeroed(SegmentCount + 1);
+	for (int32 i = 0; i < SegmentCount; ++i)
+	{
+		++BodyStart[FindRoot(i) + 1];
+	}
+	for (int32 i = 0; i < SegmentCount; ++i)
+	{
+		BodyStart[i + 1] += BodyStart[i];
+	}
+	BodySegments.SetNumUninitialized(SegmentCount);
+	{
+		TArray<int32, TInlineAllocator<256>> Cursor(BodyStart);
+		for (int32 i = 0; i < SegmentCount; ++i)
+		{
+			BodySegments[Cursor[FindRoot(i)]++] = i;
+		}
+	}
+
+	TArray<float, TInlineAllocator<64>> Deltas;
+	for (int32 Root = 0; Root < SegmentCount; ++Root)
+	{
+		const int32 First = BodyStart[Root];
+		const int32 Count = BodyStart[Root + 1] - First;
+		if (Count < 2)
+			continue;
+
+		// Level head: every surface moves to H within [Bottom, Ceiling], and H is where the moves sum to zero
+		float Low = FLT_MAX;
+		float High = -FLT_MAX;
+		float MinHead = FLT_MAX;
+		float MaxHead = -FLT_MAX;
+		double HeadSum = 0.0;
+		for (int32 i = First; i < First + Count; ++i)
+		{
+			const FFluidColumnSegment& Segment = ColumnSegments[BodySegments[i]];
+			Low = FMath::Min(Low, (float)Segment.Bottom);
+			High = FMath::Max(High, (float)Segment.Ceiling);
+			MinHead = FMath::Min(MinHead, Segment.Head);
+			MaxHead = FMath::Max(MaxHead, Segment.Head);
+			HeadSum += Segment.Head;
+		}
+		if (MaxHead - MinHead < 0.01f)
+			continue;
+
+		for (int32 Iteration = 0; Iteration < 24; ++Iteration)
+		{
+			const float Mid = (Low + High) * 0.5f;
+			double Sum = 0.0;
+			for (int32 i = First; i < First + Count; ++i)
+			{
+				const FFluidColumnSegment& Segment = ColumnSegments[BodySegments[i]];
+				Sum += FMath::Clamp(Mid, (float)Segment.Bottom, (float)Segment.Ceiling);
+			}
+			(Sum < HeadSum ? Low : High) = Mid;
+		}
+		const float Level = (Low + High) * 0.5f;
+
+		// Relaxed and capped moves, then the larger side scaled down so the body keeps its volume
+		Deltas.SetNumUninitialized(Count);
+		double Raised = 0.0;
+		double Lowered = 0.0;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const FFluidColumnSegment& Segment = ColumnSegments[BodySegments[First + i]];
+			const float Target = FMath::Clamp(Level, (float)Segment.Bottom, (float)Segment.Ceiling);
+			Deltas[i] = FMath::Clamp((Target - Segment.Head) * ColumnPressureRelaxation, -MaxColumnHeadChange, MaxColumnHeadChange);
+			(Deltas[i] > 0.0f ? Raised : Lowered) += FMath::Abs(Deltas[i]);
+		}
+		if (Raised <= 0.0 || Lowered <= 0.0)
+			continue;
+
+		// Fluid leaves the lowered columns toward the raised ones; the flow field takes that as the lateral direction
+		FVector2f LowerCentre(0.0f, 0.0f);
+		FVector2f RaiseCentre(0.0f, 0.0f);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const int32 Column = ColumnSegments[BodySegments[First + i]].Column;
+			(Deltas[i] > 0.0f ? RaiseCentre : LowerCentre) += FVector2f((float)(Column % Size), (float)(Column / Size)) * FMath::Abs(Deltas[i]);
+		}
+		const FVector2f FlowDirection = (RaiseCentre / (float)Raised - LowerCentre / (float)Lowered).GetSafeNormal();
+
+		// Apply as the change in fill between the two heads, so compressed cells keep their excess; returns the volume moved
+		auto MoveHead = [&](const FFluidColumnSegment& Segment, float NewHead)
+		{
+			const int32 X = Segment.Column % Size;
+			const int32 Y = Segment.Column / Size;
+			const float OldHead = Segment.Head;
+			const int32 FromZ = FMath::Max((int32)Segment.Bottom, FMath::FloorToInt(FMath::Min(OldHead, NewHead)));
+			const int32 ToZ = FMath::Min((int32)Segment.Ceiling, FMath::CeilToInt(FMath::Max(OldHead, NewHead)));
+			double Moved = 0.0;
+			for (int32 Z = FromZ; Z < ToZ; ++Z)
+			{
+				FCAFluidCell& Cell = NextCells[Segment.Column + Z * LayerStride];
+				const float Change = (FMath::Clamp(NewHead - Z, 0.0f, 1.0f) - FMath::Clamp(OldHead - Z, 0.0f, 1.0f)) * MaxFluidLevel;
+				const float Applied = FMath::Max(Change, -Cell.FluidLevel);
+				if (Applied != 0.0f)
+				{
+					Cell.FluidLevel += Applied;
+					Cell.bSettled = false;
+					Cell.SettledCounter = 0;
+					FlowField.Record(X, Y, Z, FVector3f(FlowDirection.X * FMath::Abs(Applied), FlowDirection.Y * FMath::Abs(Applied), Applied));
+					Moved += Applied;
+				}
+			}
+			return Moved;
+		};
+
+		// Lower first: a partly filled cell can hold less than its head implies, so only what the cells
+		// actually gave is shared out to the raised columns and the body never gains fluid
+		const float LowerScale = Lowered > Raised ? (float)(Raised / Lowered) : 1.0f;
+		double Removed = 0.0;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (Deltas[i] < 0.0f)
+			{
+				const FFluidColumnSegment& Segment = ColumnSegments[BodySegments[First + i]];
+				Removed -= MoveHead(Segment, Segment.Head + Deltas[i] * LowerScale);
+			}
+		}
+		if (Removed <= 0.0)
+			continue;
+
+		const float RaiseScale = (float)(Removed / (Raised * MaxFluidLevel));
+		for (int32 i = 0; i < Count; ++i)
+		{
+			if (Deltas[i] > 0.0f)
+			{
+				const FFluidColumnSegment& Segment = ColumnSegments[BodySegments[First + i]];
+				MoveHead(Segment, Segment.Head + Deltas[i] * RaiseScale);
+			}
+		}
+	}
+}
+
 void UFluidChunk::ApplyEvaporation(float DeltaTime)
 {
 	// Only apply evaporation if rate is greater than 0
@@ -1229,6 +1928,9 @@ void UFluidChunk::ApplyEvaporation(float DeltaTime)
 	const float EvaporationAmount = EvaporationRate * DeltaTime;
 	
 	// Handle sparse mode
+	double Evaporated = 0.0;
+	double Clamped = 0.0;
+
 	if (bUseSparseRepresentation)
 	{
 		TArray<int32> CellsToRemove;
@@ -1239,11 +1941,14 @@ void UFluidChunk::ApplyEvaporation(float DeltaTime)
 			if (Cell.FluidLevel > 0.0f && !Cell.bIsSolid)
 			{
 				// Evaporate fluid, but don't go below 0
+				const float OldLevel = Cell.FluidLevel;
 				Cell.FluidLevel = FMath::Max(0.0f, Cell.FluidLevel - EvaporationAmount);
+				Evaporated += OldLevel - Cell.FluidLevel;
 				
 				// Mark for removal if fluid is now below threshold
 				if (Cell.FluidLevel <= MinFluidLevel)
 				{
+					Clamped += Cell.FluidLevel;
 					CellsToRemove.Add(CellPair.Key);
 				}
 			}
@@ -1256,6 +1961,8 @@ void UFluidChunk::ApplyEvaporation(float DeltaTime)
 			ActiveCellIndices.Remove(CellIndex);
 		}
 		
+		MassFlows.Add(EFluidMassCategory::Evaporation, -Evaporated);
+		MassFlows.Add(EFluidMassCategory::MinLevelClamp, -Clamped);
 		return; // Exit early for sparse mode
 	}
 	
@@ -1265,16 +1972,22 @@ void UFluidChunk::ApplyEvaporation(float DeltaTime)
 		if (NextCells[i].FluidLevel > 0.0f && !NextCells[i].bIsSolid)
 		{
 			// Evaporate fluid, but don't go below 0
+			const float OldLevel = NextCells[i].FluidLevel;
 			NextCells[i].FluidLevel = FMath::Max(0.0f, NextCells[i].FluidLevel - EvaporationAmount);
+			Evaporated += OldLevel - NextCells[i].FluidLevel;
 			
 			// If fluid level drops below MinFluidLevel after evaporation, remove it completely
 			// This prevents tiny amounts from lingering
 			if (NextCells[i].FluidLevel < MinFluidLevel)
 			{
+				Clamped += NextCells[i].FluidLevel;
 				NextCells[i].FluidLevel = 0.0f;
 			}
 		}
 	}
+
+	MassFlows.Add(EFluidMassCategory::Evaporation, -Evaporated);
+	MassFlows.Add(EFluidMassCategory::MinLevelClamp, -Clamped);
 }
 
 // UpdateVelocities removed - was part of settling system
@@ -1289,6 +2002,149 @@ void UFluidChunk::ProcessBorderFlow(float DeltaTime)
 	bBorderDirty = false;
 }
 
+void UFluidChunk::RecordBorderFlow(int32 CellIndex, const FVector3f& Transfer)
+{
+	if (CellIndex < 0)
+		return;
+
+	const int32 X = CellIndex % ChunkSize;
+	const int32 Y = (CellIndex / ChunkSize) % ChunkSize;
+	const int32 Z = CellIndex / (ChunkSize * ChunkSize);
+	FlowField.Record(X, Y, Z, Transfer);
+}
+
+void UFluidChunk::ResolveFlowField()
+{
+	if (!FlowField.bPendingResolve)
+		return;
+
+	// Brick volumes from the post-step cells; one pass, no per-cell storage
+	const int32 BricksPerAxis = FlowField.BricksPerAxis;
+	TArray<float> BrickVolumes;
+	BrickVolumes.SetNumZeroed(BricksPerAxis * BricksPerAxis * BricksPerAxis);
+
+	if (bUseSparseRepresentation)
+	{
+		for (const auto& CellPair : SparseCells)
+		{
+			if (CellPair.Value.bIsSolid)
+				continue;
+
+			const int32 x = CellPair.Key % ChunkSize;
+			const int32 y = (CellPair.Key / ChunkSize) % ChunkSize;
+			const int32 z = CellPair.Key / (ChunkSize * ChunkSize);
+			BrickVolumes[FlowField.GetBrickIndex(x, y, z)] += CellPair.Value.FluidLevel;
+		}
+	}
+	else if (Cells.Num() == ChunkSize * ChunkSize * ChunkSize)
+	{
+		int32 CellIndex = 0;
+		for (int32 z = 0; z < ChunkSize; ++z)
+		{
+			for (int32 y = 0; y < ChunkSize; ++y)
+			{
+				const int32 RowBrick = FlowField.GetBrickIndex(0, y, z);
+				for (int32 x = 0; x < ChunkSize; ++x, ++CellIndex)
+				{
+					if (!Cells[CellIndex].bIsSolid)
+					{
+						BrickVolumes[RowBrick + x / FFluidFlowField::BrickSize] += Cells[CellIndex].FluidLevel;
+					}
+				}
+			}
+		}
+	}
+
+	Activity.MeanFlowSpeed = FlowField.Resolve(BrickVolumes, CellSize);
+}
+
+FVector UFluidChunk::SampleFlowVelocity(const FVector& WorldPos) const
+{
+	if (!FlowField.IsValid())
+		return FVector::ZeroVector;
+
+	return FlowField.SampleVelocity((WorldPos - ChunkWorldPosition) / CellSize);
+}
+
+FVector UFluidChunk::SampleFlowFlux(const FVector& WorldPos) const
+{
+	if (!FlowField.IsValid())
+		return FVector::ZeroVector;
+
+	return FlowField.SampleFlux((WorldPos - ChunkWorldPosition) / CellSize);
+}
+
+void FFluidFlowField::BeginStep(int32 ChunkSize, float DeltaTime)
+{
+	const int32 NewBricksPerAxis = FMath::DivideAndRoundUp(ChunkSize, BrickSize);
+	const int32 BrickCount = NewBricksPerAxis * NewBricksPerAxis * NewBricksPerAxis;
+	if (BricksPerAxis != NewBricksPerAxis)
+	{
+		BricksPerAxis = NewBricksPerAxis;
+		Velocity.SetNumZeroed(BrickCount);
+	}
+
+	Flux.SetNumUninitialized(BrickCount);
+	FMemory::Memzero(Flux.GetData(), BrickCount * sizeof(FVector3f));
+	StepDeltaTime = DeltaTime;
+	bPendingResolve = true;
+}
+
+float FFluidFlowField::Resolve(const TArray<float>& BrickVolumes, float CellSize)
+{
+	bPendingResolve = false;
+
+	const float InvDeltaTime = StepDeltaTime > KINDA_SMALL_NUMBER ? 1.0f / StepDeltaTime : 0.0f;
+	float WeightedSpeed = 0.0f;
+	float TotalVolume = 0.0f;
+
+	for (int32 i = 0; i < Flux.Num(); ++i)
+	{
+		Flux[i] *= InvDeltaTime;
+
+		// Nearly dry bricks would turn a trickle into a huge speed
+		const float Volume = BrickVolumes[i];
+		Velocity[i] = Volume > 0.01f ? Flux[i] * (CellSize / Volume) : FVector3f::ZeroVector;
+
+		WeightedSpeed += Velocity[i].Size() * Volume;
+		TotalVolume += Volume;
+	}
+
+	return TotalVolume > KINDA_SMALL_NUMBER ? WeightedSpeed / TotalVolume : 0.0f;
+}
+
+static FVector SampleBrickField(const TArray<FVector3f>& Field, int32 BricksPerAxis, const FVector& LocalCellPos)
+{
+	if (BricksPerAxis <= 0 || Field.Num() != BricksPerAxis * BricksPerAxis * BricksPerAxis)
+		return FVector::ZeroVector;
+
+	// Brick centres sit at (b + 0.5) * BrickSize; outside the outer centres the edge brick is held
+	const FVector BrickPos = LocalCellPos / FFluidFlowField::BrickSize - FVector(0.5f);
+	const float MaxIndex = BricksPerAxis - 1;
+	const FVector Clamped(FMath::Clamp(BrickPos.X, 0.0f, MaxIndex), FMath::Clamp(BrickPos.Y, 0.0f, MaxIndex), FMath::Clamp(BrickPos.Z, 0.0f, MaxIndex));
+
+	const int32 X0 = FMath::FloorToInt(Clamped.X), Y0 = FMath::FloorToInt(Clamped.Y), Z0 = FMath::FloorToInt(Clamped.Z);
+	const int32 X1 = FMath::Min(X0 + 1, BricksPerAxis - 1), Y1 = FMath::Min(Y0 + 1, BricksPerAxis - 1), Z1 = FMath::Min(Z0 + 1, BricksPerAxis - 1);
+	const float TX = Clamped.X - X0, TY = Clamped.Y - Y0, TZ = Clamped.Z - Z0;
+
+	auto At = [&Field, BricksPerAxis](int32 X, int32 Y, int32 Z) { return Field[X + (Y + Z * BricksPerAxis) * BricksPerAxis]; };
+
+	const FVector3f Bottom = FMath::Lerp(FMath::Lerp(At(X0, Y0, Z0), At(X1, Y0, Z0), TX), FMath::Lerp(At(X0, Y1, Z0), At(X1, Y1, Z0), TX), TY);
+	const FVector3f Top = FMath::Lerp(FMath::Lerp(At(X0, Y0, Z1), At(X1, Y0, Z1), TX), FMath::Lerp(At(X0, Y1, Z1), At(X1, Y1, Z1), TX), TY);
+	return FVector(FMath::Lerp(Bottom, Top, TZ));
+}
+
+FVector FFluidFlowField::SampleVelocity(const FVector& LocalCellPos) const
+{
+	return SampleBrickField(Velocity, BricksPerAxis, LocalCellPos);
+}
+
+FVector FFluidFlowField::SampleFlux(const FVector& LocalCellPos) const
+{
+	// Flux is mid-accumulation during a step; only the resolved rates are meaningful
+	return bPendingResolve ? FVector::ZeroVector : SampleBrickField(Flux, BricksPerAxis, LocalCellPos);
+}
+
 void UFluidChunk::StoreMeshData(const TArray<FVector>& Vertices, const TArray<int32>& Triangles, 
 								const TArray<FVector>& Normals, const TArray<FVector2D>& UVs, 
 								const TArray<FColor>& VertexColors, float IsoLevel, int32 LODLevel)
@@ -1563,6 +2419,10 @@ void UFluidChunk::ConvertToSparse()
 			ActiveCellIndices.Add(i);
 			NonEmptyCells++;
 		}
+		else if (Cell.FluidLevel != 0.0f)
+		{
+			MassFlows.Add(EFluidMassCategory::MinLevelClamp, -Cell.FluidLevel);
+		}
 	}
 	
 	// Calculate occupancy
@@ -1737,14 +2597,7 @@ int32 UFluidChunk::GetSparseMemoryUsage() const
 {
 	if (bUseSparseRepresentation)
 	{
-		// Each sparse cell entry: key (4 bytes) + value (sizeof(FCAFluidCell))
-		const int32 PerCellMemory = sizeof(int32) + sizeof(FCAFluidCell);
-		const int32 DataMemory = SparseCells.Num() * PerCellMemory;
-		
-		// Overhead for hash table (roughly 2x the data)
-		const int32 HashOverhead = SparseCells.Num() * sizeof(int32) * 2;
-		
-		return DataMemory + HashOverhead;
+		return (int32)GetSparseAllocatedSize();
 	}
 	else
 	{
@@ -1752,12 +2605,48 @@ int32 UFluidChunk::GetSparseMemoryUsage() const
 	}
 }
 
+SIZE_T UFluidChunk::GetSparseAllocatedSize() const
+{
+	// Allocated, including hash buckets and slack
+	SIZE_T Bytes = SparseCells.GetAllocatedSize() + SparseNextCells.GetAllocatedSize() + ActiveCellIndices.GetAllocatedSize();
+	Bytes += SparseBlocks.GetAllocatedSize();
+	for (const FSparseFluidBlock& Block : SparseBlocks)
+	{
+		Bytes += Block.Cells.GetAllocatedSize();
+	}
+	return Bytes;
+}
+
 int32 UFluidChunk::GetDenseMemoryUsage() const
 {
 	const int32 TotalCells = ChunkSize * ChunkSize * ChunkSize;
 	return TotalCells * sizeof(FCAFluidCell) * 2; // Cells + NextCells
 }
 
+void UFluidChunk::ReportMemory(FFluidMemoryReport& Report) const
+{
+	Report.Add(EFluidMemoryCategory::ChunkCells, sizeof(UFluidChunk) + Cells.GetAllocatedSize() + NextCells.GetAllocatedSize());
+	if (CoarseGrid)
+	{
+		Report.Add(EFluidMemoryCategory::ChunkCells, sizeof(UCAFluidGrid) + CoarseGrid->Cells.GetAllocatedSize() + CoarseGrid->NextCells.GetAllocatedSize()
+			+ CoarseGrid->CellNeedsUpdate.GetAllocatedSize() + CoarseStartLevels.GetAllocatedSize());
+	}
+
+	Report.Add(EFluidMemoryCategory::ChunkSparse, GetSparseAllocatedSize());
+
+	const FChunkBorderData& Border = PendingBorderData;
+	Report.Add(EFluidMemoryCategory::ChunkBorders, Border.PositiveX.GetAllocatedSize() + Border.NegativeX.GetAllocatedSize()
+		+ Border.PositiveY.GetAllocatedSize() + Border.NegativeY.GetAllocatedSize()
+		+ Border.PositiveZ.GetAllocatedSize() + Border.NegativeZ.GetAllocatedSize()
+		+ ActiveNeighbors.GetAllocatedSize());
+
+	Report.Add(EFluidMemoryCategory::ChunkFlow, FlowField.Flux.GetAllocatedSize() + FlowField.Velocity.GetAllocatedSize()
+		+ ColumnSegments.GetAllocatedSize() + ColumnSegmentStart.GetAllocatedSize() + BodySegments.GetAllocatedSize());
+
+	Report.Add(EFluidMemoryCategory::ChunkMeshCache, StoredMeshData.Vertices.GetAllocatedSize() + StoredMeshData.Triangles.GetAllocatedSize()
+		+ StoredMeshData.Normals.GetAllocatedSize() + StoredMeshData.UVs.GetAllocatedSize() + StoredMeshData.VertexColors.GetAllocatedSize());
+}
+
 float UFluidChunk::GetCompressionRatio() const
 {
 	if (!bUseSparseRepresentation)
@@ -1,8 +1,11 @@
 #include "CellularAutomata/FluidChunkManager.h"
 #include "CellularAutomata/StaticWaterBody.h"
+#include "CellularAutomata/FluidBulkEdit.h"
 #include "VoxelFluidStats.h"
 #include "VoxelFluidDebug.h"
+#include "VoxelFluidProfiler.h"
 #include "DrawDebugHelpers.h"
+#include "ConvexVolume.h"
 #include "Engine/World.h"
 #include "Async/ParallelFor.h"
 #include "Actors/VoxelFluidActor.h"
@@ -27,6 +30,43 @@ UFluidChunkManager::UFluidChunkManager()
 	StreamingConfig.MaxChunksToProcessPerFrame = 8;
 }
 
+void UFluidChunkManager::BeginDestroy()
+{
+	FFluidMemoryTracker::Unregister(this);
+	Super::BeginDestroy();
+}
+
+void UFluidChunkManager::ReportMemory(FFluidMemoryReport& Report) const
+{
+	for (const auto& Pair : LoadedChunks)
+	{
+		if (Pair.Value)
+		{
+			Pair.Value->ReportMemory(Report);
+		}
+	}
+
+	{
+		FScopeLock Lock(&CacheMutex);
+		SIZE_T CacheBytes = ChunkCache.GetAllocatedSize();
+		for (const auto& CachePair : ChunkCache)
+		{
+			CacheBytes += CachePair.Value.Data.CompressedCells.GetAllocatedSize();
+		}
+		Report.Add(EFluidMemoryCategory::ChunkPersistence, CacheBytes + ChunkLastSaveTime.GetAllocatedSize());
+	}
+
+	Report.Add(EFluidMemoryCategory::ChunkBookkeeping, sizeof(UFluidChunkManager) + LoadedChunks.GetAllocatedSize() + ChunkIndex.GetAllocatedSize()
+		+ ActiveChunkCoords.GetAllocatedSize() + InactiveChunkCoords.GetAllocatedSize() + BorderOnlyChunkCoords.GetAllocatedSize()
+		+ ChunkLoadTimes.GetAllocatedSize() + ChunkStateHistory.GetAllocatedSize()
+		+ EditActivation.GetAllocatedSize());
+
+	if (StaticWaterManager)
+	{
+		StaticWaterManager->ReportMemory(Report);
+	}
+}
+
 void UFluidChunkManager::Initialize(int32 InChunkSize, float InCellSize, const FVector& InWorldOrigin, const FVector& InWorldSize)
 {
 	if (bIsInitialized)
@@ -34,6 +74,9 @@ void UFluidChunkManager::Initialize(int32 InChunkSize, float InCellSize, const F
 		ClearAllChunks();
 	}
 
+	FFluidMemoryTracker::Register(this);
+	EditActivation.SetCheckInterval(SettledChunkCheckInterval);
+
 	ChunkSize = FMath::Max(1, InChunkSize);
 	CellSize = FMath::Max(1.0f, InCellSize);
 	WorldOrigin = InWorldOrigin;
@@ -70,6 +113,7 @@ void UFluidChunkManager::UpdateChunks(float DeltaTime, const TArray<FVector>& Vi
 		return;
 
 	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_ChunkManagerUpdate);
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(&FrameProfiler, EFluidFramePhase::Streaming);
 
 	ChunkUpdateTimer += DeltaTime;
 	if (ChunkUpdateTimer >= StreamingConfig.ChunkUpdateInterval)
@@ -129,6 +173,9 @@ void UFluidChunkManager::UpdateChunks(float DeltaTime, const TArray<FVector>& Vi
 
 		// === Fluid Cell Statistics ===
 		SET_DWORD_STAT(STAT_VoxelFluid_ActiveCells, CachedStats.TotalActiveCells);
+
+		// Every registered subsystem, not just this manager; refreshes the memory stats and high-water marks
+		FFluidMemoryTracker::Capture();
 		// SET_DWORD_STAT(STAT_VoxelFluid_TotalCells, CachedStats.TotalChunks * ChunkSize * ChunkSize * ChunkSize); // Hidden - use TotalVolume instead
 		// SET_FLOAT_STAT(STAT_VoxelFluid_TotalVolume, CachedStats.TotalFluidVolume); // Hidden - not in top 20
 
@@ -207,6 +254,8 @@ void UFluidChunkManager::UpdateSimulation(float DeltaTime)
 	if (!bIsInitialized || !IsValidLowLevel())
 		return;
 
+	LastStepTimings = FFluidStepTimings();
+
 	// Skip fluid simulation if we're in the middle of chunk operations
 	if (bFreezeFluidForChunkOps)
 	{
@@ -219,6 +268,17 @@ void UFluidChunkManager::UpdateSimulation(float DeltaTime)
 	}
 
 	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_UpdateSimulation);
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(&FrameProfiler, EFluidFramePhase::Simulation);
+	const bool bProfileChunks = FrameProfiler.IsEnabled() || ChunkProfiler.IsEnabled();
+	VOXELFLUID_ALLOC_SCOPE("SimulationGather");
+
+	double PhaseStart = FPlatformTime::Seconds();
+	auto EndPhase = [&PhaseStart](double& OutMs)
+	{
+		const double Now = FPlatformTime::Seconds();
+		OutMs += (Now - PhaseStart) * 1000.0;
+		PhaseStart = Now;
+	};
 
 	TArray<UFluidChunk*> ActiveChunkArray = GetActiveChunks();
 
@@ -232,6 +292,11 @@ void UFluidChunkManager::UpdateSimulation(float DeltaTime)
 		{
 			ChunksNeedingUpdate.Add(Chunk);
 		}
+		else if (Chunk && !Chunk->Activity.bValid)
+		{
+			// Too little fluid to ever step; region metrics still need to see it as still
+			Chunk->SetIdleActivity();
+		}
 	}
 
 	// Update critical performance stats
@@ -263,25 +328,44 @@ void UFluidChunkManager::UpdateSimulation(float DeltaTime)
 	// SET_DWORD_STAT(STAT_VoxelFluid_StaticWaterCells, StaticWaterCells); // Hidden - not in top 20
 	// SET_FLOAT_STAT(STAT_VoxelFluid_TotalVolume, TotalVolume); // Hidden - not in top 20
 
+	EndPhase(LastStepTimings.GatherMs);
 
 	// Use optimized parallel processing
 	if (ChunksNeedingUpdate.Num() > 2)
 	{
+		LastStepTimings.ChunksSimulated = ChunksNeedingUpdate.Num();
+
 		// Process all chunks in parallel with optimized thread count
-		const int32 OptimalThreads = FMath::Min(8, FMath::Max(1, FPlatformMisc::NumberOfCoresIncludingHyperthreads() * 3 / 4));
-		const int32 BatchSize = FMath::Max(1, ChunksNeedingUpdate.Num() / OptimalThreads);
+		// An explicit limit rounds the batches up so there are never more batches, and so workers, than threads
+		const int32 OptimalThreads = MaxSimulationThreads > 0 ? MaxSimulationThreads :
+			FMath::Min(8, FMath::Max(1, FPlatformMisc::NumberOfCoresIncludingHyperthreads() * 3 / 4));
+		const int32 BatchSize = MaxSimulationThreads > 0 ? FMath::DivideAndRoundUp(ChunksNeedingUpdate.Num(), OptimalThreads) :
+			FMath::Max(1, ChunksNeedingUpdate.Num() / OptimalThreads);
 
 		ParallelFor(TEXT("FluidChunkUpdate"), ChunksNeedingUpdate.Num(), BatchSize, [&](int32 Index)
 		{
-			if (ChunksNeedingUpdate[Index])
+			UFluidChunk* Chunk = ChunksNeedingUpdate[Index];
+			if (!Chunk)
+			{
+				return;
+			}
+
+			// Worker time overlaps, so chunks are only attributed here; the phase total is the scope above
+			const double ChunkStart = bProfileChunks ? FPlatformTime::Seconds() : 0.0;
+			Chunk->UpdateSimulation(DeltaTime);
+			if (bProfileChunks)
 			{
-				ChunksNeedingUpdate[Index]->UpdateSimulation(DeltaTime);
+				const double ChunkMs = (FPlatformTime::Seconds() - ChunkStart) * 1000.0;
+				FrameProfiler.NoteChunk(EFluidFramePhase::Simulation, Chunk->ChunkCoord, ChunkMs);
+				ChunkProfiler.RecordStep(Chunk->ChunkCoord, ChunkMs, Chunk->Activity.CellsProcessed, Chunk->Activity.UnsettledCellCount);
 			}
-		}, EParallelForFlags::None);
+		}, OptimalThreads == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+		EndPhase(LastStepTimings.ChunkUpdateMs);
 
 		// Synchronize borders - can also be done in parallel for non-conflicting chunks
 		// For now, using serial synchronization to avoid race conditions
 		SynchronizeChunkBorders();
+		EndPhase(LastStepTimings.BorderSyncMs);
 
 		// Finalize simulation step by swapping buffers
 		for (UFluidChunk* Chunk : ActiveChunkArray)
@@ -291,6 +375,7 @@ void UFluidChunkManager::UpdateSimulation(float DeltaTime)
 				Chunk->FinalizeSimulationStep();
 			}
 		}
+		EndPhase(LastStepTimings.FinalizeMs);
 	}
 	else
 	{
@@ -309,15 +394,22 @@ void UFluidChunkManager::UpdateSimulation(float DeltaTime)
 			if (!Chunk) continue;
 			HighActivityChunks.Add(Chunk);
 		}
+		LastStepTimings.ChunksSimulated = HighActivityChunks.Num();
 
 		// Process high activity chunks
 		if (StreamingConfig.bUseAsyncLoading && HighActivityChunks.Num() > 4)
 		{
 			ParallelFor(HighActivityChunks.Num(), [&](int32 Index)
 			{
-				if (HighActivityChunks[Index])
+				if (UFluidChunk* Chunk = HighActivityChunks[Index])
 				{
-					HighActivityChunks[Index]->UpdateSimulation(DeltaTime);
+					const double ChunkStart = bProfileChunks ? FPlatformTime::Seconds() : 0.0;
+					Chunk->UpdateSimulation(DeltaTime);
+					if (bProfileChunks)
+					{
+						ChunkProfiler.RecordStep(Chunk->ChunkCoord, (FPlatformTime::Seconds() - ChunkStart) * 1000.0,
+							Chunk->Activity.CellsProcessed, Chunk->Activity.UnsettledCellCount);
+					}
 				}
 			});
 		}
@@ -327,7 +419,16 @@ void UFluidChunkManager::UpdateSimulation(float DeltaTime)
 			{
 				if (Chunk)
 				{
-					Chunk->UpdateSimulation(DeltaTime);
+					const double ChunkStart = bProfileChunks ? FPlatformTime::Seconds() : 0.0;
+					{
+						FFluidFrameProfiler::FScopedPhase ChunkScope(&FrameProfiler, EFluidFramePhase::Simulation, Chunk->ChunkCoord);
+						Chunk->UpdateSimulation(DeltaTime);
+					}
+					if (bProfileChunks)
+					{
+						ChunkProfiler.RecordStep(Chunk->ChunkCoord, (FPlatformTime::Seconds() - ChunkStart) * 1000.0,
+							Chunk->Activity.CellsProcessed, Chunk->Activity.UnsettledCellCount);
+					}
 				}
 			}
 		}
@@ -350,8 +451,11 @@ void UFluidChunkManager::UpdateSimulation(float DeltaTime)
 			}
 		}
 
+		EndPhase(LastStepTimings.ChunkUpdateMs);
+
 		// Synchronize borders
 		SynchronizeChunkBorders();
+		EndPhase(LastStepTimings.BorderSyncMs);
 
 		// Finalize simulation step by swapping buffers for all chunks
 		for (UFluidChunk* Chunk : ActiveChunkArray)
@@ -361,6 +465,13 @@ void UFluidChunkManager::UpdateSimulation(float DeltaTime)
 				Chunk->FinalizeSimulationStep();
 			}
 		}
+		EndPhase(LastStepTimings.FinalizeMs);
+	}
+	FrameProfiler.RecordStep(LastStepTimings.GetTotalMs());
+
+	if (MassLedger.IsEnabled())
+	{
+		MassLedger.OnStep(GetLoadedChunks());
 	}
 }
 
@@ -390,10 +501,14 @@ UFluidChunk* UFluidChunkManager::GetOrCreateChunk(const FFluidChunkCoord& Coord)
 	Chunk->Viscosity = Viscosity;
 	Chunk->Gravity = Gravity;
 	Chunk->EvaporationRate = EvaporationRate;
+	Chunk->bUseColumnPressure = bUseColumnPressure;
+	Chunk->ColumnPressureRelaxation = ColumnPressureRelaxation;
+	Chunk->MaxColumnHeadChange = MaxColumnHeadChange;
 
 	// Enable sparse representation if configured
 
 	LoadedChunks.Add(Coord, Chunk);
+	ChunkIndex.Add(Coord);
 	InactiveChunkCoords.Add(Coord);
 
 
@@ -457,49 +572,199 @@ bool UFluidChunkManager::GetCellFromWorldPosition(const FVector& WorldPos, FFlui
 
 void UFluidChunkManager::AddFluidAtWorldPosition(const FVector& WorldPos, float Amount)
 {
-	UE_LOG(LogTemp, Warning, TEXT("FluidChunkManager::AddFluidAtWorldPosition called at %s with amount %f"), *WorldPos.ToString(), Amount);
-	
 	// Get chunk coordinate directly - don't require chunk to exist for coordinate calculation
 	FFluidChunkCoord ChunkCoord = GetChunkCoordFromWorldPosition(WorldPos);
-	UE_LOG(LogTemp, Warning, TEXT("FluidChunkManager: Position maps to chunk %s"), *ChunkCoord.ToString());
 	
 	// Create or get the chunk
 	UFluidChunk* Chunk = GetOrCreateChunk(ChunkCoord);
 	if (!Chunk)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("FluidChunkManager: Failed to get or create chunk %s!"), *ChunkCoord.ToString());
+		VOXELFLUID_LOG(LogVoxelFluidSim, Warning, TEXT("FluidChunkManager: Failed to get or create chunk %s!"), *ChunkCoord.ToString());
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("FluidChunkManager: Got chunk %s, current state: %d"), *ChunkCoord.ToString(), (int32)Chunk->State);
-	
 	// Ensure chunk is loaded
 	if (Chunk->State == EChunkState::Unloaded)
 	{
 		Chunk->LoadChunk();
-		UE_LOG(LogTemp, Warning, TEXT("FluidChunkManager: Loaded chunk %s"), *ChunkCoord.ToString());
+		VOXELFLUID_TRACE(ChunkLoaded, ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z);
 	}
 	
 	// Convert world position to local chunk coordinates
 	int32 LocalX, LocalY, LocalZ;
 	if (!Chunk->GetLocalFromWorldPosition(WorldPos, LocalX, LocalY, LocalZ))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("FluidChunkManager: Failed to convert world position %s to local coordinates in chunk %s"), *WorldPos.ToString(), *ChunkCoord.ToString());
+		VOXELFLUID_LOG(LogVoxelFluidSim, Warning, TEXT("FluidChunkManager: Failed to convert world position %s to local coordinates in chunk %s"), *WorldPos.ToString(), *ChunkCoord.ToString());
 		return;
 	}
 	
 	// Add the fluid
 	Chunk->AddFluid(LocalX, LocalY, LocalZ, Amount);
-	UE_LOG(LogTemp, Warning, TEXT("FluidChunkManager: Added %f fluid to chunk %s at local (%d,%d,%d)"), Amount, *ChunkCoord.ToString(), LocalX, LocalY, LocalZ);
+	VOXELFLUID_TRACE(FluidAdded, ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z, Amount);
+	VOXELFLUID_LOG(LogVoxelFluidSim, VeryVerbose, TEXT("FluidChunkManager: Added %f fluid to chunk %s at local (%d,%d,%d)"), Amount, *ChunkCoord.ToString(), LocalX, LocalY, LocalZ);
 
 	// Activate chunk if needed
 	if (Chunk->State == EChunkState::Inactive)
 	{
 		ActivateChunk(Chunk);
-		UE_LOG(LogTemp, Warning, TEXT("FluidChunkManager: Activated chunk %s"), *ChunkCoord.ToString());
 	}
 }
 
+void UFluidChunkManager::PrepareChunksForBulkFill(const TArray<FFluidChunkCoord>& Coords)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_ChunkStateChange);
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	const bool bTrackEditActivation = StreamingConfig.ActivationMode != EChunkActivationMode::DistanceBased;
+
+	// Callers pass coords in dependency order (lowest layer first) so the chunk a column drains into is always live
+	for (const FFluidChunkCoord& Coord : Coords)
+	{
+		UFluidChunk* Chunk = GetOrCreateChunk(Coord);
+		if (!Chunk)
+			continue;
+
+		if (Chunk->State == EChunkState::Unloaded)
+		{
+			LoadChunk(Coord);
+		}
+
+		if (Chunk->State != EChunkState::Active)
+		{
+			ActivateChunk(Chunk);
+		}
+
+		// Let settled-chunk tracking put these back to sleep like any other edit
+		if (bTrackEditActivation)
+		{
+			EditActivation.Activate(Coord, CurrentTime);
+		}
+	}
+}
+
+float UFluidChunkManager::FillChunkColumnsBulk(const TArray<FFluidChunkCoord>& Coords, const TArray<TArray<FFluidColumnSpan>>& ColumnSpans, TArray<float>* OutChunkVolumes)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_StaticWaterApply);
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(&FrameProfiler, EFluidFramePhase::StaticWater);
+
+	if (Coords.Num() != ColumnSpans.Num())
+		return 0.0f;
+
+	// Resolve chunks once up front so workers never touch the chunk map
+	TArray<UFluidChunk*> Chunks;
+	Chunks.SetNumZeroed(Coords.Num());
+	{
+		FScopeLock Lock(&ChunkMapMutex);
+		for (int32 i = 0; i < Coords.Num(); ++i)
+		{
+			if (UFluidChunk** ChunkPtr = LoadedChunks.Find(Coords[i]))
+			{
+				Chunks[i] = *ChunkPtr;
+			}
+		}
+	}
+
+	TArray<float> ChunkVolumes;
+	ChunkVolumes.SetNumZeroed(Coords.Num());
+
+	// Each chunk owns its cell buffers, so columns of different chunks can be written concurrently
+	ParallelFor(Chunks.Num(), [&](int32 Index)
+	{
+		UFluidChunk* Chunk = Chunks[Index];
+		if (Chunk && Chunk->State != EChunkState::Unloaded)
+		{
+			ChunkVolumes[Index] = Chunk->FillColumnsFromSpans(ColumnSpans[Index]);
+		}
+	});
+
+	float TotalVolume = 0.0f;
+	for (const float Volume : ChunkVolumes)
+	{
+		TotalVolume += Volume;
+	}
+
+	if (OutChunkVolumes)
+	{
+		*OutChunkVolumes = MoveTemp(ChunkVolumes);
+	}
+
+	return TotalVolume;
+}
+
+FVector UFluidChunkManager::GetChunkWorldPosition(const FFluidChunkCoord& Coord) const
+{
+	const float ChunkWorldSize = ChunkSize * CellSize;
+	return WorldOrigin + FVector(Coord.X * ChunkWorldSize, Coord.Y * ChunkWorldSize, Coord.Z * ChunkWorldSize);
+}
+
+FFluidBulkEditResult UFluidChunkManager::ApplyBulkEdit(const FFluidBulkEdit& Edit)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_ChunkStateChange);
+
+	FFluidBulkEditResult Result;
+	if (Edit.IsEmpty())
+		return Result;
+
+	// Resolve chunks up front; draining never creates chunks that do not exist yet
+	TArray<UFluidChunk*> Chunks;
+	TArray<const FFluidChunkCellEdits*> ChunkEdits;
+	Chunks.Reserve(Edit.GetChunkEdits().Num());
+	ChunkEdits.Reserve(Edit.GetChunkEdits().Num());
+
+	for (const auto& Pair : Edit.GetChunkEdits())
+	{
+		const bool bCreates = Pair.Value.Ops.ContainsByPredicate([](EFluidEditOp Op) { return Op != EFluidEditOp::Remove; });
+		UFluidChunk* Chunk = bCreates ? GetOrCreateChunk(Pair.Key) : GetChunk(Pair.Key);
+		if (!Chunk)
+			continue;
+
+		if (Chunk->State == EChunkState::Unloaded)
+		{
+			if (!bCreates)
+				continue;
+			Chunk->LoadChunk();
+		}
+
+		Chunks.Add(Chunk);
+		ChunkEdits.Add(&Pair.Value);
+		Result.CellsEdited += Pair.Value.Num();
+	}
+
+	TArray<float> Added;
+	TArray<float> Removed;
+	TArray<bool> Changed;
+	Added.SetNumZeroed(Chunks.Num());
+	Removed.SetNumZeroed(Chunks.Num());
+	Changed.SetNumZeroed(Chunks.Num());
+
+	ParallelFor(Chunks.Num(), [&](int32 Index)
+	{
+		Changed[Index] = Chunks[Index]->ApplyCellEdits(*ChunkEdits[Index], Added[Index], Removed[Index]);
+	});
+
+	TArray<FFluidChunkCoord> ChangedCoords;
+	for (int32 i = 0; i < Chunks.Num(); ++i)
+	{
+		if (!Changed[i])
+			continue;
+
+		Result.VolumeAdded += Added[i];
+		Result.VolumeRemoved += Removed[i];
+		++Result.ChunksChanged;
+
+		if (Chunks[i]->State != EChunkState::Active)
+		{
+			ActivateChunk(Chunks[i]);
+		}
+		ChangedCoords.Add(Chunks[i]->ChunkCoord);
+	}
+
+	// Edited chunks simulate until they settle, like an edit activation
+	RetainChunksUntilSettled(ChangedCoords);
+
+	return Result;
+}
+
 void UFluidChunkManager::RemoveFluidAtWorldPosition(const FVector& WorldPos, float Amount)
 {
 	FFluidChunkCoord ChunkCoord;
@@ -540,6 +805,32 @@ float UFluidChunkManager::GetFluidAtWorldPosition(const FVector& WorldPos) const
 	return 0.0f;
 }
 
+FVector UFluidChunkManager::GetFlowVelocityAtWorldPosition(const FVector& WorldPos) const
+{
+	FScopeLock Lock(&const_cast<UFluidChunkManager*>(this)->ChunkMapMutex);
+
+	UFluidChunk* Chunk = const_cast<UFluidChunkManager*>(this)->GetChunk(GetChunkCoordFromWorldPosition(WorldPos));
+	if (Chunk && IsValid(Chunk) && Chunk->State != EChunkState::Unloaded)
+	{
+		return Chunk->SampleFlowVelocity(WorldPos);
+	}
+
+	return FVector::ZeroVector;
+}
+
+FVector UFluidChunkManager::GetFlowFluxAtWorldPosition(const FVector& WorldPos) const
+{
+	FScopeLock Lock(&const_cast<UFluidChunkManager*>(this)->ChunkMapMutex);
+
+	UFluidChunk* Chunk = const_cast<UFluidChunkManager*>(this)->GetChunk(GetChunkCoordFromWorldPosition(WorldPos));
+	if (Chunk && IsValid(Chunk) && Chunk->State != EChunkState::Unloaded)
+	{
+		return Chunk->SampleFlowFlux(WorldPos);
+	}
+
+	return FVector::ZeroVector;
+}
+
 void UFluidChunkManager::SetTerrainHeightAtWorldPosition(const FVector& WorldPos, float Height)
 {
 	FFluidChunkCoord ChunkCoord;
@@ -588,28 +879,77 @@ TArray<UFluidChunk*> UFluidChunkManager::GetActiveChunks() const
 	return Result;
 }
 
-TArray<UFluidChunk*> UFluidChunkManager::GetVisibleChunks() const
+TArray<UFluidChunk*> UFluidChunkManager::GetLoadedChunks() const
 {
-	// For now, just return the same as GetActiveChunks - no optimizations
-	return GetActiveChunks();
+	TArray<UFluidChunk*> Result;
+	LoadedChunks.GenerateValueArray(Result);
+	return Result;
+}
+
+TArray<UFluidChunk*> UFluidChunkManager::GetVisibleChunks(const FVector& ViewLocation, float MaxDistance, const FConvexVolume* ViewFrustum) const
+{
+	TArray<UFluidChunk*> Result;
+	const float MaxDistanceSq = MaxDistance * MaxDistance;
+
+	for (UFluidChunk* Chunk : GetLoadedChunksInBounds(FBox(ViewLocation - FVector(MaxDistance), ViewLocation + FVector(MaxDistance))))
+	{
+		if (!ActiveChunkCoords.Contains(Chunk->ChunkCoord))
+			continue;
+
+		const FBox ChunkBounds = Chunk->GetWorldBounds();
+		if (ChunkBounds.ComputeSquaredDistanceToPoint(ViewLocation) > MaxDistanceSq)
+			continue;
+
+		if (ViewFrustum && !ViewFrustum->IntersectBox(ChunkBounds.GetCenter(), ChunkBounds.GetExtent()))
+			continue;
+
+		Result.Add(Chunk);
+	}
+
+	return Result;
 }
 
 TArray<UFluidChunk*> UFluidChunkManager::GetChunksInRadius(const FVector& Center, float Radius) const
 {
-	// Linear search
 	TArray<UFluidChunk*> Result;
 	const float RadiusSq = Radius * Radius;
 
-	for (const auto& Pair : LoadedChunks)
+	for (UFluidChunk* Chunk : GetLoadedChunksInBounds(FBox(Center - FVector(Radius), Center + FVector(Radius))))
 	{
-		if (Pair.Value)
+		if (Chunk->GetWorldBounds().ComputeSquaredDistanceToPoint(Center) <= RadiusSq)
 		{
-			const FBox ChunkBounds = Pair.Value->GetWorldBounds();
-			const float DistSq = ChunkBounds.ComputeSquaredDistanceToPoint(Center);
+			Result.Add(Chunk);
+		}
+	}
 
-			if (DistSq <= RadiusSq)
+	return Result;
+}
+
+TArray<UFluidChunk*> UFluidChunkManager::GetLoadedChunksInBounds(const FBox& Bounds) const
+{
+	TArray<UFluidChunk*> Result;
+
+	if (!bIsInitialized || !Bounds.IsValid)
+		return Result;
+
+	const float ChunkWorldSize = ChunkSize * CellSize;
+	const FVector MinChunk = (Bounds.Min - WorldOrigin) / ChunkWorldSize;
+	const FVector MaxChunk = (Bounds.Max - WorldOrigin) / ChunkWorldSize;
+
+	TArray<FFluidChunkCoord> Coords;
+	ChunkIndex.QueryRange(
+		FIntVector(FMath::FloorToInt(MinChunk.X), FMath::FloorToInt(MinChunk.Y), FMath::FloorToInt(MinChunk.Z)),
+		FIntVector(FMath::FloorToInt(MaxChunk.X), FMath::FloorToInt(MaxChunk.Y), FMath::FloorToInt(MaxChunk.Z)),
+		Coords);
+
+	Result.Reserve(Coords.Num());
+	for (const FFluidChunkCoord& Coord : Coords)
+	{
+		if (UFluidChunk* const* ChunkPtr = LoadedChunks.Find(Coord))
+		{
+			if (*ChunkPtr)
 			{
-				Result.Add(Pair.Value);
+				Result.Add(*ChunkPtr);
 			}
 		}
 	}
@@ -691,6 +1031,11 @@ FChunkManagerStats UFluidChunkManager::GetStats() const
 
 	Stats.AverageChunkUpdateTime = ActiveChunkCount > 0 ? TotalUpdateTime / ActiveChunkCount : 0.0f;
 
+	ReportMemory(Stats.Memory);
+	Stats.MemoryBytes = Stats.Memory.GetTotal();
+	PeakMemoryBytes = FMath::Max(PeakMemoryBytes, Stats.MemoryBytes);
+	Stats.PeakMemoryBytes = PeakMemoryBytes;
+
 	return Stats;
 }
 
@@ -774,6 +1119,7 @@ void UFluidChunkManager::UpdateChunkStates(const TArray<FVector>& ViewerPosition
 	if (ViewerPositions.Num() == 0)
 		return;
 
+	VOXELFLUID_ALLOC_SCOPE("ChunkStates");
 	TSet<FFluidChunkCoord> ChunksToActivate;
 	TSet<FFluidChunkCoord> ChunksToDeactivate;
 	TSet<FFluidChunkCoord> ChunksToLoad;
@@ -916,6 +1262,10 @@ void UFluidChunkManager::UpdateChunkLODs(const TArray<FVector>& ViewerPositions)
 				LODLevel = 1;
 			}
 
+			Pair.Value->bCoarseLODSimulation = StreamingConfig.bCoarseLODSimulation;
+			Pair.Value->bUseColumnPressure = bUseColumnPressure;
+			Pair.Value->ColumnPressureRelaxation = ColumnPressureRelaxation;
+			Pair.Value->MaxColumnHeadChange = MaxColumnHeadChange;
 			Pair.Value->SetLODLevel(LODLevel);
 		}
 	}
@@ -924,10 +1274,14 @@ void UFluidChunkManager::UpdateChunkLODs(const TArray<FVector>& ViewerPositions)
 void UFluidChunkManager::SynchronizeChunkBorders()
 {
 	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_BorderSync);
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(&FrameProfiler, EFluidFramePhase::BorderSync);
+	VOXELFLUID_ALLOC_SCOPE("BorderSync");
 
 	// Removed terrain synchronization - too expensive and not solving the problem
 	// SynchronizeChunkBorderTerrain();
 
+	const bool bProfileChunks = ChunkProfiler.IsEnabled();
+
 	// Create a set to track processed chunk pairs to avoid duplicate processing
 	TSet<FString> ProcessedPairs;
 
@@ -967,7 +1321,18 @@ void UFluidChunkManager::SynchronizeChunkBorders()
 			{
 				// Process flow only once per chunk pair
 				// The ProcessCrossChunkFlow function handles bidirectional flow internally
-				ProcessCrossChunkFlow(Chunk, Neighbor, 0.016f);
+				const double PairStart = bProfileChunks ? FPlatformTime::Seconds() : 0.0;
+				{
+					FFluidFrameProfiler::FScopedPhase PairScope(&FrameProfiler, EFluidFramePhase::BorderSync, Coord);
+					ProcessCrossChunkFlow(Chunk, Neighbor, 0.016f);
+				}
+				if (bProfileChunks)
+				{
+					// The pair's cost is split so per-chunk totals still add up to the phase
+					const double HalfMs = (FPlatformTime::Seconds() - PairStart) * 500.0;
+					ChunkProfiler.RecordBorderSync(Coord, HalfMs);
+					ChunkProfiler.RecordBorderSync(NeighborCoord, HalfMs);
+				}
 				ProcessedPairs.Add(PairKey);
 			}
 		}
@@ -1220,6 +1585,9 @@ void UFluidChunkManager::ProcessCrossChunkFlow(UFluidChunk* ChunkA, UFluidChunk*
 								{
 									SourceCell->FluidLevel -= ActualFlow;
 									TargetCell->FluidLevel += ActualFlow;
+									SourceChunk->MassFlows.Add(EFluidMassCategory::Transfer, -ActualFlow);
+									TargetChunk->MassFlows.Add(EFluidMassCategory::Transfer, ActualFlow);
+									SourceChunk->RecordBorderFlow(HeightDiff > 0 ? IdxA : IdxB, FVector3f(DiffX, DiffY, DiffZ) * (HeightDiff > 0 ? ActualFlow : -ActualFlow));
 
 									// Wake up the border cells
 									SourceCell->bSettled = false;
@@ -1277,6 +1645,9 @@ void UFluidChunkManager::ProcessCrossChunkFlow(UFluidChunk* ChunkA, UFluidChunk*
 								{
 									SourceCell->FluidLevel -= ActualFlow;
 									TargetCell->FluidLevel += ActualFlow;
+									SourceChunk->MassFlows.Add(EFluidMassCategory::Transfer, -ActualFlow);
+									TargetChunk->MassFlows.Add(EFluidMassCategory::Transfer, ActualFlow);
+									SourceChunk->RecordBorderFlow(HeightDiff > 0 ? IdxA : IdxB, FVector3f(DiffX, DiffY, DiffZ) * (HeightDiff > 0 ? ActualFlow : -ActualFlow));
 
 									SourceCell->bSettled = false;
 									SourceCell->SettledCounter = 0;
@@ -1333,6 +1704,9 @@ void UFluidChunkManager::ProcessCrossChunkFlow(UFluidChunk* ChunkA, UFluidChunk*
 								{
 									SourceCell->FluidLevel -= ActualFlow;
 									TargetCell->FluidLevel += ActualFlow;
+									SourceChunk->MassFlows.Add(EFluidMassCategory::Transfer, -ActualFlow);
+									TargetChunk->MassFlows.Add(EFluidMassCategory::Transfer, ActualFlow);
+									SourceChunk->RecordBorderFlow(HeightDiff > 0 ? IdxA : IdxB, FVector3f(DiffX, DiffY, DiffZ) * (HeightDiff > 0 ? ActualFlow : -ActualFlow));
 
 									SourceCell->bSettled = false;
 									SourceCell->SettledCounter = 0;
@@ -1389,6 +1763,9 @@ void UFluidChunkManager::ProcessCrossChunkFlow(UFluidChunk* ChunkA, UFluidChunk*
 								{
 									SourceCell->FluidLevel -= ActualFlow;
 									TargetCell->FluidLevel += ActualFlow;
+									SourceChunk->MassFlows.Add(EFluidMassCategory::Transfer, -ActualFlow);
+									TargetChunk->MassFlows.Add(EFluidMassCategory::Transfer, ActualFlow);
+									SourceChunk->RecordBorderFlow(HeightDiff > 0 ? IdxA : IdxB, FVector3f(DiffX, DiffY, DiffZ) * (HeightDiff > 0 ? ActualFlow : -ActualFlow));
 
 									SourceCell->bSettled = false;
 									SourceCell->SettledCounter = 0;
@@ -1432,6 +1809,9 @@ void UFluidChunkManager::ProcessCrossChunkFlow(UFluidChunk* ChunkA, UFluidChunk*
 						{
 							ChunkA->NextCells[IdxA].FluidLevel -= PossibleFlow;
 							ChunkB->NextCells[IdxB].FluidLevel += PossibleFlow;
+							ChunkA->MassFlows.Add(EFluidMassCategory::Transfer, -PossibleFlow);
+							ChunkB->MassFlows.Add(EFluidMassCategory::Transfer, PossibleFlow);
+							ChunkA->RecordBorderFlow(IdxA, FVector3f(0.0f, 0.0f, PossibleFlow));
 							ChunkA->bDirty = true;
 							ChunkB->bDirty = true;
 						}
@@ -1465,6 +1845,9 @@ void UFluidChunkManager::ProcessCrossChunkFlow(UFluidChunk* ChunkA, UFluidChunk*
 						{
 							ChunkA->NextCells[IdxA].FluidLevel -= PossibleFlow;
 							ChunkB->NextCells[IdxB].FluidLevel += PossibleFlow;
+							ChunkA->MassFlows.Add(EFluidMassCategory::Transfer, -PossibleFlow);
+							ChunkB->MassFlows.Add(EFluidMassCategory::Transfer, PossibleFlow);
+							ChunkA->RecordBorderFlow(IdxA, FVector3f(0.0f, 0.0f, -PossibleFlow));
 							ChunkA->bDirty = true;
 							ChunkB->bDirty = true;
 						}
@@ -1502,6 +1885,7 @@ void UFluidChunkManager::LoadChunk(const FFluidChunkCoord& Coord)
 	UFluidChunk* Chunk = GetOrCreateChunk(Coord);
 	if (Chunk && Chunk->State == EChunkState::Unloaded)
 	{
+		FFluidFrameProfiler::FScopedPhase ProfilerScope(&FrameProfiler, EFluidFramePhase::Streaming, Coord);
 		Chunk->LoadChunk();
 
 		// Try to restore from cache if persistence is enabled
@@ -1526,13 +1910,16 @@ void UFluidChunkManager::LoadChunk(const FFluidChunkCoord& Coord)
 			FBox ChunkBounds = Chunk->GetWorldBounds();
 			if (StaticWaterManager->ChunkIntersectsStaticWater(ChunkBounds))
 			{
+				FFluidFrameProfiler::FScopedPhase StaticWaterScope(&FrameProfiler, EFluidFramePhase::StaticWater, Coord);
 				StaticWaterManager->ApplyStaticWaterToChunk(Chunk);
 			}
 		}
 
 		// Track load time for debug
-		ChunkLoadTimes.Add(Coord, FPlatformTime::Seconds());
-		ChunkStateHistory.Add(Coord, FString::Printf(TEXT("Loaded at %.2fs"), FPlatformTime::Seconds()));
+		const double LoadTime = FPlatformTime::Seconds();
+		ChunkLoadTimes.Add(Coord, LoadTime);
+		ChunkStateHistory.Add(Coord, { TEXT("Loaded"), LoadTime });
+		VOXELFLUID_TRACE(ChunkLoaded, Coord.X, Coord.Y, Coord.Z);
 
 		OnChunkLoadedDelegate.Broadcast(Coord);
 	}
@@ -1541,6 +1928,7 @@ void UFluidChunkManager::LoadChunk(const FFluidChunkCoord& Coord)
 void UFluidChunkManager::UnloadChunk(const FFluidChunkCoord& Coord)
 {
 	FScopeLock Lock(&ChunkMapMutex);
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(&FrameProfiler, EFluidFramePhase::Streaming, Coord);
 
 	if (UFluidChunk** ChunkPtr = LoadedChunks.Find(Coord))
 	{
@@ -1581,17 +1969,22 @@ void UFluidChunkManager::UnloadChunk(const FFluidChunkCoord& Coord)
 			{
 			}
 
+			// A cached chunk may come back; anything else leaves the world with it
+			MassLedger.RetireChunk(*Chunk, StreamingConfig.bEnablePersistence);
+
 			Chunk->UnloadChunk();
 			ActiveChunkCoords.Remove(Coord);
 			InactiveChunkCoords.Remove(Coord);
 			BorderOnlyChunkCoords.Remove(Coord);
 
 
-			// Track unload time for debug
-			ChunkStateHistory.Add(Coord, FString::Printf(TEXT("Unloaded at %.2fs"), FPlatformTime::Seconds()));
+			// Unloaded chunks are not drawn, so their history only lives in the trace ring
+			ChunkStateHistory.Remove(Coord);
 			ChunkLoadTimes.Remove(Coord);
+			VOXELFLUID_TRACE(ChunkUnloaded, Coord.X, Coord.Y, Coord.Z);
 
 			LoadedChunks.Remove(Coord);
+			ChunkIndex.Remove(Coord);
 			OnChunkUnloadedDelegate.Broadcast(Coord);
 		}
 	}
@@ -1637,7 +2030,8 @@ void UFluidChunkManager::ActivateChunk(UFluidChunk* Chunk)
 		}
 
 		// Track activation for debug
-		ChunkStateHistory.Add(Coord, FString::Printf(TEXT("Activated at %.2fs"), FPlatformTime::Seconds()));
+		ChunkStateHistory.Add(Coord, { TEXT("Activated"), FPlatformTime::Seconds() });
+		VOXELFLUID_TRACE(ChunkActivated, Coord.X, Coord.Y, Coord.Z);
 
 		// Notify that the chunk has been activated (for terrain refresh)
 		OnChunkLoadedDelegate.Broadcast(Coord);
@@ -1658,7 +2052,8 @@ void UFluidChunkManager::DeactivateChunk(UFluidChunk* Chunk)
 		InactiveChunkCoords.Add(Coord);
 
 		// Track deactivation for debug
-		ChunkStateHistory.Add(Coord, FString::Printf(TEXT("Deactivated at %.2fs"), FPlatformTime::Seconds()));
+		ChunkStateHistory.Add(Coord, { TEXT("Deactivated"), FPlatformTime::Seconds() });
+		VOXELFLUID_TRACE(ChunkDeactivated, Coord.X, Coord.Y, Coord.Z);
 	}
 }
 
@@ -1812,9 +2207,9 @@ void UFluidChunkManager::DrawDebugChunks(UWorld* World) const
 
 			// Get state history
 			FString StateHistory = TEXT("No History");
-			if (const FString* HistoryPtr = ChunkStateHistory.Find(Coord))
+			if (const FChunkStateRecord* HistoryPtr = ChunkStateHistory.Find(Coord))
 			{
-				StateHistory = *HistoryPtr;
+				StateHistory = FString::Printf(TEXT("%s at %.2fs"), HistoryPtr->Label, HistoryPtr->Time);
 			}
 
 			// Check if chunk has cached mesh data
@@ -2061,6 +2456,8 @@ void UFluidChunkManager::TestPersistence(const FVector& WorldPos)
 		else
 		{
 		}
+
+		Chunk->MassFlows.Add(EFluidMassCategory::Persistence, Chunk->GetTotalFluidVolume() - VolumeBeforeSave);
 	}
 	else
 	{
@@ -2080,6 +2477,7 @@ void UFluidChunkManager::ForceActivateChunk(UFluidChunk* Chunk)
 	if (!LoadedChunks.Contains(Coord))
 	{
 		LoadedChunks.Add(Coord, Chunk);
+		ChunkIndex.Add(Coord);
 	}
 
 	// Call protected ActivateChunk method
@@ -2145,8 +2543,15 @@ bool UFluidChunkManager::ShouldUpdateChunk(UFluidChunk* Chunk) const
 		return false;
 	}
 
+	// Without a world clock (headless runs) every chunk holding fluid steps each update
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return true;
+	}
+
 	// Update chunks that haven't been updated recently
-	float TimeSinceLastUpdate = GetWorld() ? GetWorld()->GetTimeSeconds() - Chunk->LastUpdateTime : 0.0f;
+	float TimeSinceLastUpdate = World->GetTimeSeconds() - Chunk->LastUpdateTime;
 	return TimeSinceLastUpdate > 0.033f; // Update at least every 33ms (30 FPS)
 }
 
@@ -2160,7 +2565,8 @@ void UFluidChunkManager::OnVoxelEditOccurred(const FVector& EditLocation, float
 		return;
 	}
 
-	// Activate chunks in the edit radius
+	// Terrain edits arrive from the game thread while a step may be running; the tracker and chunk states need the lock
+	FScopeLock SimulationAccess(&SimulationLock);
 	ActivateChunksForEdit(EditLocation, EditRadius);
 }
 
@@ -2176,6 +2582,7 @@ void UFluidChunkManager::OnVoxelEditOccurredInBounds(const FBox& EditBounds)
 	FVector Center = EditBounds.GetCenter();
 	float Radius = EditBounds.GetExtent().GetMax();
 
+	FScopeLock SimulationAccess(&SimulationLock);
 	ActivateChunksForEdit(Center, Radius);
 }
 
@@ -2183,15 +2590,28 @@ void UFluidChunkManager::ActivateChunksForEdit(const FVector& EditLocation, floa
 {
 	// Use configured edit activation radius or the provided radius, whichever is larger
 	float ActivationRadius = FMath::Max(Radius, StreamingConfig.EditActivationRadius);
-	
-	// Find all chunks that could be affected by this edit
-	TArray<FFluidChunkCoord> AffectedChunks = GetChunksInBounds(
-		FBox(EditLocation - FVector(ActivationRadius), EditLocation + FVector(ActivationRadius))
-	);
+	const FBox ActivationBounds(EditLocation - FVector(ActivationRadius), EditLocation + FVector(ActivationRadius));
+	const double CurrentTime = FPlatformTime::Seconds();
 
-	float CurrentTime = FPlatformTime::Seconds();
+	// Repeated edits inside a region activated moments ago find every chunk already awake; none of them can
+	// have settled for the deactivation delay since
+	const float ChunkWorldSize = ChunkSize * CellSize;
+	const FVector MinChunk = (ActivationBounds.Min - WorldOrigin) / ChunkWorldSize;
+	const FVector MaxChunk = (ActivationBounds.Max - WorldOrigin) / ChunkWorldSize;
+	const double RegionMaxAge = FMath::Min((double)SettledChunkCheckInterval, StreamingConfig.SettledDeactivationDelay * 0.5);
+	if (!EditActivation.AddEditRegion(
+		FIntVector(FMath::FloorToInt(MinChunk.X), FMath::FloorToInt(MinChunk.Y), FMath::FloorToInt(MinChunk.Z)),
+		FIntVector(FMath::CeilToInt(MaxChunk.X), FMath::CeilToInt(MaxChunk.Y), FMath::CeilToInt(MaxChunk.Z)),
+		CurrentTime, RegionMaxAge))
+	{
+		return;
+	}
+
+	// Find all chunks that could be affected by this edit
+	TArray<FFluidChunkCoord> AffectedChunks = GetChunksInBounds(ActivationBounds);
 
-	UE_LOG(LogTemp, Log, TEXT("Voxel edit at %s, activating %d chunks in radius %.0f"), 
+	VOXELFLUID_TRACE(EditActivation, AffectedChunks.Num(), 0, 0, ActivationRadius);
+	VOXELFLUID_LOG(LogVoxelFluidStreaming, Verbose, TEXT("Voxel edit at %s, activating %d chunks in radius %.0f"), 
 		*EditLocation.ToString(), AffectedChunks.Num(), ActivationRadius);
 
 	for (const FFluidChunkCoord& ChunkCoord : AffectedChunks)
@@ -2223,19 +2643,17 @@ void UFluidChunkManager::ActivateChunksForEdit(const FVector& EditLocation, floa
 			ActivateChunk(Chunk);
 			
 			// Mark as edit-activated
-			EditActivatedChunks.Add(ChunkCoord, CurrentTime);
-			ChunkSettledTimes.Remove(ChunkCoord); // Clear any settled time
+			EditActivation.Activate(ChunkCoord, CurrentTime);
 			
-			UE_LOG(LogTemp, Verbose, TEXT("Edit-activated chunk [%d,%d,%d]"), 
+			VOXELFLUID_LOG(LogVoxelFluidStreaming, VeryVerbose, TEXT("Edit-activated chunk [%d,%d,%d]"), 
 				ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z);
 		}
 		else
 		{
 			// Refresh the activation time if already active
-			if (EditActivatedChunks.Contains(ChunkCoord))
+			if (EditActivation.IsActivated(ChunkCoord))
 			{
-				EditActivatedChunks[ChunkCoord] = CurrentTime;
-				ChunkSettledTimes.Remove(ChunkCoord);
+				EditActivation.Activate(ChunkCoord, CurrentTime);
 			}
 		}
 	}
@@ -2243,73 +2661,88 @@ void UFluidChunkManager::ActivateChunksForEdit(const FVector& EditLocation, floa
 
 void UFluidChunkManager::CheckForSettledChunks()
 {
+	VOXELFLUID_ALLOC_SCOPE("Settling");
+
 	// Only check if we're using edit-triggered activation
 	if (StreamingConfig.ActivationMode == EChunkActivationMode::DistanceBased)
 	{
 		return;
 	}
 
-	float CurrentTime = FPlatformTime::Seconds();
-	TArray<FFluidChunkCoord> ChunksToDeactivate;
+	// Only chunks whose check is due come off the wheel
+	const double CurrentTime = FPlatformTime::Seconds();
+	TArray<FFluidChunkCoord> DueChunks;
+	EditActivation.PopDue(CurrentTime, DueChunks);
 
-	// Check all edit-activated chunks
-	for (const auto& Pair : EditActivatedChunks)
+	for (const FFluidChunkCoord& ChunkCoord : DueChunks)
 	{
-		const FFluidChunkCoord& ChunkCoord = Pair.Key;
-		float ActivationTime = Pair.Value;
-
 		UFluidChunk* Chunk = GetChunk(ChunkCoord);
 		if (!Chunk || Chunk->State != EChunkState::Active)
+		{
+			// Unloaded or put to sleep some other way; a later edit starts tracking it again
+			EditActivation.Remove(ChunkCoord);
 			continue;
+		}
 
 		// Check if chunk has settled
 		bool bIsSettled = (Chunk->TotalFluidActivity < StreamingConfig.MinActivityForDeactivation) &&
 						  (Chunk->bFullySettled || Chunk->GetTotalFluidVolume() < 0.1f);
 
-		if (bIsSettled)
-		{
-			// Track when chunk became settled
-			if (!ChunkSettledTimes.Contains(ChunkCoord))
-			{
-				ChunkSettledTimes.Add(ChunkCoord, CurrentTime);
-				UE_LOG(LogTemp, Verbose, TEXT("Chunk [%d,%d,%d] became settled"), 
-					ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z);
-			}
-			else
-			{
-				// Check if it's been settled long enough
-				float SettledTime = ChunkSettledTimes[ChunkCoord];
-				if (CurrentTime - SettledTime >= StreamingConfig.SettledDeactivationDelay)
-				{
-					ChunksToDeactivate.Add(ChunkCoord);
-				}
-			}
-		}
-		else
+		if (!bIsSettled)
 		{
 			// Chunk is active again, remove from settled tracking
-			ChunkSettledTimes.Remove(ChunkCoord);
+			EditActivation.SetSettledTime(ChunkCoord, -1.0);
+			EditActivation.Schedule(ChunkCoord, CurrentTime + SettledChunkCheckInterval);
+			continue;
 		}
-	}
 
-	// Deactivate settled chunks
-	for (const FFluidChunkCoord& ChunkCoord : ChunksToDeactivate)
-	{
-		UFluidChunk* Chunk = GetChunk(ChunkCoord);
-		if (Chunk)
+		const double SettledTime = EditActivation.GetSettledTime(ChunkCoord);
+		if (SettledTime < 0.0)
+		{
+			// Track when chunk became settled, and look again once the delay has run
+			EditActivation.SetSettledTime(ChunkCoord, CurrentTime);
+			EditActivation.Schedule(ChunkCoord, CurrentTime + StreamingConfig.SettledDeactivationDelay);
+			VOXELFLUID_TRACE(ChunkSettled, ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z);
+			VOXELFLUID_LOG(LogVoxelFluidStreaming, VeryVerbose, TEXT("Chunk [%d,%d,%d] became settled"), 
+				ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z);
+		}
+		else if (CurrentTime - SettledTime >= StreamingConfig.SettledDeactivationDelay)
 		{
-			UE_LOG(LogTemp, Log, TEXT("Deactivating settled chunk [%d,%d,%d]"), 
+			VOXELFLUID_LOG(LogVoxelFluidStreaming, Verbose, TEXT("Deactivating settled chunk [%d,%d,%d]"), 
 				ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z);
 			
 			DeactivateChunk(Chunk);
-			EditActivatedChunks.Remove(ChunkCoord);
-			ChunkSettledTimes.Remove(ChunkCoord);
+			EditActivation.Remove(ChunkCoord);
+		}
+		else
+		{
+			EditActivation.Schedule(ChunkCoord, SettledTime + StreamingConfig.SettledDeactivationDelay);
 		}
 	}
 }
 
 bool UFluidChunkManager::IsChunkEditActivated(const FFluidChunkCoord& Coord) const
 {
-	return EditActivatedChunks.Contains(Coord);
+	return EditActivation.IsActivated(Coord);
+}
+
+void UFluidChunkManager::RetainChunksUntilSettled(const TArray<FFluidChunkCoord>& Coords)
+{
+	// Distance-based mode keeps chunks alive by viewer distance alone
+	if (StreamingConfig.ActivationMode == EChunkActivationMode::DistanceBased)
+	{
+		return;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+
+	for (const FFluidChunkCoord& Coord : Coords)
+	{
+		UFluidChunk* Chunk = GetChunk(Coord);
+		if (!Chunk || Chunk->State != EChunkState::Active)
+			continue;
+
+		EditActivation.Activate(Coord, CurrentTime);
+	}
 }
 
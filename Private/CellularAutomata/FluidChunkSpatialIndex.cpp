@@ -0,0 +1,86 @@
+#include "CellularAutomata/FluidChunkSpatialIndex.h"
+
+void FFluidChunkSpatialIndex::Add(const FFluidChunkCoord& Coord)
+{
+	TArray<FFluidChunkCoord>& Bucket = Buckets.FindOrAdd(GetBucketKey(Coord.X, Coord.Y));
+	if (!Bucket.Contains(Coord))
+	{
+		Bucket.Add(Coord);
+		++ChunkCount;
+	}
+}
+
+void FFluidChunkSpatialIndex::Remove(const FFluidChunkCoord& Coord)
+{
+	const FIntPoint Key = GetBucketKey(Coord.X, Coord.Y);
+	TArray<FFluidChunkCoord>* Bucket = Buckets.Find(Key);
+	if (Bucket && Bucket->RemoveSingleSwap(Coord) > 0)
+	{
+		--ChunkCount;
+		if (Bucket->Num() == 0)
+		{
+			Buckets.Remove(Key);
+		}
+	}
+}
+
+void FFluidChunkSpatialIndex::Reset()
+{
+	Buckets.Reset();
+	ChunkCount = 0;
+}
+
+void FFluidChunkSpatialIndex::QueryRange(const FIntVector& Min, const FIntVector& Max, TArray<FFluidChunkCoord>& OutCoords) const
+{
+	if (Min.X > Max.X || Min.Y > Max.Y || Min.Z > Max.Z || ChunkCount == 0)
+		return;
+
+	auto CollectBucket = [&](const TArray<FFluidChunkCoord>& Bucket)
+	{
+		for (const FFluidChunkCoord& Coord : Bucket)
+		{
+			if (Coord.X >= Min.X && Coord.X <= Max.X && Coord.Y >= Min.Y && Coord.Y <= Max.Y && Coord.Z >= Min.Z && Coord.Z <= Max.Z)
+			{
+				OutCoords.Add(Coord);
+			}
+		}
+	};
+
+	const FIntPoint MinKey = GetBucketKey(Min.X, Min.Y);
+	const FIntPoint MaxKey = GetBucketKey(Max.X, Max.Y);
+	const int64 QueryBuckets = ((int64)MaxKey.X - MinKey.X + 1) * ((int64)MaxKey.Y - MinKey.Y + 1);
+
+	// A query wider than the loaded area walks the occupied buckets instead of empty ones
+	if (QueryBuckets > Buckets.Num())
+	{
+		for (const auto& Pair : Buckets)
+		{
+			if (Pair.Key.X >= MinKey.X && Pair.Key.X <= MaxKey.X && Pair.Key.Y >= MinKey.Y && Pair.Key.Y <= MaxKey.Y)
+			{
+				CollectBucket(Pair.Value);
+			}
+		}
+		return;
+	}
+
+	for (int32 KeyY = MinKey.Y; KeyY <= MaxKey.Y; ++KeyY)
+	{
+		for (int32 KeyX = MinKey.X; KeyX <= MaxKey.X; ++KeyX)
+		{
+			if (const TArray<FFluidChunkCoord>* Bucket = Buckets.Find(FIntPoint(KeyX, KeyY)))
+			{
+				CollectBucket(*Bucket);
+			}
+		}
+	}
+}
+
+SIZE_T FFluidChunkSpatialIndex::GetAllocatedSize() const
+{
+	SIZE_T Bytes = Buckets.GetAllocatedSize();
+	for (const auto& Pair : Buckets)
+	{
+		Bytes += Pair.Value.GetAllocatedSize();
+	}
+	return Bytes;
+}
@@ -0,0 +1,151 @@
+#include "CellularAutomata/FluidEditActivation.h"
+
+void FFluidEditActivationTracker::SetCheckInterval(double InSeconds)
+{
+	const double NewInterval = FMath::Max(InSeconds, 0.01);
+	if (NewInterval == CheckInterval)
+		return;
+
+	// Ticks change meaning; put every tracked chunk back on the wheel under the new width
+	TArray<FFluidChunkCoord> Tracked;
+	Chunks.GetKeys(Tracked);
+	const double Now = LastTick != INDEX_NONE ? (LastTick + 1) * CheckInterval : 0.0;
+	for (TArray<FSlotEntry>& Slot : Slots)
+	{
+		Slot.Reset();
+	}
+	CheckInterval = NewInterval;
+	LastTick = INDEX_NONE;
+	for (const FFluidChunkCoord& Coord : Tracked)
+	{
+		Schedule(Coord, Now);
+	}
+}
+
+void FFluidEditActivationTracker::Reset()
+{
+	Chunks.Reset();
+	Regions.Reset();
+	for (TArray<FSlotEntry>& Slot : Slots)
+	{
+		Slot.Reset();
+	}
+	LastTick = INDEX_NONE;
+}
+
+void FFluidEditActivationTracker::Activate(const FFluidChunkCoord& Coord, double Time)
+{
+	Chunks.FindOrAdd(Coord).SettledTime = -1.0;
+	Schedule(Coord, Time + CheckInterval);
+}
+
+void FFluidEditActivationTracker::Remove(const FFluidChunkCoord& Coord)
+{
+	// Its slot entry goes stale and is dropped when the wheel reaches it
+	Chunks.Remove(Coord);
+}
+
+double FFluidEditActivationTracker::GetSettledTime(const FFluidChunkCoord& Coord) const
+{
+	const FChunkEntry* Entry = Chunks.Find(Coord);
+	return Entry ? Entry->SettledTime : -1.0;
+}
+
+void FFluidEditActivationTracker::SetSettledTime(const FFluidChunkCoord& Coord, double Time)
+{
+	if (FChunkEntry* Entry = Chunks.Find(Coord))
+	{
+		Entry->SettledTime = Time;
+	}
+}
+
+void FFluidEditActivationTracker::Schedule(const FFluidChunkCoord& Coord, double Time)
+{
+	FChunkEntry* Entry = Chunks.Find(Coord);
+	if (!Entry)
+		return;
+
+	// Never into a slot already processed, or the chunk would wait a full revolution
+	int64 DueTick = (int64)FMath::CeilToDouble(Time / CheckInterval);
+	if (LastTick != INDEX_NONE)
+	{
+		DueTick = FMath::Max(DueTick, LastTick + 1);
+	}
+	if (Entry->DueTick == DueTick)
+		return;
+
+	Entry->DueTick = DueTick;
+	Slots[DueTick % WheelSlots].Add({ Coord, DueTick });
+}
+
+void FFluidEditActivationTracker::PopDue(double Time, TArray<FFluidChunkCoord>& OutCoords)
+{
+	const int64 Tick = GetTick(Time);
+	if (LastTick == INDEX_NONE)
+	{
+		LastTick = Tick - WheelSlots;
+	}
+	if (Tick <= LastTick)
+		return;
+
+	// After a long gap every slot is due at most once; entries further out stay for a later revolution
+	const int64 FirstTick = FMath::Max(LastTick + 1, Tick - WheelSlots + 1);
+	for (int64 SlotTick = FirstTick; SlotTick <= Tick; ++SlotTick)
+	{
+		TArray<FSlotEntry>& Slot = Slots[SlotTick % WheelSlots];
+		for (int32 i = Slot.Num() - 1; i >= 0; --i)
+		{
+			const FSlotEntry SlotEntry = Slot[i];
+			const FChunkEntry* Entry = Chunks.Find(SlotEntry.Coord);
+			if (Entry && Entry->DueTick == SlotEntry.DueTick && SlotEntry.DueTick > Tick)
+				continue;
+
+			if (Entry && Entry->DueTick == SlotEntry.DueTick)
+			{
+				OutCoords.Add(SlotEntry.Coord);
+			}
+			Slot.RemoveAtSwap(i, 1, false);
+		}
+	}
+	LastTick = Tick;
+
+	// Popped chunks are off the wheel until scheduled again
+	for (const FFluidChunkCoord& Coord : OutCoords)
+	{
+		Chunks[Coord].DueTick = INDEX_NONE;
+	}
+}
+
+bool FFluidEditActivationTracker::AddEditRegion(const FIntVector& Min, const FIntVector& Max, double Time, double MaxAge)
+{
+	Regions.RemoveAllSwap([Time, MaxAge](const FEditRegion& Region) { return Time - Region.Time > MaxAge; });
+
+	for (const FEditRegion& Region : Regions)
+	{
+		if (Min.X >= Region.Min.X && Min.Y >= Region.Min.Y && Min.Z >= Region.Min.Z
+			&& Max.X <= Region.Max.X && Max.Y <= Region.Max.Y && Max.Z <= Region.Max.Z)
+		{
+			return false;
+		}
+	}
+
+	// Boxes stay as they were edited, never merged: a bounding box would claim chunks no edit activated.
+	// Older boxes inside the new one are redundant, since it outlives them
+	Regions.RemoveAllSwap([&Min, &Max](const FEditRegion& Region)
+	{
+		return Region.Min.X >= Min.X && Region.Min.Y >= Min.Y && Region.Min.Z >= Min.Z
+			&& Region.Max.X <= Max.X && Region.Max.Y <= Max.Y && Region.Max.Z <= Max.Z;
+	});
+	Regions.Add({ Min, Max, Time });
+	return true;
+}
+
+SIZE_T FFluidEditActivationTracker::GetAllocatedSize() const
+{
+	SIZE_T Bytes = Chunks.GetAllocatedSize() + Regions.GetAllocatedSize();
+	for (const TArray<FSlotEntry>& Slot : Slots)
+	{
+		Bytes += Slot.GetAllocatedSize();
+	}
+	return Bytes;
+}
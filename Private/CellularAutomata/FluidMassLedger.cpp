@@ -0,0 +1,284 @@
+#include "CellularAutomata/FluidMassLedger.h"
+#include "VoxelFluidStats.h"
+#include "VoxelFluidDebug.h"
+#include "CellularAutomata/FluidChunkManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDeviceRedirector.h"
+#include "UObject/UObjectIterator.h"
+
+static FAutoConsoleCommand CmdVoxelFluidMassLedger(
+	TEXT("voxelfluid.MassLedger"),
+	TEXT("Audit fluid volume against recorded sources and sinks. Usage: voxelfluid.MassLedger [Interval]|off|reset|report [WorstChunks]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FString Action = Args.Num() > 0 ? Args[0].ToLower() : FString(TEXT("report"));
+		for (TObjectIterator<UFluidChunkManager> It; It; ++It)
+		{
+			if (It->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+				continue;
+
+			FFluidMassLedger& Ledger = It->GetMassLedger();
+			if (Action == TEXT("off"))
+			{
+				Ledger.SetAuditInterval(0);
+			}
+			else if (Action == TEXT("reset"))
+			{
+				Ledger.Reset();
+			}
+			else if (Action.IsNumeric())
+			{
+				Ledger.SetAuditInterval(FCString::Atoi(*Action));
+			}
+			else
+			{
+				const int32 WorstChunks = Args.Num() > 1 ? FMath::Max(0, FCString::Atoi(*Args[1])) : 5;
+				GLog->Log(Ledger.GetReport(WorstChunks));
+			}
+		}
+	})
+);
+
+const TCHAR* LexToString(EFluidMassCategory Category)
+{
+	switch (Category)
+	{
+	case EFluidMassCategory::Edit: return TEXT("Edit");
+	case EFluidMassCategory::Fill: return TEXT("Fill");
+	case EFluidMassCategory::StaticWater: return TEXT("StaticWater");
+	case EFluidMassCategory::Terrain: return TEXT("Terrain");
+	case EFluidMassCategory::Evaporation: return TEXT("Evaporation");
+	case EFluidMassCategory::MinLevelClamp: return TEXT("MinLevelClamp");
+	case EFluidMassCategory::Transfer: return TEXT("Transfer");
+	case EFluidMassCategory::Streaming: return TEXT("Streaming");
+	case EFluidMassCategory::Persistence: return TEXT("Persistence");
+	case EFluidMassCategory::CoarseSolve: return TEXT("CoarseSolve");
+	default: return TEXT("Unknown");
+	}
+}
+
+FString FFluidMassAudit::ToString() const
+{
+	FString Result = FString::Printf(TEXT("Step %lld, %d chunks: measured %.3f, expected %.3f, drift %.4f (%.4f%%, %.4f since last audit)"),
+		Step, Chunks, MeasuredVolume, ExpectedVolume, Drift, GetRelativeDrift() * 100.0, DriftSinceLast);
+	for (int32 i = 0; i < (int32)EFluidMassCategory::Count; ++i)
+	{
+		if (Flows.Volume[i] != 0.0)
+		{
+			Result += FString::Printf(TEXT("\n  %-14s %+.4f"), LexToString((EFluidMassCategory)i), Flows.Volume[i]);
+		}
+	}
+	return Result;
+}
+
+void FFluidMassLedger::SetAuditInterval(int32 InSteps)
+{
+	FScopeLock Lock(&Mutex);
+	const bool bWasEnabled = IsEnabled();
+	AuditInterval.store(FMath::Max(0, InSteps), std::memory_order_relaxed);
+	StepsSinceAudit = 0;
+	if (IsEnabled() && !bWasEnabled)
+	{
+		Records.Reset();
+		RetiredVolumes.Reset();
+		Flows.Reset();
+		Drift = 0.0;
+		DriftAtLastAudit = 0.0;
+		LastAudit = FFluidMassAudit();
+		bRebaseline = true;
+	}
+}
+
+void FFluidMassLedger::Reset()
+{
+	FScopeLock Lock(&Mutex);
+	Records.Reset();
+	RetiredVolumes.Reset();
+	Flows.Reset();
+	Drift = 0.0;
+	DriftAtLastAudit = 0.0;
+	StepCount = 0;
+	StepsSinceAudit = 0;
+	LastAudit = FFluidMassAudit();
+	bRebaseline = true;
+}
+
+void FFluidMassLedger::OnStep(const TArray<UFluidChunk*>& LoadedChunks)
+{
+	bool bAuditDue = false;
+	{
+		FScopeLock Lock(&Mutex);
+		if (!IsEnabled())
+			return;
+
+		++StepCount;
+		if (++StepsSinceAudit >= GetAuditInterval())
+		{
+			StepsSinceAudit = 0;
+			bAuditDue = true;
+		}
+	}
+
+	if (bAuditDue)
+	{
+		Audit(LoadedChunks);
+	}
+}
+
+FFluidChunkMassRecord& FFluidMassLedger::AuditChunk_Locked(UFluidChunk& Chunk)
+{
+	const double Measured = Chunk.GetTotalFluidVolume();
+	FFluidMassFlows ChunkFlows = Chunk.MassFlows;
+	Chunk.MassFlows.Reset();
+
+	FFluidChunkMassRecord* Record = Records.Find(Chunk.ChunkCoord);
+	if (!Record)
+	{
+		Record = &Records.Add(Chunk.ChunkCoord);
+		Record->Coord = Chunk.ChunkCoord;
+		if (bRebaseline)
+		{
+			Record->Volume = Measured;
+			return *Record;
+		}
+
+		// Whatever the recorded flows don't explain came in with the chunk
+		const double Arrived = Measured - ChunkFlows.GetNet();
+		double RetiredVolume = 0.0;
+		if (RetiredVolumes.RemoveAndCopyValue(Chunk.ChunkCoord, RetiredVolume))
+		{
+			ChunkFlows.Add(EFluidMassCategory::Streaming, RetiredVolume);
+			ChunkFlows.Add(EFluidMassCategory::Persistence, Arrived - RetiredVolume);
+		}
+		else
+		{
+			ChunkFlows.Add(EFluidMassCategory::Streaming, Arrived);
+		}
+	}
+
+	const double ChunkDrift = Measured - (Record->Volume + ChunkFlows.GetNet());
+	Record->Drift += ChunkDrift;
+	Record->LastDrift = ChunkDrift;
+	Record->Volume = Measured;
+	Flows += ChunkFlows;
+	Drift += ChunkDrift;
+	return *Record;
+}
+
+void FFluidMassLedger::RetireRecord_Locked(const FFluidChunkMassRecord& Record, bool bKeptForReload)
+{
+	Flows.Add(EFluidMassCategory::Streaming, -Record.Volume);
+	if (bKeptForReload)
+	{
+		RetiredVolumes.Add(Record.Coord, Record.Volume);
+	}
+	else
+	{
+		RetiredVolumes.Remove(Record.Coord);
+	}
+}
+
+FFluidMassAudit FFluidMassLedger::Audit(const TArray<UFluidChunk*>& LoadedChunks)
+{
+	FScopeLock Lock(&Mutex);
+
+	TSet<FFluidChunkCoord> Audited;
+	Audited.Reserve(LoadedChunks.Num());
+	double Measured = 0.0;
+	for (UFluidChunk* Chunk : LoadedChunks)
+	{
+		if (Chunk)
+		{
+			Measured += AuditChunk_Locked(*Chunk).Volume;
+			Audited.Add(Chunk->ChunkCoord);
+		}
+	}
+	const bool bBaselined = bRebaseline;
+	bRebaseline = false;
+
+	// Chunks that went away without RetireChunk (cleared or destroyed) took their last measured volume with them
+	for (auto It = Records.CreateIterator(); It; ++It)
+	{
+		if (!Audited.Contains(It.Key()))
+		{
+			RetireRecord_Locked(It.Value(), false);
+			It.RemoveCurrent();
+		}
+	}
+
+	LastAudit.Step = StepCount;
+	LastAudit.Chunks = Records.Num();
+	LastAudit.MeasuredVolume = Measured;
+	LastAudit.ExpectedVolume = Measured - Drift;
+	LastAudit.Drift = Drift;
+	LastAudit.DriftSinceLast = Drift - DriftAtLastAudit;
+	LastAudit.Flows = Flows;
+	DriftAtLastAudit = Drift;
+
+	SET_FLOAT_STAT(STAT_VoxelFluid_MassVolume, Measured);
+	SET_FLOAT_STAT(STAT_VoxelFluid_MassDrift, Drift);
+	SET_FLOAT_STAT(STAT_VoxelFluid_MassDriftPerAudit, LastAudit.DriftSinceLast);
+	SET_FLOAT_STAT(STAT_VoxelFluid_MassClamped, Flows.Get(EFluidMassCategory::MinLevelClamp));
+
+	if (!bBaselined && FMath::Abs(LastAudit.DriftSinceLast) > DriftTolerance * FMath::Max(Measured, 1.0))
+	{
+		UE_LOG(LogVoxelFluidSim, Warning, TEXT("Fluid mass drifted by %.4f over the last %d steps (%.3f measured)"),
+			LastAudit.DriftSinceLast, GetAuditInterval(), Measured);
+	}
+
+	return LastAudit;
+}
+
+void FFluidMassLedger::RetireChunk(UFluidChunk& Chunk, bool bKeptForReload)
+{
+	FScopeLock Lock(&Mutex);
+
+	// Not baselined yet: the next audit starts from whatever is loaded then
+	if (!IsEnabled() || bRebaseline)
+	{
+		Chunk.MassFlows.Reset();
+		return;
+	}
+
+	const FFluidChunkMassRecord Record = AuditChunk_Locked(Chunk);
+	RetireRecord_Locked(Record, bKeptForReload);
+	Records.Remove(Chunk.ChunkCoord);
+}
+
+FFluidMassAudit FFluidMassLedger::GetLastAudit() const
+{
+	FScopeLock Lock(&Mutex);
+	return LastAudit;
+}
+
+TArray<FFluidChunkMassRecord> FFluidMassLedger::GetWorstChunks(int32 Count) const
+{
+	TArray<FFluidChunkMassRecord> Result;
+	{
+		FScopeLock Lock(&Mutex);
+		Records.GenerateValueArray(Result);
+	}
+
+	Result.Sort([](const FFluidChunkMassRecord& A, const FFluidChunkMassRecord& B) { return FMath::Abs(A.Drift) > FMath::Abs(B.Drift); });
+	if (Result.Num() > Count)
+	{
+		Result.SetNum(Count);
+	}
+	return Result;
+}
+
+FString FFluidMassLedger::GetReport(int32 WorstChunkCount) const
+{
+	if (!IsEnabled())
+	{
+		return TEXT("Mass ledger disabled");
+	}
+
+	FString Result = GetLastAudit().ToString();
+	for (const FFluidChunkMassRecord& Record : GetWorstChunks(WorstChunkCount))
+	{
+		Result += FString::Printf(TEXT("\n  (%d,%d,%d) volume %.3f, drift %+.4f (%+.4f last audit)"),
+			Record.Coord.X, Record.Coord.Y, Record.Coord.Z, Record.Volume, Record.Drift, Record.LastDrift);
+	}
+	return Result;
+}
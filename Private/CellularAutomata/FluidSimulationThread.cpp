@@ -0,0 +1,455 @@
+#include "CellularAutomata/FluidSimulationThread.h"
+#include "CellularAutomata/FluidChunkManager.h"
+#include "VoxelFluidStats.h"
+#include "VoxelFluidDebug.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "UObject/GarbageCollection.h"
+
+static int32 FloorDivCells(int32 A, int32 B)
+{
+	return A >= 0 ? A / B : (A - B + 1) / B;
+}
+
+SIZE_T FFluidSimulationSnapshot::GetAllocatedSize() const
+{
+	SIZE_T Bytes = sizeof(FFluidSimulationSnapshot) + Chunks.GetAllocatedSize();
+	for (const auto& Pair : Chunks)
+	{
+		if (const FFluidChunkSnapshot* Chunk = Pair.Value.Get())
+		{
+			Bytes += sizeof(FFluidChunkSnapshot) + Chunk->FluidLevels.GetAllocatedSize() + Chunk->PreviousLevels.GetAllocatedSize()
+				+ Chunk->Flow.Flux.GetAllocatedSize() + Chunk->Flow.Velocity.GetAllocatedSize();
+		}
+	}
+	return Bytes;
+}
+
+const FFluidChunkSnapshot* FFluidSimulationSnapshot::FindChunk(const FFluidChunkCoord& Coord) const
+{
+	const FFluidChunkSnapshotPtr* Found = Chunks.Find(Coord);
+	return Found ? Found->Get() : nullptr;
+}
+
+FIntVector FFluidSimulationSnapshot::WorldToGlobalCell(const FVector& WorldPos) const
+{
+	const FVector Local = (WorldPos - WorldOrigin) / CellSize;
+	return FIntVector(FMath::FloorToInt(Local.X), FMath::FloorToInt(Local.Y), FMath::FloorToInt(Local.Z));
+}
+
+float FFluidSimulationSnapshot::GetFluidAtGlobalCell(const FIntVector& Cell, float Alpha) const
+{
+	const FFluidChunkCoord Coord(FloorDivCells(Cell.X, ChunkSize), FloorDivCells(Cell.Y, ChunkSize), FloorDivCells(Cell.Z, ChunkSize));
+	const FFluidChunkSnapshot* Chunk = FindChunk(Coord);
+	if (!Chunk || Chunk->FluidLevels.Num() == 0)
+		return 0.0f;
+
+	return Chunk->GetInterpolatedFluidAt(Cell.X - Coord.X * ChunkSize, Cell.Y - Coord.Y * ChunkSize, Cell.Z - Coord.Z * ChunkSize, Alpha);
+}
+
+float FFluidSimulationSnapshot::GetFluidAtWorldPosition(const FVector& WorldPos) const
+{
+	return GetFluidAtGlobalCell(WorldToGlobalCell(WorldPos));
+}
+
+FVector FFluidSimulationSnapshot::GetFlowVelocityAtWorldPosition(const FVector& WorldPos) const
+{
+	const FIntVector Cell = WorldToGlobalCell(WorldPos);
+	const FFluidChunkCoord Coord(FloorDivCells(Cell.X, ChunkSize), FloorDivCells(Cell.Y, ChunkSize), FloorDivCells(Cell.Z, ChunkSize));
+	const FFluidChunkSnapshot* Chunk = FindChunk(Coord);
+	if (!Chunk || !Chunk->Flow.IsValid())
+		return FVector::ZeroVector;
+
+	return Chunk->Flow.SampleVelocity((WorldPos - Chunk->WorldPosition) / CellSize);
+}
+
+float FFluidSimulationSnapshot::GetFluidDepthAtWorldPosition(const FVector& WorldPos) const
+{
+	FIntVector Cell = WorldToGlobalCell(WorldPos);
+	float Level = GetFluidAtGlobalCell(Cell);
+	if (Level <= KINDA_SMALL_NUMBER)
+		return 0.0f;
+
+	// Walk up while the cells are full; the first partial cell holds the surface
+	float ColumnTop = WorldOrigin.Z + Cell.Z * CellSize;
+	while (Level > KINDA_SMALL_NUMBER)
+	{
+		ColumnTop += FMath::Min(Level, 1.0f) * CellSize;
+		if (Level < 1.0f)
+			break;
+
+		++Cell.Z;
+		Level = GetFluidAtGlobalCell(Cell);
+	}
+
+	return FMath::Max(0.0f, ColumnTop - WorldPos.Z);
+}
+
+bool FFluidSimulationSnapshot::BuildDensityGrid(const FFluidChunkCoord& Coord, TArray<float>& OutDensity, FIntVector& OutGridSize, FVector& OutGridOrigin, float Alpha) const
+{
+	const FFluidChunkSnapshot* Center = FindChunk(Coord);
+	if (!Center || Center->FluidLevels.Num() == 0)
+		return false;
+
+	const int32 GridEdge = ChunkSize + 2;
+	OutGridSize = FIntVector(GridEdge);
+	OutGridOrigin = Center->WorldPosition - FVector(CellSize);
+	OutDensity.SetNumUninitialized(GridEdge * GridEdge * GridEdge);
+
+	const FIntVector Base(Coord.X * ChunkSize - 1, Coord.Y * ChunkSize - 1, Coord.Z * ChunkSize - 1);
+	for (int32 Z = 0; Z < GridEdge; ++Z)
+	{
+		for (int32 Y = 0; Y < GridEdge; ++Y)
+		{
+			for (int32 X = 0; X < GridEdge; ++X)
+			{
+				const int32 LX = X - 1, LY = Y - 1, LZ = Z - 1;
+				const bool bInside = LX >= 0 && LY >= 0 && LZ >= 0 && LX < ChunkSize && LY < ChunkSize && LZ < ChunkSize;
+
+				// Interior cells come straight from this chunk; only the skirt needs a neighbour lookup
+				OutDensity[X + (Y + Z * GridEdge) * GridEdge] = bInside
+					? Center->GetInterpolatedFluidAt(LX, LY, LZ, Alpha)
+					: GetFluidAtGlobalCell(Base + FIntVector(X, Y, Z), Alpha);
+			}
+		}
+	}
+
+	return true;
+}
+
+TSharedRef<FFluidSimulationSnapshot, ESPMode::ThreadSafe> FFluidSimulationSnapshot::Capture(UFluidChunkManager& Manager,
+	const FFluidSimulationSnapshot* Previous, uint64 StepIndex, double SimulationTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_SimSnapshot);
+
+	TSharedRef<FFluidSimulationSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FFluidSimulationSnapshot, ESPMode::ThreadSafe>();
+	Snapshot->StepIndex = StepIndex;
+	Snapshot->SimulationTime = SimulationTime;
+	Snapshot->WorldOrigin = Manager.WorldOrigin;
+	Snapshot->ChunkSize = Manager.ChunkSize;
+	Snapshot->CellSize = Manager.CellSize;
+
+	const uint64 StaleRefreshSteps = 120;
+	const int32 CellCount = Manager.ChunkSize * Manager.ChunkSize * Manager.ChunkSize;
+	const TArray<UFluidChunk*> Chunks = Manager.GetLoadedChunks();
+	Snapshot->Chunks.Reserve(Chunks.Num());
+
+	for (UFluidChunk* Chunk : Chunks)
+	{
+		if (!Chunk || Chunk->State == EChunkState::Unloaded)
+			continue;
+
+		// Sleeping chunks are shared with the last capture instead of copied; each is still refreshed
+		// every StaleRefreshSteps (staggered by coord) to pick up writes made under FScopedAccess
+		const FFluidChunkSnapshotPtr* PreviousChunk = Previous ? Previous->Chunks.Find(Chunk->ChunkCoord) : nullptr;
+		const bool bMayHaveChanged = Chunk->State == EChunkState::Active && !Chunk->bFullySettled;
+		const bool bRefreshDue = (GetTypeHash(Chunk->ChunkCoord) + StepIndex) % StaleRefreshSteps == 0;
+		if (PreviousChunk && !bMayHaveChanged && !bRefreshDue && (*PreviousChunk)->State == Chunk->State && (*PreviousChunk)->PreviousLevels.Num() == 0)
+		{
+			Snapshot->Chunks.Add(Chunk->ChunkCoord, *PreviousChunk);
+			continue;
+		}
+
+		TSharedRef<FFluidChunkSnapshot, ESPMode::ThreadSafe> ChunkSnapshot = MakeShared<FFluidChunkSnapshot, ESPMode::ThreadSafe>();
+		ChunkSnapshot->Coord = Chunk->ChunkCoord;
+		ChunkSnapshot->WorldPosition = Chunk->ChunkWorldPosition;
+		ChunkSnapshot->ChunkSize = Chunk->ChunkSize;
+		ChunkSnapshot->State = Chunk->State;
+		ChunkSnapshot->CapturedStep = StepIndex;
+		ChunkSnapshot->Flow = Chunk->FlowField;
+
+		if (Chunk->bUseSparseRepresentation)
+		{
+			// Sparse chunks only hold cells with fluid or terrain; everything else reads as empty
+			ChunkSnapshot->FluidLevels.SetNumZeroed(CellCount);
+			if (bMayHaveChanged)
+			{
+				ChunkSnapshot->PreviousLevels.SetNumZeroed(CellCount);
+			}
+			for (const auto& Pair : Chunk->SparseCells)
+			{
+				if (Pair.Key < 0 || Pair.Key >= CellCount)
+					continue;
+
+				ChunkSnapshot->FluidLevels[Pair.Key] = Pair.Value.FluidLevel;
+				if (bMayHaveChanged)
+				{
+					ChunkSnapshot->PreviousLevels[Pair.Key] = Pair.Value.LastFluidLevel;
+				}
+			}
+		}
+		else if (Chunk->Cells.Num() == CellCount)
+		{
+			ChunkSnapshot->FluidLevels.SetNumUninitialized(CellCount);
+			for (int32 i = 0; i < CellCount; ++i)
+			{
+				ChunkSnapshot->FluidLevels[i] = Chunk->Cells[i].FluidLevel;
+			}
+
+			// Stepping chunks keep the pre-step levels (LastFluidLevel) so renderers can blend between steps
+			if (bMayHaveChanged)
+			{
+				ChunkSnapshot->PreviousLevels.SetNumUninitialized(CellCount);
+				for (int32 i = 0; i < CellCount; ++i)
+				{
+					ChunkSnapshot->PreviousLevels[i] = Chunk->Cells[i].LastFluidLevel;
+				}
+			}
+		}
+
+		Snapshot->Chunks.Add(Chunk->ChunkCoord, ChunkSnapshot);
+	}
+
+	return Snapshot;
+}
+
+FFluidSimulationThread::FFluidSimulationThread(UFluidChunkManager* InChunkManager, float InStepRate)
+	: ChunkManager(InChunkManager)
+{
+	SetStepRate(InStepRate);
+}
+
+FFluidSimulationThread::~FFluidSimulationThread()
+{
+	Shutdown();
+}
+
+bool FFluidSimulationThread::Start()
+{
+	check(IsInGameThread());
+
+	if (Thread || !ChunkManager.IsValid())
+		return Thread != nullptr;
+
+	bStopRequested.store(false);
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+
+	// Readers get a valid (empty or current) snapshot from the first frame
+	PublishSnapshot();
+
+	Thread = FRunnableThread::Create(this, TEXT("VoxelFluidSimulation"), 0, TPri_AboveNormal);
+	if (!Thread)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+		return false;
+	}
+
+	FFluidMemoryTracker::Register(this);
+
+	VOXELFLUID_LOG(LogVoxelFluidSim, Log, TEXT("FluidSimulationThread: started at %.1f Hz"), 1.0f / StepInterval.load());
+	return true;
+}
+
+void FFluidSimulationThread::Shutdown()
+{
+	FFluidMemoryTracker::Unregister(this);
+
+	if (Thread)
+	{
+		Thread->Kill(true); // Calls Stop() and waits for Run() to return
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	if (WakeEvent)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+
+	// Edits that never reached a step are dropped with the thread
+	PendingCommands.Reset();
+	CommandQueue.Empty();
+}
+
+void FFluidSimulationThread::ReportMemory(FFluidMemoryReport& Report) const
+{
+	if (const FFluidSimulationSnapshotPtr Snapshot = GetLatestSnapshot())
+	{
+		Report.Add(EFluidMemoryCategory::Snapshots, Snapshot->GetAllocatedSize());
+	}
+}
+
+void FFluidSimulationThread::Stop()
+{
+	bStopRequested.store(true);
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FFluidSimulationThread::SetStepRate(float InStepRate)
+{
+	StepInterval.store(1.0f / FMath::Clamp(InStepRate, 1.0f, 1000.0f));
+}
+
+void FFluidSimulationThread::EnqueueCommand(const TArray<FFluidChunkCoord>& RequiredChunks, FCommand&& Command)
+{
+	check(IsInGameThread());
+
+	FPendingCommand& Pending = PendingCommands.AddDefaulted_GetRef();
+	Pending.RequiredChunks = RequiredChunks;
+	Pending.Command = MoveTemp(Command);
+}
+
+bool FFluidSimulationThread::SyncWithGameThread(TFunctionRef<void()> GameThreadWork)
+{
+	check(IsInGameThread());
+
+	UFluidChunkManager* Manager = ChunkManager.Get();
+	if (!Manager)
+		return false;
+
+	FCriticalSection& Lock = Manager->GetSimulationLock();
+	if (!Lock.TryLock())
+	{
+		// Ask the thread to pause after the current step so the next frame gets in
+		bSyncRequested.store(true);
+		return false;
+	}
+
+	GameThreadWork();
+
+	// Chunks for queued edits are created here, where UObject allocation is allowed
+	for (FPendingCommand& Pending : PendingCommands)
+	{
+		if (Pending.RequiredChunks.Num() > 0)
+		{
+			Manager->PrepareChunksForBulkFill(Pending.RequiredChunks);
+		}
+		CommandQueue.Enqueue(MoveTemp(Pending.Command));
+	}
+	PendingCommands.Reset();
+
+	bSyncRequested.store(false);
+	Lock.Unlock();
+
+	if (WakeEvent)
+	{
+		WakeEvent->Trigger();
+	}
+	return true;
+}
+
+FFluidSimulationSnapshotPtr FFluidSimulationThread::GetLatestSnapshot() const
+{
+	FScopeLock Lock(&SnapshotMutex);
+	return LatestSnapshot;
+}
+
+uint32 FFluidSimulationThread::Run()
+{
+	double NextStepTime = FPlatformTime::Seconds();
+
+	while (!bStopRequested.load())
+	{
+		const float Interval = StepInterval.load();
+		const double Now = FPlatformTime::Seconds();
+
+		if (Now < NextStepTime)
+		{
+			WakeEvent->Wait(FMath::Max(1, FMath::FloorToInt((NextStepTime - Now) * 1000.0)));
+			continue;
+		}
+
+		// The game thread is waiting on a sync point; give it the lock between steps (bounded to one interval)
+		if (bSyncRequested.load() && Now < NextStepTime + Interval)
+		{
+			FPlatformProcess::SleepNoStats(0.0002f);
+			continue;
+		}
+
+		// A slow step is made up with at most MaxCatchUpSteps back-to-back steps; older debt is shed
+		NextStepTime += Interval;
+		if (Now - NextStepTime > Interval * MaxCatchUpSteps.load())
+		{
+			NextStepTime = Now;
+		}
+
+		if (bPaused.load())
+			continue;
+
+		Step(Interval * TimeScale.load());
+	}
+
+	return 0;
+}
+
+void FFluidSimulationThread::Step(float DeltaTime)
+{
+	UFluidChunkManager* Manager = ChunkManager.Get();
+	if (!Manager)
+		return;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	{
+		FScopeLock StepLock(&Manager->GetSimulationLock());
+
+		// Chunk objects stay alive for the whole step
+		FGCScopeGuard GCGuard;
+
+		FCommand Command;
+		while (CommandQueue.Dequeue(Command))
+		{
+			Command(*Manager);
+		}
+
+		FFluidAllocationTracker::BeginStep();
+		if (PreStepCallback)
+		{
+			PreStepCallback(DeltaTime);
+		}
+
+		Manager->UpdateSimulation(DeltaTime);
+		FFluidAllocationTracker::EndStep();
+		SimulationTime += DeltaTime;
+		StepCount.fetch_add(1);
+
+		PublishSnapshot();
+	}
+
+	LastStepTimeMs.store((FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void FFluidSimulationThread::PublishSnapshot()
+{
+	UFluidChunkManager* Manager = ChunkManager.Get();
+	if (!Manager)
+		return;
+
+	const FFluidSimulationSnapshotPtr Snapshot = FFluidSimulationSnapshot::Capture(*Manager, LastPublished.Get(), StepCount.load(), SimulationTime);
+	LastPublished = Snapshot;
+
+	FScopeLock Lock(&SnapshotMutex);
+	LatestSnapshot = Snapshot;
+	LastPublishTime.store(FPlatformTime::Seconds());
+}
+
+float FFluidSimulationThread::GetInterpolationAlpha() const
+{
+	if (bPaused.load())
+		return 1.0f;
+
+	return FMath::Clamp(static_cast<float>((FPlatformTime::Seconds() - LastPublishTime.load()) / StepInterval.load()), 0.0f, 1.0f);
+}
+
+FFluidSimulationThread::FScopedAccess::FScopedAccess(UFluidChunkManager* InChunkManager)
+{
+	if (InChunkManager)
+	{
+		Lock = &InChunkManager->GetSimulationLock();
+		Lock->Lock();
+	}
+}
+
+FFluidSimulationThread::FScopedAccess::~FScopedAccess()
+{
+	if (Lock)
+	{
+		Lock->Unlock();
+	}
+}
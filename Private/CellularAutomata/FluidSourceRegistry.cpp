@@ -0,0 +1,311 @@
+#include "CellularAutomata/FluidSourceRegistry.h"
+#include "CellularAutomata/FluidChunkManager.h"
+#include "VoxelFluidStats.h"
+#include "Async/ParallelFor.h"
+
+int32 FFluidSourceRegistry::AddSource(const FVector& WorldPosition, float FlowRate)
+{
+	FScopeLock Lock(&Mutex);
+	const int32 ExistingId = FindSourceAtPosition(WorldPosition);
+	if (ExistingId != INDEX_NONE)
+	{
+		SetFlowRate(ExistingId, FlowRate);
+		return ExistingId;
+	}
+
+	const int32 SourceId = NextSourceId++;
+	FSourceEntry& Entry = Sources.Add(SourceId);
+	Entry.WorldPosition = WorldPosition;
+	Entry.FlowRate = FlowRate;
+	TotalFlowRate += FlowRate;
+	SourcesByPosition.Add(GetPositionKey(WorldPosition), SourceId);
+
+	if (!bBatchesDirty)
+	{
+		if (ResolveCell(WorldPosition, Entry.ChunkCoord, Entry.CellIndex))
+		{
+			InsertIntoBatch(SourceId, Entry);
+		}
+		else
+		{
+			bBatchesDirty = true;
+		}
+	}
+
+	return SourceId;
+}
+
+bool FFluidSourceRegistry::RemoveSource(int32 SourceId)
+{
+	FScopeLock Lock(&Mutex);
+	const FSourceEntry* Entry = Sources.Find(SourceId);
+	if (!Entry)
+		return false;
+
+	if (!bBatchesDirty && Entry->BatchSlot != INDEX_NONE)
+	{
+		RemoveFromBatch(*Entry);
+	}
+
+	const FIntVector PositionKey = GetPositionKey(Entry->WorldPosition);
+	if (SourcesByPosition.FindRef(PositionKey) == SourceId)
+	{
+		SourcesByPosition.Remove(PositionKey);
+	}
+
+	TotalFlowRate -= Entry->FlowRate;
+	Sources.Remove(SourceId);
+
+	if (Sources.Num() == 0)
+	{
+		TotalFlowRate = 0.0f; // Drop accumulated rounding
+	}
+	return true;
+}
+
+bool FFluidSourceRegistry::SetFlowRate(int32 SourceId, float FlowRate)
+{
+	FScopeLock Lock(&Mutex);
+	FSourceEntry* Entry = Sources.Find(SourceId);
+	if (!Entry)
+		return false;
+
+	TotalFlowRate += FlowRate - Entry->FlowRate;
+	Entry->FlowRate = FlowRate;
+
+	if (!bBatchesDirty && Entry->BatchSlot != INDEX_NONE)
+	{
+		if (FChunkBatch* Batch = Batches.Find(Entry->ChunkCoord))
+		{
+			Batch->FlowRates[Entry->BatchSlot] = FlowRate;
+		}
+	}
+	return true;
+}
+
+bool FFluidSourceRegistry::GetSourcePosition(int32 SourceId, FVector& OutPosition) const
+{
+	FScopeLock Lock(&Mutex);
+	if (const FSourceEntry* Entry = Sources.Find(SourceId))
+	{
+		OutPosition = Entry->WorldPosition;
+		return true;
+	}
+	return false;
+}
+
+int32 FFluidSourceRegistry::FindSourceAtPosition(const FVector& WorldPosition) const
+{
+	FScopeLock Lock(&Mutex);
+	FFluidChunkCoord ChunkCoord;
+	int32 CellIndex = INDEX_NONE;
+	if (!bBatchesDirty && ResolveCell(WorldPosition, ChunkCoord, CellIndex))
+	{
+		const int32* SourceId = SourcesByCell.Find(FCellKey(ChunkCoord, CellIndex));
+		return SourceId ? *SourceId : INDEX_NONE;
+	}
+
+	// Not bound to a chunk layout yet; match the rounded position
+	const int32* SourceId = SourcesByPosition.Find(GetPositionKey(WorldPosition));
+	return SourceId ? *SourceId : INDEX_NONE;
+}
+
+void FFluidSourceRegistry::Reset()
+{
+	FScopeLock Lock(&Mutex);
+	Sources.Reset();
+	Batches.Reset();
+	SourcesByCell.Reset();
+	SourcesByPosition.Reset();
+	TotalFlowRate = 0.0f;
+	bBatchesDirty = true;
+}
+
+void FFluidSourceRegistry::Bind(UFluidChunkManager* InChunkManager)
+{
+	FScopeLock Lock(&Mutex);
+	ChunkManager = InChunkManager;
+	bBatchesDirty = true;
+}
+
+void FFluidSourceRegistry::OnChunkUnloaded(const FFluidChunkCoord& ChunkCoord)
+{
+	FScopeLock Lock(&Mutex);
+	if (FChunkBatch* Batch = Batches.Find(ChunkCoord))
+	{
+		Batch->Chunk.Reset();
+	}
+}
+
+void FFluidSourceRegistry::PrepareChunks()
+{
+	FScopeLock Lock(&Mutex);
+
+	UFluidChunkManager* Manager = ChunkManager.Get();
+	if (!Manager || Sources.Num() == 0)
+		return;
+
+	if (bBatchesDirty)
+	{
+		RebuildBatches();
+	}
+
+	for (auto& Pair : Batches)
+	{
+		UFluidChunk* Chunk = ResolveChunk(Pair.Key, Pair.Value);
+		if (Chunk && Chunk->State == EChunkState::Inactive)
+		{
+			Manager->ForceActivateChunk(Chunk);
+		}
+	}
+}
+
+float FFluidSourceRegistry::ApplyEmissions(float DeltaTime, bool bAllowChunkCreation)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_FluidSourceUpdate);
+
+	FScopeLock Lock(&Mutex);
+
+	UFluidChunkManager* Manager = ChunkManager.Get();
+	if (!Manager || Sources.Num() == 0 || DeltaTime <= 0.0f)
+		return 0.0f;
+
+	if (bBatchesDirty)
+	{
+		RebuildBatches();
+	}
+
+	// Chunk creation and loading stay on the calling thread
+	TArray<UFluidChunk*> Chunks;
+	TArray<const FChunkBatch*> ChunkBatches;
+	Chunks.Reserve(Batches.Num());
+	ChunkBatches.Reserve(Batches.Num());
+
+	for (auto& Pair : Batches)
+	{
+		if (UFluidChunk* Chunk = ResolveChunk(Pair.Key, Pair.Value, bAllowChunkCreation))
+		{
+			Chunks.Add(Chunk);
+			ChunkBatches.Add(&Pair.Value);
+		}
+	}
+
+	TArray<float> ChunkVolumes;
+	ChunkVolumes.SetNumZeroed(Chunks.Num());
+
+	// Each chunk owns its cell buffers, so batches of different chunks can be written concurrently
+	ParallelFor(Chunks.Num(), [&](int32 Index)
+	{
+		const FChunkBatch& Batch = *ChunkBatches[Index];
+		ChunkVolumes[Index] = Chunks[Index]->AddFluidToCells(Batch.CellIndices, Batch.FlowRates, DeltaTime);
+	}, Chunks.Num() < 4 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	float TotalVolume = 0.0f;
+	for (int32 i = 0; i < Chunks.Num(); ++i)
+	{
+		TotalVolume += ChunkVolumes[i];
+
+		// Emitting chunks have to simulate; waking one may load its neighbours, so only where chunks may be created
+		if (bAllowChunkCreation && Chunks[i]->State == EChunkState::Inactive)
+		{
+			Manager->ForceActivateChunk(Chunks[i]);
+		}
+	}
+
+	return TotalVolume;
+}
+
+bool FFluidSourceRegistry::ResolveCell(const FVector& WorldPosition, FFluidChunkCoord& OutChunkCoord, int32& OutCellIndex) const
+{
+	const UFluidChunkManager* Manager = ChunkManager.Get();
+	if (!Manager || Manager->ChunkSize <= 0 || Manager->CellSize <= 0.0f)
+		return false;
+
+	const int32 ChunkSize = Manager->ChunkSize;
+	OutChunkCoord = Manager->GetChunkCoordFromWorldPosition(WorldPosition);
+
+	const FVector LocalPos = WorldPosition - Manager->GetChunkWorldPosition(OutChunkCoord);
+	const int32 X = FMath::Clamp(FMath::FloorToInt(LocalPos.X / Manager->CellSize), 0, ChunkSize - 1);
+	const int32 Y = FMath::Clamp(FMath::FloorToInt(LocalPos.Y / Manager->CellSize), 0, ChunkSize - 1);
+	const int32 Z = FMath::Clamp(FMath::FloorToInt(LocalPos.Z / Manager->CellSize), 0, ChunkSize - 1);
+
+	OutCellIndex = X + Y * ChunkSize + Z * ChunkSize * ChunkSize;
+	return true;
+}
+
+void FFluidSourceRegistry::InsertIntoBatch(int32 SourceId, FSourceEntry& Entry)
+{
+	FChunkBatch& Batch = Batches.FindOrAdd(Entry.ChunkCoord);
+	Entry.BatchSlot = Batch.CellIndices.Add(Entry.CellIndex);
+	Batch.FlowRates.Add(Entry.FlowRate);
+	Batch.SourceIds.Add(SourceId);
+	SourcesByCell.Add(FCellKey(Entry.ChunkCoord, Entry.CellIndex), SourceId);
+}
+
+void FFluidSourceRegistry::RemoveFromBatch(const FSourceEntry& Entry)
+{
+	FChunkBatch* Batch = Batches.Find(Entry.ChunkCoord);
+	if (!Batch || !Batch->SourceIds.IsValidIndex(Entry.BatchSlot))
+		return;
+
+	const int32 Slot = Entry.BatchSlot;
+	SourcesByCell.Remove(FCellKey(Entry.ChunkCoord, Entry.CellIndex));
+	Batch->CellIndices.RemoveAtSwap(Slot);
+	Batch->FlowRates.RemoveAtSwap(Slot);
+	Batch->SourceIds.RemoveAtSwap(Slot);
+
+	// The last source moved into the freed slot
+	if (Batch->SourceIds.IsValidIndex(Slot))
+	{
+		Sources[Batch->SourceIds[Slot]].BatchSlot = Slot;
+	}
+
+	if (Batch->SourceIds.Num() == 0)
+	{
+		Batches.Remove(Entry.ChunkCoord);
+	}
+}
+
+void FFluidSourceRegistry::RebuildBatches()
+{
+	Batches.Reset();
+	SourcesByCell.Reset();
+
+	// Every source is visited; one that cannot be placed yet keeps the registry dirty for the next rebuild
+	bool bAllResolved = true;
+	for (auto& Pair : Sources)
+	{
+		FSourceEntry& Entry = Pair.Value;
+		Entry.BatchSlot = INDEX_NONE;
+		if (ResolveCell(Entry.WorldPosition, Entry.ChunkCoord, Entry.CellIndex))
+		{
+			InsertIntoBatch(Pair.Key, Entry);
+		}
+		else
+		{
+			bAllResolved = false;
+		}
+	}
+
+	bBatchesDirty = !bAllResolved;
+}
+
+UFluidChunk* FFluidSourceRegistry::ResolveChunk(const FFluidChunkCoord& ChunkCoord, FChunkBatch& Batch, bool bAllowChunkCreation)
+{
+	UFluidChunk* Chunk = Batch.Chunk.Get();
+	if (Chunk && Chunk->State != EChunkState::Unloaded)
+		return Chunk;
+
+	if (!bAllowChunkCreation)
+		return nullptr;
+
+	UFluidChunkManager* Manager = ChunkManager.Get();
+	Chunk = Manager ? Manager->GetOrCreateChunk(ChunkCoord) : nullptr;
+	if (Chunk && Chunk->State == EChunkState::Unloaded)
+	{
+		Chunk->LoadChunk();
+	}
+
+	Batch.Chunk = Chunk;
+	return Chunk;
+}
@@ -2,6 +2,7 @@
 #include "CellularAutomata/CAFluidGrid.h"
 #include "CellularAutomata/FluidChunk.h"
 #include "VoxelFluidStats.h"
+#include "VoxelFluidMemory.h"
 #include "Async/ParallelFor.h"
 
 void FMultiResolutionSolver::SolvePressureMultiRes(
@@ -14,6 +15,7 @@ void FMultiResolutionSolver::SolvePressureMultiRes(
 		return;
 	
 	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_UpdateSimulation);
+	VOXELFLUID_ALLOC_SCOPE("MultiResPressure");
 	
 	const int32 HighResX = FluidGrid->GridSizeX;
 	const int32 HighResY = FluidGrid->GridSizeY;
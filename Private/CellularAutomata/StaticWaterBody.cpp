@@ -2,6 +2,8 @@
 #include "CellularAutomata/FluidChunk.h"
 #include "CellularAutomata/FluidChunkManager.h"
 #include "VoxelFluidStats.h"
+#include "VoxelFluidProfiler.h"
+#include "VoxelFluidMemory.h"
 
 UStaticWaterManager::UStaticWaterManager()
 {
@@ -9,6 +11,16 @@ UStaticWaterManager::UStaticWaterManager()
 	CachedChunkData.Empty();
 }
 
+void UStaticWaterManager::ReportMemory(FFluidMemoryReport& Report) const
+{
+	SIZE_T Bytes = sizeof(UStaticWaterManager) + StaticWaterRegions.GetAllocatedSize() + CachedChunkData.GetAllocatedSize();
+	for (const auto& Pair : CachedChunkData)
+	{
+		Bytes += Pair.Value.StaticWaterCells.GetAllocatedSize();
+	}
+	Report.Add(EFluidMemoryCategory::StaticWater, Bytes);
+}
+
 void UStaticWaterManager::AddStaticWaterRegion(const FStaticWaterRegion& Region)
 {
 	StaticWaterRegions.Add(Region);
@@ -212,6 +224,7 @@ void UStaticWaterManager::ApplyStaticWaterToChunk(UFluidChunk* Chunk) const
 							// Only place water if conditions are met
 							if (bCanPlaceWater)
 							{
+								Chunk->MassFlows.Add(EFluidMassCategory::StaticWater, 1.0f - Cell.FluidLevel);
 								Cell.FluidLevel = 1.0f;
 								Cell.bSettled = true;
 								Cell.bSourceBlock = true;
@@ -235,6 +248,8 @@ void UStaticWaterManager::ApplyStaticWaterToChunkWithTerrain(UFluidChunk* Chunk,
 	
 	if (!Chunk)
 		return;
+
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(FFluidFrameProfiler::Get(ChunkManager), EFluidFramePhase::StaticWater, Chunk->ChunkCoord);
 	
 	// Track water application history
 	static TMap<FFluidChunkCoord, int32> ChunkWaterApplicationCount;
@@ -412,6 +427,7 @@ void UStaticWaterManager::ApplyStaticWaterToChunkWithTerrain(UFluidChunk* Chunk,
 				{
 					if (!Chunk->Cells[i].bIsSolid) // Double-check not solid
 					{
+						Chunk->MassFlows.Add(EFluidMassCategory::StaticWater, 1.0f - Chunk->Cells[i].FluidLevel);
 						Chunk->Cells[i].FluidLevel = 1.0f;
 						Chunk->Cells[i].bSettled = true;
 						Chunk->Cells[i].bSourceBlock = true;
@@ -437,6 +453,7 @@ void UStaticWaterManager::ApplyStaticWaterToChunkWithTerrain(UFluidChunk* Chunk,
 								int32 Idx = Chunk->GetLocalCellIndex(LocalX, LocalY, LocalZ);
 								if (!Chunk->Cells[Idx].bIsSolid)
 								{
+									Chunk->MassFlows.Add(EFluidMassCategory::StaticWater, 1.0f - Chunk->Cells[Idx].FluidLevel);
 									Chunk->Cells[Idx].FluidLevel = 1.0f;
 									Chunk->Cells[Idx].bSettled = true;
 									Chunk->Cells[Idx].bSourceBlock = true;
@@ -631,6 +648,7 @@ void UStaticWaterManager::ApplyStaticWaterToChunkWithTerrain(UFluidChunk* Chunk,
 							if (bCanPlaceWater)
 							{
 								// Cell is not solid and passes terrain checks - safe to place water
+								Chunk->MassFlows.Add(EFluidMassCategory::StaticWater, 1.0f - Cell.FluidLevel);
 								Cell.FluidLevel = 1.0f;
 								Cell.bSettled = true;
 								Cell.bSourceBlock = true;
@@ -734,6 +752,7 @@ void UStaticWaterManager::SealChunkBordersAgainstTerrain(UFluidChunk* Chunk) con
 						if (bIsProblematicChunk)
 						{
 						}
+						Chunk->MassFlows.Add(EFluidMassCategory::StaticWater, -Cell.FluidLevel);
 						Cell.FluidLevel = 0.0f;
 						Cell.bSourceBlock = false;
 						BorderCellsRemoved++;
@@ -754,6 +773,7 @@ void UStaticWaterManager::SealChunkBordersAgainstTerrain(UFluidChunk* Chunk) con
 				{
 					if (CellWorldPos.Z < Cell.TerrainHeight + Chunk->CellSize * 1.5f)
 					{
+						Chunk->MassFlows.Add(EFluidMassCategory::StaticWater, -Cell.FluidLevel);
 						Cell.FluidLevel = 0.0f;
 						Cell.bSourceBlock = false;
 					}
@@ -777,6 +797,7 @@ void UStaticWaterManager::SealChunkBordersAgainstTerrain(UFluidChunk* Chunk) con
 				{
 					if (CellWorldPos.Z < Cell.TerrainHeight + Chunk->CellSize * 1.5f)
 					{
+						Chunk->MassFlows.Add(EFluidMassCategory::StaticWater, -Cell.FluidLevel);
 						Cell.FluidLevel = 0.0f;
 						Cell.bSourceBlock = false;
 					}
@@ -793,6 +814,7 @@ void UStaticWaterManager::SealChunkBordersAgainstTerrain(UFluidChunk* Chunk) con
 				{
 					if (CellWorldPos.Z < Cell.TerrainHeight + Chunk->CellSize * 1.5f)
 					{
+						Chunk->MassFlows.Add(EFluidMassCategory::StaticWater, -Cell.FluidLevel);
 						Cell.FluidLevel = 0.0f;
 						Cell.bSourceBlock = false;
 					}
@@ -814,6 +836,7 @@ void UStaticWaterManager::SealChunkBordersAgainstTerrain(UFluidChunk* Chunk) con
 				// Bottom cells should generally be solid or very close to terrain anyway
 				if (Cell.FluidLevel > 0.0f && Cell.bIsSolid)
 				{
+					Chunk->MassFlows.Add(EFluidMassCategory::StaticWater, -Cell.FluidLevel);
 					Cell.FluidLevel = 0.0f;
 					Cell.bSourceBlock = false;
 				}
@@ -1006,6 +1029,7 @@ void UStaticWaterManager::CreateDynamicFluidSourcesInRadius(UFluidChunk* Chunk,
 				if (Cell.FluidLevel < 0.1f)
 				{
 					// Empty excavated cell - fill it directly and make it dynamic
+					Chunk->MassFlows.Add(EFluidMassCategory::StaticWater, 1.0f - Cell.FluidLevel);
 					Cell.FluidLevel = 1.0f;
 					Cell.bSettled = false;  // Make it dynamic so it flows
 					Cell.bSourceBlock = false;  // Not static yet
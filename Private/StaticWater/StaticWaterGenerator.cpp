@@ -1,5 +1,7 @@
 #include "StaticWater/StaticWaterGenerator.h"
 #include "VoxelIntegration/VoxelFluidIntegration.h"
+#include "VoxelFluidDebug.h"
+#include "VoxelFluidMemory.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
 
@@ -26,6 +28,7 @@ void UStaticWaterGenerator::BeginPlay()
 	}
 
 	bIsInitialized = true;
+	FFluidMemoryTracker::Register(this);
 	
 	// Initial tile generation around viewer
 	RegenerateAroundViewer();
@@ -33,6 +36,8 @@ void UStaticWaterGenerator::BeginPlay()
 
 void UStaticWaterGenerator::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	FFluidMemoryTracker::Unregister(this);
+
 	if (GenerationSettings.bUseGPUGeneration)
 	{
 		ReleaseGPUResources();
@@ -41,6 +46,34 @@ void UStaticWaterGenerator::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
+void UStaticWaterGenerator::ReportMemory(FFluidMemoryReport& Report) const
+{
+	SIZE_T Bytes = WaterRegions.GetAllocatedSize();
+	for (const FStaticWaterRegionDef& Region : WaterRegions)
+	{
+		if (Region.BasinMask.IsValid())
+		{
+			Bytes += sizeof(FWaterBasinMask) + Region.BasinMask->Cells.GetAllocatedSize();
+		}
+	}
+
+	if (BasinAnalyzer.IsValid())
+	{
+		Bytes += sizeof(FWaterBasinAnalyzer) + BasinAnalyzer->GetAllocatedSize();
+	}
+
+	{
+		FScopeLock Lock(&TileCacheMutex);
+		Bytes += LoadedTiles.GetAllocatedSize() + ActiveTileCoords.GetAllocatedSize();
+		for (const auto& Pair : LoadedTiles)
+		{
+			Bytes += Pair.Value.TerrainHeights.GetAllocatedSize() + Pair.Value.WaterDepths.GetAllocatedSize();
+		}
+	}
+
+	Report.Add(EFluidMemoryCategory::StaticWater, Bytes);
+}
+
 void UStaticWaterGenerator::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -48,6 +81,7 @@ void UStaticWaterGenerator::TickComponent(float DeltaTime, ELevelTick TickType,
 	if (!bIsInitialized)
 		return;
 
+	UpdateBasinAnalysis();
 	UpdateTileGeneration(DeltaTime);
 
 #if WITH_EDITOR
@@ -88,22 +122,7 @@ void UStaticWaterGenerator::AddWaterRegion(const FStaticWaterRegionDef& Region)
 	WaterRegions.Add(Region);
 	
 	// Mark affected tiles for regeneration
-	const FBox& Bounds = Region.Bounds;
-	const FIntVector MinTile = WorldPositionToTileCoord(Bounds.Min);
-	const FIntVector MaxTile = WorldPositionToTileCoord(Bounds.Max);
-	
-	FScopeLock Lock(&TileCacheMutex);
-	for (int32 X = MinTile.X; X <= MaxTile.X; ++X)
-	{
-		for (int32 Y = MinTile.Y; Y <= MaxTile.Y; ++Y)
-		{
-			const FIntVector TileCoord(X, Y, 0);
-			if (FStaticWaterTile* Tile = LoadedTiles.Find(TileCoord))
-			{
-				Tile->bNeedsUpdate = true;
-			}
-		}
-	}
+	MarkTilesInRegionForUpdate(Region);
 }
 
 void UStaticWaterGenerator::RemoveWaterRegion(int32 RegionIndex)
@@ -115,20 +134,62 @@ void UStaticWaterGenerator::RemoveWaterRegion(int32 RegionIndex)
 	WaterRegions.RemoveAt(RegionIndex);
 	
 	// Mark affected tiles for regeneration
-	const FBox& Bounds = RemovedRegion.Bounds;
-	const FIntVector MinTile = WorldPositionToTileCoord(Bounds.Min);
-	const FIntVector MaxTile = WorldPositionToTileCoord(Bounds.Max);
+	MarkTilesInRegionForUpdate(RemovedRegion);
+}
+
+void UStaticWaterGenerator::UpdateWaterRegion(int32 RegionIndex, const FStaticWaterRegionDef& Region)
+{
+	if (!WaterRegions.IsValidIndex(RegionIndex))
+		return;
+		
+	const FStaticWaterRegionDef OldRegion = WaterRegions[RegionIndex];
+	WaterRegions[RegionIndex] = Region;
+	
+	// Anything other than an XY move changes the water in every tile the region touches
+	const bool bXYMoveOnly = OldRegion.WaterLevel == Region.WaterLevel &&
+		OldRegion.bInfiniteDepth == Region.bInfiniteDepth &&
+		OldRegion.MinDepth == Region.MinDepth &&
+		OldRegion.Priority == Region.Priority &&
+		OldRegion.bUnboundedXY == Region.bUnboundedXY &&
+		OldRegion.Bounds.Min.Z == Region.Bounds.Min.Z &&
+		OldRegion.Bounds.Max.Z == Region.Bounds.Max.Z;
+		
+	if (!bXYMoveOnly)
+	{
+		MarkTilesInRegionForUpdate(OldRegion);
+		MarkTilesInRegionForUpdate(Region);
+		return;
+	}
 	
+	// An unbounded region covers the same tiles wherever its bounds are centred
+	if (Region.bUnboundedXY)
+		return;
+		
+	// 0 = outside, 1 = partially covered, 2 = fully covered
+	auto GetTileCoverage = [](const FBox& TileBounds, const FBox& RegionBounds) -> int32
+	{
+		if (TileBounds.Max.X <= RegionBounds.Min.X || TileBounds.Min.X >= RegionBounds.Max.X ||
+			TileBounds.Max.Y <= RegionBounds.Min.Y || TileBounds.Min.Y >= RegionBounds.Max.Y)
+		{
+			return 0;
+		}
+		
+		const bool bFullyInside = TileBounds.Min.X >= RegionBounds.Min.X && TileBounds.Max.X <= RegionBounds.Max.X &&
+			TileBounds.Min.Y >= RegionBounds.Min.Y && TileBounds.Max.Y <= RegionBounds.Max.Y;
+		return bFullyInside ? 2 : 1;
+	};
+	
+	// Only tiles along the leading and trailing edges of the footprint change
 	FScopeLock Lock(&TileCacheMutex);
-	for (int32 X = MinTile.X; X <= MaxTile.X; ++X)
+	for (auto& TilePair : LoadedTiles)
 	{
-		for (int32 Y = MinTile.Y; Y <= MaxTile.Y; ++Y)
+		FStaticWaterTile& Tile = TilePair.Value;
+		const int32 OldCoverage = GetTileCoverage(Tile.WorldBounds, OldRegion.Bounds);
+		const int32 NewCoverage = GetTileCoverage(Tile.WorldBounds, Region.Bounds);
+		
+		if (OldCoverage != NewCoverage || OldCoverage == 1)
 		{
-			const FIntVector TileCoord(X, Y, 0);
-			if (FStaticWaterTile* Tile = LoadedTiles.Find(TileCoord))
-			{
-				Tile->bNeedsUpdate = true;
-			}
+			Tile.bNeedsUpdate = true;
 		}
 	}
 }
@@ -145,6 +206,11 @@ void UStaticWaterGenerator::ClearAllWaterRegions()
 	}
 }
 
+int32 UStaticWaterGenerator::FindOceanRegion() const
+{
+	return WaterRegions.IndexOfByPredicate([](const FStaticWaterRegionDef& Region) { return Region.bIsOcean; });
+}
+
 void UStaticWaterGenerator::SetViewerPosition(const FVector& Position)
 {
 	ViewerPosition = Position;
@@ -183,15 +249,111 @@ void UStaticWaterGenerator::OnTerrainChanged(const FBox& ChangedBounds)
 			{
 				Tile->bNeedsUpdate = true;
 				
-				if (bEnableLogging)
-				{
-					UE_LOG(LogTemp, Log, TEXT("StaticWaterGenerator: Marked tile (%d, %d) for regeneration due to terrain change"), TileCoord.X, TileCoord.Y);
-				}
+				VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidStaticWater, Verbose, TEXT("StaticWaterGenerator: Marked tile (%d, %d) for regeneration due to terrain change"), TileCoord.X, TileCoord.Y);
 			}
 		}
 	}
 }
 
+void UStaticWaterGenerator::GenerateBasinLakes(const FBox& Area)
+{
+	if (!Area.IsValid)
+		return;
+		
+	FWaterBasinAnalysisSettings AnalysisSettings;
+	AnalysisSettings.Origin = FVector2D(Area.Min);
+	AnalysisSettings.CellSize = BasinSettings.CellSize;
+	AnalysisSettings.CellsX = FMath::CeilToInt((Area.Max.X - Area.Min.X) / BasinSettings.CellSize);
+	AnalysisSettings.CellsY = FMath::CeilToInt((Area.Max.Y - Area.Min.Y) / BasinSettings.CellSize);
+	AnalysisSettings.TileCells = BasinSettings.TileCells;
+	AnalysisSettings.MinLakeDepth = BasinSettings.MinLakeDepth;
+	AnalysisSettings.MinLakeCells = BasinSettings.MinLakeCells;
+	
+	// Cell centres sampled on the game thread (VoxelPlugin requirement), one tile block per call
+	const FVector2D Origin = AnalysisSettings.Origin;
+	const float CellSize = AnalysisSettings.CellSize;
+	FWaterBasinAnalyzer::FHeightSampler Sampler = [this, Origin, CellSize](const FIntPoint& CellOrigin, int32 SizeX, int32 SizeY, TArray<float>& OutHeights)
+	{
+		OutHeights.SetNumUninitialized(SizeX * SizeY);
+		for (int32 Y = 0; Y < SizeY; ++Y)
+		{
+			for (int32 X = 0; X < SizeX; ++X)
+			{
+				const FVector WorldPos(
+					Origin.X + (CellOrigin.X + X + 0.5f) * CellSize,
+					Origin.Y + (CellOrigin.Y + Y + 0.5f) * CellSize,
+					0.0f
+				);
+				
+				float Height;
+				OutHeights[X + Y * SizeX] = SampleTerrainHeight(WorldPos, Height) ? Height : 0.0f;
+			}
+		}
+	};
+	
+	BasinAnalyzer = MakeUnique<FWaterBasinAnalyzer>(AnalysisSettings, MoveTemp(Sampler));
+	
+	if (bEnableLogging)
+	{
+		UE_LOG(LogTemp, Log, TEXT("StaticWaterGenerator: Started basin analysis over %dx%d cells (%.0fcm)"), 
+			AnalysisSettings.CellsX, AnalysisSettings.CellsY, AnalysisSettings.CellSize);
+	}
+}
+
+void UStaticWaterGenerator::ClearBasinLakes()
+{
+	for (int32 i = WaterRegions.Num() - 1; i >= 0; --i)
+	{
+		if (WaterRegions[i].BasinMask.IsValid())
+		{
+			RemoveWaterRegion(i);
+		}
+	}
+}
+
+float UStaticWaterGenerator::GetBasinAnalysisProgress() const
+{
+	return BasinAnalyzer.IsValid() ? BasinAnalyzer->GetProgress() : 1.0f;
+}
+
+void UStaticWaterGenerator::UpdateBasinAnalysis()
+{
+	if (!BasinAnalyzer.IsValid())
+		return;
+		
+	for (int32 i = 0; i < BasinSettings.TilesPerFrame && !BasinAnalyzer->IsComplete(); ++i)
+	{
+		BasinAnalyzer->Step();
+	}
+	
+	if (!BasinAnalyzer->IsComplete())
+		return;
+		
+	// Replace the previous analysis' lakes with the new ones
+	ClearBasinLakes();
+	
+	for (const FWaterBasin& Basin : BasinAnalyzer->GetBasins())
+	{
+		FStaticWaterRegionDef Region;
+		Region.Bounds = Basin.Bounds;
+		Region.WaterLevel = Basin.SpillHeight;
+		Region.bInfiniteDepth = false;
+		Region.MinDepth = 0.0f;
+		Region.Priority = BasinSettings.LakePriority;
+		Region.BasinMask = Basin.Mask;
+		
+		AddWaterRegion(Region);
+	}
+	
+	if (bEnableLogging)
+	{
+		UE_LOG(LogTemp, Log, TEXT("StaticWaterGenerator: Basin analysis complete - %d lake regions"), 
+			BasinAnalyzer->GetBasins().Num());
+	}
+	
+	BasinAnalyzer.Reset();
+}
+
 bool UStaticWaterGenerator::HasStaticWaterAtLocation(const FVector& WorldPosition) const
 {
 	float WaterLevel;
@@ -218,6 +380,21 @@ float UStaticWaterGenerator::GetWaterDepthAtLocation(const FVector& WorldPositio
 	return 0.0f;
 }
 
+bool UStaticWaterGenerator::GetWaterColumnAtLocation(const FVector& WorldPosition, float& OutSurfaceZ, float& OutFloorZ) const
+{
+	const FStaticWaterRegionDef* Region = GetHighestPriorityRegionAtPosition(WorldPosition);
+	if (!Region)
+	{
+		OutSurfaceZ = -MAX_flt;
+		OutFloorZ = -MAX_flt;
+		return false;
+	}
+	
+	OutSurfaceZ = Region->WaterLevel;
+	OutFloorZ = Region->bInfiniteDepth ? -MAX_flt : Region->Bounds.Min.Z;
+	return OutSurfaceZ > OutFloorZ;
+}
+
 TArray<FIntVector> UStaticWaterGenerator::GetActiveTileCoords() const
 {
 	FScopeLock Lock(&TileCacheMutex);
@@ -243,6 +420,10 @@ void UStaticWaterGenerator::UpdateTileGeneration(float DeltaTime)
 		FIntVector TileCoord;
 		if (TileLoadQueue.Dequeue(TileCoord))
 		{
+			// Skip tiles that left range again before their load came up
+			if (!IsTileActive(TileCoord))
+				continue;
+				
 			LoadTile(TileCoord);
 			++TilesGeneratedThisFrame;
 		}
@@ -254,6 +435,10 @@ void UStaticWaterGenerator::UpdateTileGeneration(float DeltaTime)
 		FIntVector TileCoord;
 		if (TileUnloadQueue.Dequeue(TileCoord))
 		{
+			// Keep tiles that came back into range before their unload came up
+			if (IsTileActive(TileCoord))
+				continue;
+				
 			UnloadTile(TileCoord);
 		}
 	}
@@ -287,11 +472,9 @@ void UStaticWaterGenerator::GenerateTileData(FStaticWaterTile& Tile)
 	
 	LastGenerationTime = FPlatformTime::Seconds() - StartTime;
 	
-	if (bEnableLogging)
-	{
-		UE_LOG(LogTemp, Log, TEXT("StaticWaterGenerator: Generated tile (%d, %d) in %.3fms"), 
-			Tile.TileCoord.X, Tile.TileCoord.Y, LastGenerationTime * 1000.0f);
-	}
+	VOXELFLUID_TRACE(StaticTileGenerated, Tile.TileCoord.X, Tile.TileCoord.Y, 0, LastGenerationTime * 1000.0f);
+	VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidStaticWater, Log, TEXT("StaticWaterGenerator: Generated tile (%d, %d) in %.3fms"), 
+		Tile.TileCoord.X, Tile.TileCoord.Y, LastGenerationTime * 1000.0f);
 }
 
 void UStaticWaterGenerator::GenerateTileDataGPU(FStaticWaterTile& Tile)
@@ -516,10 +699,7 @@ void UStaticWaterGenerator::LoadTile(const FIntVector& TileCoord)
 	NewTile.Initialize(TileCoord, GenerationSettings.TileSize, GenerationSettings.CellSize);
 	NewTile.bNeedsUpdate = true;
 	
-	if (bEnableLogging)
-	{
-		UE_LOG(LogTemp, Log, TEXT("StaticWaterGenerator: Loaded tile (%d, %d)"), TileCoord.X, TileCoord.Y);
-	}
+	VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidStaticWater, Verbose, TEXT("StaticWaterGenerator: Loaded tile (%d, %d)"), TileCoord.X, TileCoord.Y);
 }
 
 void UStaticWaterGenerator::UnloadTile(const FIntVector& TileCoord)
@@ -528,13 +708,8 @@ void UStaticWaterGenerator::UnloadTile(const FIntVector& TileCoord)
 	
 	if (LoadedTiles.Remove(TileCoord) > 0)
 	{
-		if (bEnableLogging)
-		{
-			UE_LOG(LogTemp, Log, TEXT("StaticWaterGenerator: Unloaded tile (%d, %d)"), TileCoord.X, TileCoord.Y);
-		}
+		VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidStaticWater, Verbose, TEXT("StaticWaterGenerator: Unloaded tile (%d, %d)"), TileCoord.X, TileCoord.Y);
 	}
-	
-	ActiveTileCoords.Remove(TileCoord);
 }
 
 bool UStaticWaterGenerator::ShouldLoadTile(const FIntVector& TileCoord) const
@@ -549,6 +724,42 @@ bool UStaticWaterGenerator::ShouldUnloadTile(const FIntVector& TileCoord) const
 	return !ShouldLoadTile(TileCoord);
 }
 
+bool UStaticWaterGenerator::IsTileActive(const FIntVector& TileCoord) const
+{
+	FScopeLock Lock(&TileCacheMutex);
+	return ActiveTileCoords.Contains(TileCoord);
+}
+
+void UStaticWaterGenerator::MarkTilesInRegionForUpdate(const FStaticWaterRegionDef& Region)
+{
+	FScopeLock Lock(&TileCacheMutex);
+	
+	// Unbounded regions touch every loaded tile; don't walk their (arbitrary) bounds
+	if (Region.bUnboundedXY)
+	{
+		for (auto& TilePair : LoadedTiles)
+		{
+			TilePair.Value.bNeedsUpdate = true;
+		}
+		return;
+	}
+	
+	const FIntVector MinTile = WorldPositionToTileCoord(Region.Bounds.Min);
+	const FIntVector MaxTile = WorldPositionToTileCoord(Region.Bounds.Max);
+	
+	for (int32 X = MinTile.X; X <= MaxTile.X; ++X)
+	{
+		for (int32 Y = MinTile.Y; Y <= MaxTile.Y; ++Y)
+		{
+			const FIntVector TileCoord(X, Y, 0);
+			if (FStaticWaterTile* Tile = LoadedTiles.Find(TileCoord))
+			{
+				Tile->bNeedsUpdate = true;
+			}
+		}
+	}
+}
+
 bool UStaticWaterGenerator::EvaluateWaterAtPosition(const FVector& Position, float& OutWaterLevel) const
 {
 	const FStaticWaterRegionDef* Region = GetHighestPriorityRegionAtPosition(Position);
@@ -626,6 +837,10 @@ void UStaticWaterGenerator::DrawDebugInfo() const
 			const FStaticWaterRegionDef& Region = WaterRegions[i];
 			const FColor RegionColor = FColor::Cyan;
 			
+			// Unbounded regions have no meaningful box to draw
+			if (Region.bUnboundedXY)
+				continue;
+			
 			// Draw region bounds
 			DrawDebugBox(World, Region.Bounds.GetCenter(), Region.Bounds.GetExtent(), 
 				RegionColor, false, -1.0f, 0, 5.0f);
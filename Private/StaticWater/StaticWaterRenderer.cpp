@@ -1,5 +1,7 @@
 #include "StaticWater/StaticWaterRenderer.h"
 #include "StaticWater/StaticWaterGenerator.h"
+#include "VoxelFluidDebug.h"
+#include "VoxelFluidMemory.h"
 #include "VoxelIntegration/VoxelFluidIntegration.h"
 #include "Actors/VoxelFluidActor.h"
 #include "Actors/VoxelStaticWaterActor.h"
@@ -25,6 +27,8 @@ UStaticWaterRenderer::UStaticWaterRenderer()
 void UStaticWaterRenderer::BeginPlay()
 {
 	Super::BeginPlay();
+
+	FFluidMemoryTracker::Register(this);
 	
 	// Find water generator on the same actor
 	if (AActor* Owner = GetOwner())
@@ -79,6 +83,8 @@ void UStaticWaterRenderer::BeginPlay()
 
 void UStaticWaterRenderer::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	FFluidMemoryTracker::Unregister(this);
+
 	// Clean up all mesh components
 	FScopeLock Lock(&RenderChunkMutex);
 	
@@ -106,18 +112,43 @@ void UStaticWaterRenderer::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 }
 
+void UStaticWaterRenderer::ReportMemory(FFluidMemoryReport& Report) const
+{
+	FScopeLock Lock(&RenderChunkMutex);
+
+	SIZE_T Bytes = LoadedRenderChunks.GetAllocatedSize() + ActiveRenderChunkCoords.GetAllocatedSize() + ViewerPositions.GetAllocatedSize()
+		+ AvailableMeshComponents.GetAllocatedSize() + UsedMeshComponents.GetAllocatedSize();
+
+	for (const auto& Pair : LoadedRenderChunks)
+	{
+		const FStaticWaterRenderChunk& Chunk = Pair.Value;
+		Bytes += Chunk.Vertices.GetAllocatedSize() + Chunk.Triangles.GetAllocatedSize() + Chunk.Normals.GetAllocatedSize() + Chunk.UVs.GetAllocatedSize();
+
+		// CPU copy kept by the procedural mesh component
+		if (Chunk.MeshComponent)
+		{
+			for (int32 SectionIndex = 0; SectionIndex < Chunk.MeshComponent->GetNumSections(); ++SectionIndex)
+			{
+				if (const FProcMeshSection* Section = Chunk.MeshComponent->GetProcMeshSection(SectionIndex))
+				{
+					Bytes += Section->ProcVertexBuffer.GetAllocatedSize() + Section->ProcIndexBuffer.GetAllocatedSize();
+				}
+			}
+		}
+	}
+
+	Report.Add(EFluidMemoryCategory::StaticWaterRender, Bytes);
+}
+
 void UStaticWaterRenderer::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	
 	if (!bIsInitialized || !bRenderingEnabled)
 	{
-		if (bEnableLogging)
-		{
-			UE_LOG(LogTemp, VeryVerbose, TEXT("StaticWaterRenderer: Tick skipped - bIsInitialized: %s, bRenderingEnabled: %s"), 
-				bIsInitialized ? TEXT("true") : TEXT("false"),
-				bRenderingEnabled ? TEXT("true") : TEXT("false"));
-		}
+		VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, VeryVerbose, TEXT("StaticWaterRenderer: Tick skipped - bIsInitialized: %s, bRenderingEnabled: %s"), 
+			bIsInitialized ? TEXT("true") : TEXT("false"),
+			bRenderingEnabled ? TEXT("true") : TEXT("false"));
 		return;
 	}
 
@@ -132,11 +163,8 @@ void UStaticWaterRenderer::TickComponent(float DeltaTime, ELevelTick TickType, F
 				FVector NewPlayerPos = PlayerPawn->GetActorLocation();
 				ViewerPositions.Add(NewPlayerPos);
 				
-				if (bEnableLogging)
-				{
-					UE_LOG(LogTemp, VeryVerbose, TEXT("StaticWaterRenderer: Auto-tracked viewer position to %s"), 
-						*NewPlayerPos.ToString());
-				}
+				VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, VeryVerbose, TEXT("StaticWaterRenderer: Auto-tracked viewer position to %s"), 
+					*NewPlayerPos.ToString());
 			}
 		}
 	}
@@ -151,18 +179,13 @@ void UStaticWaterRenderer::TickComponent(float DeltaTime, ELevelTick TickType, F
 		const float StartDistance = FMath::Min(MinStartDistance, OriginalMaxRenderDistance * 0.25f);
 		RenderSettings.MaxRenderDistance = FMath::Lerp(StartDistance, OriginalMaxRenderDistance, ProgressAlpha);
 		
-		if (bEnableLogging && FMath::FloorToInt(StartupTime) != FMath::FloorToInt(StartupTime - DeltaTime))
-		{
-			UE_LOG(LogTemp, Log, TEXT("StaticWaterRenderer: Progressive loading - render distance: %.0f/%.0f"), 
-				RenderSettings.MaxRenderDistance, OriginalMaxRenderDistance);
-		}
+		VOXELFLUID_CLOG(bEnableLogging && FMath::FloorToInt(StartupTime) != FMath::FloorToInt(StartupTime - DeltaTime),
+			LogVoxelFluidRender, Log, TEXT("StaticWaterRenderer: Progressive loading - render distance: %.0f/%.0f"), 
+			RenderSettings.MaxRenderDistance, OriginalMaxRenderDistance);
 	}
 
-	if (bEnableLogging)
-	{
-		UE_LOG(LogTemp, VeryVerbose, TEXT("StaticWaterRenderer: Tick - %d viewers, %d active chunks"), 
-			ViewerPositions.Num(), GetActiveRenderChunkCount());
-	}
+	VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, VeryVerbose, TEXT("StaticWaterRenderer: Tick - %d viewers, %d active chunks"), 
+		ViewerPositions.Num(), GetActiveRenderChunkCount());
 
 	UpdateRenderChunks(DeltaTime);
 
@@ -289,6 +312,36 @@ void UStaticWaterRenderer::RebuildChunksInRadius(const FVector& Center, float Ra
 	}
 }
 
+void UStaticWaterRenderer::RebuildChunksForRegionMove(const FBox& OldBounds, const FBox& NewBounds)
+{
+	// 0 = outside, 1 = partially covered, 2 = fully covered
+	auto GetChunkCoverage = [](const FBox& ChunkBounds, const FBox& RegionBounds) -> int32
+	{
+		if (ChunkBounds.Max.X <= RegionBounds.Min.X || ChunkBounds.Min.X >= RegionBounds.Max.X ||
+			ChunkBounds.Max.Y <= RegionBounds.Min.Y || ChunkBounds.Min.Y >= RegionBounds.Max.Y)
+		{
+			return 0;
+		}
+		
+		const bool bFullyInside = ChunkBounds.Min.X >= RegionBounds.Min.X && ChunkBounds.Max.X <= RegionBounds.Max.X &&
+			ChunkBounds.Min.Y >= RegionBounds.Min.Y && ChunkBounds.Max.Y <= RegionBounds.Max.Y;
+		return bFullyInside ? 2 : 1;
+	};
+	
+	FScopeLock Lock(&RenderChunkMutex);
+	for (auto& ChunkPair : LoadedRenderChunks)
+	{
+		FStaticWaterRenderChunk& Chunk = ChunkPair.Value;
+		const int32 OldCoverage = GetChunkCoverage(Chunk.WorldBounds, OldBounds);
+		const int32 NewCoverage = GetChunkCoverage(Chunk.WorldBounds, NewBounds);
+		
+		if (OldCoverage != NewCoverage || OldCoverage == 1)
+		{
+			Chunk.bNeedsRebuild = true;
+		}
+	}
+}
+
 void UStaticWaterRenderer::RegenerateAroundViewer()
 {
 	// Regenerating chunks around viewer
@@ -439,24 +492,30 @@ void UStaticWaterRenderer::UpdateRenderChunks(float DeltaTime)
 		FIntVector ChunkCoord;
 		if (ChunkLoadQueue.Dequeue(ChunkCoord))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: Loading chunk (%d, %d) - Frame limit: %d/%d"), 
+			// Skip chunks that left range again before their load came up
+			if (!IsRenderChunkActive(ChunkCoord))
+				continue;
+				
+			VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: Loading chunk (%d, %d) - Frame limit: %d/%d"), 
 				ChunkCoord.X, ChunkCoord.Y, ChunksUpdatedThisFrame + 1, MaxChunksToCreate);
 			LoadRenderChunk(ChunkCoord);
 			++ChunksUpdatedThisFrame;
 		}
 	}
 	
+#if VOXELFLUID_DIAGNOSTICS
 	// Debug: Show queue status
-	if (ChunksUpdatedThisFrame == 0 && ChunkLoadQueue.IsEmpty())
+	if (bEnableLogging && ChunksUpdatedThisFrame == 0 && ChunkLoadQueue.IsEmpty())
 	{
-		static float LastLogTime = 0.0f;
-		float CurrentTime = FPlatformTime::Seconds();
-		if (CurrentTime - LastLogTime > 2.0f) // Log every 2 seconds
+		static double LastLogTime = 0.0;
+		const double CurrentTime = FPlatformTime::Seconds();
+		if (CurrentTime - LastLogTime > 2.0) // Log every 2 seconds
 		{
-			UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: No chunks in load queue, %d chunks loaded"), LoadedRenderChunks.Num());
+			VOXELFLUID_LOG(LogVoxelFluidRender, Log, TEXT("StaticWaterRenderer: No chunks in load queue, %d chunks loaded"), LoadedRenderChunks.Num());
 			LastLogTime = CurrentTime;
 		}
 	}
+#endif
 	
 	// Unload distant chunks
 	while (!ChunkUnloadQueue.IsEmpty())
@@ -464,6 +523,10 @@ void UStaticWaterRenderer::UpdateRenderChunks(float DeltaTime)
 		FIntVector ChunkCoord;
 		if (ChunkUnloadQueue.Dequeue(ChunkCoord))
 		{
+			// Keep chunks that came back into range before their unload came up
+			if (IsRenderChunkActive(ChunkCoord))
+				continue;
+				
 			UnloadRenderChunk(ChunkCoord);
 		}
 	}
@@ -560,7 +623,7 @@ void UStaticWaterRenderer::UpdateActiveRenderChunks()
 	TSet<FIntVector> NewActiveChunks;
 	
 	// Debug viewer positions
-	UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: Updating chunks for %d viewers, ChunkRadius: %d, MaxDistance: %.0f"), 
+	VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: Updating chunks for %d viewers, ChunkRadius: %d, MaxDistance: %.0f"), 
 		ViewerPositions.Num(), ChunkRadius, MaxDistance);
 	
 	// Determine which chunks should be active based on all viewers
@@ -569,7 +632,7 @@ void UStaticWaterRenderer::UpdateActiveRenderChunks()
 		const FVector& ViewerPos = ViewerPositions[ViewerIndex];
 		const FIntVector ViewerChunk = WorldPositionToRenderChunkCoord(ViewerPos);
 		
-		UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: Viewer %d at %s -> Chunk (%d, %d)"), 
+		VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: Viewer %d at %s -> Chunk (%d, %d)"), 
 			ViewerIndex, *ViewerPos.ToString(), ViewerChunk.X, ViewerChunk.Y);
 		
 		for (int32 X = -ChunkRadius; X <= ChunkRadius; ++X)
@@ -584,11 +647,9 @@ void UStaticWaterRenderer::UpdateActiveRenderChunks()
 				if (Distance <= MaxDistance)
 				{
 					NewActiveChunks.Add(ChunkCoord);
-					if (ViewerIndex == 0 && FMath::Abs(X) <= 1 && FMath::Abs(Y) <= 1) // Log nearby chunks only
-					{
-						UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: Added chunk (%d, %d) at distance %.0f"), 
-							ChunkCoord.X, ChunkCoord.Y, Distance);
-					}
+					VOXELFLUID_CLOG(bEnableLogging && ViewerIndex == 0 && FMath::Abs(X) <= 1 && FMath::Abs(Y) <= 1, // Log nearby chunks only
+						LogVoxelFluidRender, VeryVerbose, TEXT("StaticWaterRenderer: Added chunk (%d, %d) at distance %.0f"), 
+						ChunkCoord.X, ChunkCoord.Y, Distance);
 				}
 			}
 		}
@@ -610,7 +671,8 @@ void UStaticWaterRenderer::UpdateActiveRenderChunks()
 	
 	if (ChunksQueued > 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: Queued %d chunks for loading from %d active chunks"), 
+		VOXELFLUID_TRACE(RenderLoadQueue, ChunksQueued, NewActiveChunks.Num(), LoadedRenderChunks.Num());
+		VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, Log, TEXT("StaticWaterRenderer: Queued %d chunks for loading from %d active chunks"), 
 			ChunksQueued, NewActiveChunks.Num());
 	}
 	
@@ -681,8 +743,8 @@ void UStaticWaterRenderer::LoadRenderChunk(const FIntVector& ChunkCoord)
 	NewChunk.MeshComponent = CreateMeshComponent(ChunkCoord);
 	NewChunk.bNeedsRebuild = true;
 	
-	// Force detailed logging for initial chunk loading to debug terrain sampling issue
-	UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: 🌊 LOADED render chunk (%d, %d) at distance %.1fm, LOD%d [LOD0Dist=%.0f, LOD1Dist=%.0f]"), 
+	VOXELFLUID_TRACE(RenderChunkLoaded, ChunkCoord.X, ChunkCoord.Y, NewChunk.LODLevel, Distance);
+	VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, Log, TEXT("StaticWaterRenderer: LOADED render chunk (%d, %d) at distance %.1fm, LOD%d [LOD0Dist=%.0f, LOD1Dist=%.0f]"), 
 		ChunkCoord.X, ChunkCoord.Y, Distance, NewChunk.LODLevel, RenderSettings.LOD0Distance, RenderSettings.LOD1Distance);
 }
 
@@ -699,11 +761,10 @@ void UStaticWaterRenderer::UnloadRenderChunk(const FIntVector& ChunkCoord)
 		
 		LoadedRenderChunks.Remove(ChunkCoord);
 		
-		UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: ❌ UNLOADED render chunk (%d, %d)"), 
+		VOXELFLUID_TRACE(RenderChunkUnloaded, ChunkCoord.X, ChunkCoord.Y);
+		VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, Log, TEXT("StaticWaterRenderer: UNLOADED render chunk (%d, %d)"), 
 			ChunkCoord.X, ChunkCoord.Y);
 	}
-	
-	ActiveRenderChunkCoords.Remove(ChunkCoord);
 }
 
 bool UStaticWaterRenderer::ShouldLoadRenderChunk(const FIntVector& ChunkCoord) const
@@ -722,9 +783,15 @@ bool UStaticWaterRenderer::ShouldUnloadRenderChunk(const FIntVector& ChunkCoord)
 	return !ShouldLoadRenderChunk(ChunkCoord);
 }
 
+bool UStaticWaterRenderer::IsRenderChunkActive(const FIntVector& ChunkCoord) const
+{
+	FScopeLock Lock(&RenderChunkMutex);
+	return ActiveRenderChunkCoords.Contains(ChunkCoord);
+}
+
 void UStaticWaterRenderer::BuildChunkMesh(FStaticWaterRenderChunk& Chunk)
 {
-	UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: BuildChunkMesh called for chunk (%d, %d)"), 
+	VOXELFLUID_LOG(LogVoxelFluidRender, VeryVerbose, TEXT("StaticWaterRenderer: BuildChunkMesh called for chunk (%d, %d)"), 
 		Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y);
 		
 	if (!WaterGenerator || !Chunk.MeshComponent || !Chunk.MeshComponent->IsValidLowLevel())
@@ -784,39 +851,25 @@ void UStaticWaterRenderer::BuildChunkMesh(FStaticWaterRenderChunk& Chunk)
 	
 	bool bHasWater = WaterGenerator->HasStaticWaterAtLocation(ChunkCenter);
 	
-	// Always log water checks to debug the issue
-	UE_LOG(LogTemp, Log, TEXT("StaticWaterRenderer: Checking water at chunk center %s: %s"), 
+	VOXELFLUID_LOG(LogVoxelFluidRender, VeryVerbose, TEXT("StaticWaterRenderer: Checking water at chunk center %s: %s"), 
 		*ChunkCenter.ToString(), bHasWater ? TEXT("HAS WATER") : TEXT("NO WATER"));
 	
-	// Debug: Also check the water level
-	if (bHasWater)
-	{
-		float WaterLevel = WaterGenerator->GetWaterLevelAtLocation(ChunkCenter);
-		UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: ✅ FOUND WATER at %s, level: %.1f"), 
-			*ChunkCenter.ToString(), WaterLevel);
-	}
-	
 	if (!bHasWater)
 	{
 		// No water in this chunk, clear the mesh
 		Chunk.MeshComponent->ClearAllMeshSections();
 		
-		if (bEnableLogging)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: No water found at chunk center %s - clearing mesh"), 
-				*ChunkCenter.ToString());
-		}
+		VOXELFLUID_TRACE(RenderMeshEmpty, Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y, Chunk.LODLevel);
+		VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: No water found at chunk center %s - clearing mesh"), 
+			*ChunkCenter.ToString());
 		return;
 	}
 	
 	// Generate water surface mesh
 	GenerateWaterSurface(Chunk);
 	
-	if (bEnableLogging)
-	{
-		UE_LOG(LogTemp, Log, TEXT("StaticWaterRenderer: Generated %d vertices, %d triangles for chunk (%d, %d)"), 
-			Chunk.Vertices.Num(), Chunk.Triangles.Num() / 3, Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y);
-	}
+	VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: Generated %d vertices, %d triangles for chunk (%d, %d)"), 
+		Chunk.Vertices.Num(), Chunk.Triangles.Num() / 3, Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y);
 	
 	// Update the mesh component
 	if (Chunk.Vertices.Num() > 0 && Chunk.Triangles.Num() > 0)
@@ -824,32 +877,25 @@ void UStaticWaterRenderer::BuildChunkMesh(FStaticWaterRenderChunk& Chunk)
 		UpdateChunkMesh(Chunk);
 		Chunk.bHasWater = true;
 		
-		if (bEnableLogging)
-		{
-			UE_LOG(LogTemp, Log, TEXT("StaticWaterRenderer: Successfully created mesh for chunk (%d, %d)"), 
-				Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y);
-		}
+		VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: Successfully created mesh for chunk (%d, %d)"), 
+			Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y);
 	}
 	else
 	{
 		Chunk.MeshComponent->ClearAllMeshSections();
 		Chunk.bHasWater = false;
 		
-		if (bEnableLogging)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: No mesh data generated for chunk (%d, %d)"), 
-				Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y);
-		}
+		VOXELFLUID_TRACE(RenderMeshEmpty, Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y, Chunk.LODLevel);
+		VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: No mesh data generated for chunk (%d, %d)"), 
+			Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y);
 	}
 	
 	LastRenderTime = FPlatformTime::Seconds() - StartTime;
 	
-	if (bEnableLogging)
-	{
-		UE_LOG(LogTemp, Log, TEXT("StaticWaterRenderer: Built mesh for chunk (%d, %d) in %.3fms - %d vertices, %d triangles"), 
-			Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y, LastRenderTime * 1000.0f, 
-			Chunk.Vertices.Num(), Chunk.Triangles.Num() / 3);
-	}
+	VOXELFLUID_TRACE(RenderMeshBuilt, Chunk.Vertices.Num(), Chunk.Triangles.Num() / 3, Chunk.LODLevel, LastRenderTime * 1000.0f);
+	VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, Log, TEXT("StaticWaterRenderer: Built mesh for chunk (%d, %d) in %.3fms - %d vertices, %d triangles"), 
+		Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y, LastRenderTime * 1000.0f, 
+		Chunk.Vertices.Num(), Chunk.Triangles.Num() / 3);
 }
 
 void UStaticWaterRenderer::GenerateWaterSurface(FStaticWaterRenderChunk& Chunk)
@@ -860,11 +906,8 @@ void UStaticWaterRenderer::GenerateWaterSurface(FStaticWaterRenderChunk& Chunk)
 	
 	const float WaterLevel = WaterGenerator->GetWaterLevelAtLocation(Chunk.WorldBounds.GetCenter());
 	
-	if (bEnableLogging)
-	{
-		UE_LOG(LogTemp, Log, TEXT("StaticWaterRenderer: Water level at chunk center %s: %.1f"), 
-			*Chunk.WorldBounds.GetCenter().ToString(), WaterLevel);
-	}
+	VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: Water level at chunk center %s: %.1f"), 
+		*Chunk.WorldBounds.GetCenter().ToString(), WaterLevel);
 	
 	if (WaterLevel > -MAX_flt)
 	{
@@ -889,7 +932,7 @@ void UStaticWaterRenderer::GenerateWaterSurface(FStaticWaterRenderChunk& Chunk)
 		
 		if (bShouldUseAdaptiveMesh && bHasValidVoxelIntegration)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: 🌊 ADAPTIVE mesh for LOD%d chunk (%d, %d) at distance %.0f [LOD0=%s, OwnerWants=%s, VoxelValid=%s]"), 
+			VOXELFLUID_LOG(LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: ADAPTIVE mesh for LOD%d chunk (%d, %d) at distance %.0f [LOD0=%s, OwnerWants=%s, VoxelValid=%s]"), 
 				Chunk.LODLevel, Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y, DistanceToPlayer,
 				(Chunk.LODLevel == 0) ? TEXT("Y") : TEXT("N"),
 				bOwnerWantsAdaptive ? TEXT("Y") : TEXT("N"),
@@ -898,23 +941,25 @@ void UStaticWaterRenderer::GenerateWaterSurface(FStaticWaterRenderChunk& Chunk)
 		}
 		else
 		{
-			FString Reason;
-			if (!bHasValidVoxelIntegration) Reason += TEXT("NoVoxel ");
-			if (!bOwnerWantsAdaptive) Reason += TEXT("OwnerDisabled ");
-			if (Chunk.LODLevel != 0) Reason += FString::Printf(TEXT("LOD%d "), Chunk.LODLevel);
-			
-			UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: 📦 PLANAR mesh for LOD%d chunk (%d, %d) at distance %.0f [Reason: %s]"), 
-				Chunk.LODLevel, Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y, DistanceToPlayer, *Reason.TrimEnd());
+#if VOXELFLUID_DIAGNOSTICS
+			if (UE_LOG_ACTIVE(LogVoxelFluidRender, Verbose))
+			{
+				FString Reason;
+				if (!bHasValidVoxelIntegration) Reason += TEXT("NoVoxel ");
+				if (!bOwnerWantsAdaptive) Reason += TEXT("OwnerDisabled ");
+				if (Chunk.LODLevel != 0) Reason += FString::Printf(TEXT("LOD%d "), Chunk.LODLevel);
+				
+				VOXELFLUID_LOG(LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: PLANAR mesh for LOD%d chunk (%d, %d) at distance %.0f [Reason: %s]"), 
+					Chunk.LODLevel, Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y, DistanceToPlayer, *Reason.TrimEnd());
+			}
+#endif
 			GeneratePlanarWaterMesh(Chunk, WaterLevel);
 		}
 	}
 	else
 	{
-		if (bEnableLogging)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: No water found at chunk center %s"), 
-				*Chunk.WorldBounds.GetCenter().ToString());
-		}
+		VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: No water found at chunk center %s"), 
+			*Chunk.WorldBounds.GetCenter().ToString());
 	}
 }
 
@@ -926,11 +971,8 @@ void UStaticWaterRenderer::GeneratePlanarWaterMesh(FStaticWaterRenderChunk& Chun
 	const int32 VertsPerSide = FMath::Max(2, FMath::CeilToInt(RenderSettings.RenderChunkSize / Resolution));
 	const float StepSize = RenderSettings.RenderChunkSize / (VertsPerSide - 1);
 	
-	if (bEnableLogging)
-	{
-		UE_LOG(LogTemp, Log, TEXT("StaticWaterRenderer: Generating planar mesh - WaterLevel: %.1f, VertsPerSide: %d, StepSize: %.1f"), 
-			WaterLevel, VertsPerSide, StepSize);
-	}
+	VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, VeryVerbose, TEXT("StaticWaterRenderer: Generating planar mesh - WaterLevel: %.1f, VertsPerSide: %d, StepSize: %.1f"), 
+		WaterLevel, VertsPerSide, StepSize);
 	
 	// Generate vertices
 	Chunk.Vertices.Reserve(VertsPerSide * VertsPerSide);
@@ -989,11 +1031,8 @@ void UStaticWaterRenderer::GenerateAdaptiveWaterMesh(FStaticWaterRenderChunk& Ch
 	const int32 VertsPerSide = FMath::Max(16, FMath::CeilToInt(RenderSettings.RenderChunkSize / Resolution));
 	const float StepSize = RenderSettings.RenderChunkSize / (VertsPerSide - 1);
 	
-	if (bEnableLogging)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: Generating ADAPTIVE mesh - WaterLevel: %.1f, VertsPerSide: %d, StepSize: %.1f"), 
-			WaterLevel, VertsPerSide, StepSize);
-	}
+	VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidRender, VeryVerbose, TEXT("StaticWaterRenderer: Generating ADAPTIVE mesh - WaterLevel: %.1f, VertsPerSide: %d, StepSize: %.1f"), 
+		WaterLevel, VertsPerSide, StepSize);
 	
 	// Create arrays for mesh data
 	TArray<FVector> TempVertices;
@@ -1023,11 +1062,12 @@ void UStaticWaterRenderer::GenerateAdaptiveWaterMesh(FStaticWaterRenderChunk& Ch
 		if (VoxelIntegration->IsVoxelWorldValid())
 		{
 			BatchHeights = VoxelIntegration->SampleVoxelHeightsBatch(SamplePositions);
-			UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: Batch sampled %d/%d terrain heights for chunk (%d, %d), WaterLevel: %.1f"), 
+			VOXELFLUID_LOG(LogVoxelFluidRender, VeryVerbose, TEXT("StaticWaterRenderer: Batch sampled %d/%d terrain heights for chunk (%d, %d), WaterLevel: %.1f"), 
 				BatchHeights.Num(), SamplePositions.Num(), Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y, WaterLevel);
 				
+#if VOXELFLUID_DIAGNOSTICS
 			// Log some sample heights for debugging
-			if (BatchHeights.Num() > 0)
+			if (BatchHeights.Num() > 0 && UE_LOG_ACTIVE(LogVoxelFluidRender, VeryVerbose))
 			{
 				float MinHeight = BatchHeights[0];
 				float MaxHeight = BatchHeights[0];
@@ -1036,19 +1076,20 @@ void UStaticWaterRenderer::GenerateAdaptiveWaterMesh(FStaticWaterRenderChunk& Ch
 					MinHeight = FMath::Min(MinHeight, Height);
 					MaxHeight = FMath::Max(MaxHeight, Height);
 				}
-				UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: Terrain height range for chunk (%d, %d): %.1f to %.1f"), 
+				VOXELFLUID_LOG(LogVoxelFluidRender, VeryVerbose, TEXT("StaticWaterRenderer: Terrain height range for chunk (%d, %d): %.1f to %.1f"), 
 					Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y, MinHeight, MaxHeight);
 			}
+#endif
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: VoxelIntegration has no valid voxel world for chunk (%d, %d)"), 
+			VOXELFLUID_LOG(LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: VoxelIntegration has no valid voxel world for chunk (%d, %d)"), 
 				Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y);
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: No valid VoxelIntegration for terrain sampling for chunk (%d, %d)"), 
+		VOXELFLUID_LOG(LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: No valid VoxelIntegration for terrain sampling for chunk (%d, %d)"), 
 			Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y);
 	}
 	
@@ -1154,8 +1195,7 @@ void UStaticWaterRenderer::GenerateAdaptiveWaterMesh(FStaticWaterRenderChunk& Ch
 	Chunk.UVs = TempUVs;
 	Chunk.bHasWater = TempTriangles.Num() > 0; // Only has water if we have triangles
 	
-	// Always log adaptive mesh generation for debugging
-	UE_LOG(LogTemp, Warning, TEXT("StaticWaterRenderer: Generated ADAPTIVE mesh for chunk (%d, %d) with %d vertices, %d triangles, HasWater: %s"), 
+	VOXELFLUID_LOG(LogVoxelFluidRender, Verbose, TEXT("StaticWaterRenderer: Generated ADAPTIVE mesh for chunk (%d, %d) with %d vertices, %d triangles, HasWater: %s"), 
 		Chunk.ChunkCoord.X, Chunk.ChunkCoord.Y, TempVertices.Num(), TempTriangles.Num() / 3, 
 		(TempTriangles.Num() > 0) ? TEXT("YES") : TEXT("NO"));
 }
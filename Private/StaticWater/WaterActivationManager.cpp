@@ -3,8 +3,13 @@
 #include "StaticWater/StaticWaterRenderer.h"
 #include "CellularAutomata/FluidChunkManager.h"
 #include "CellularAutomata/CAFluidGrid.h"
+#include "CellularAutomata/FluidSimulationThread.h"
+#include "VoxelFluidDebug.h"
+#include "VoxelFluidProfiler.h"
+#include "VoxelFluidMemory.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
+#include "Async/ParallelFor.h"
 
 UWaterActivationManager::UWaterActivationManager()
 {
@@ -16,6 +21,8 @@ UWaterActivationManager::UWaterActivationManager()
 void UWaterActivationManager::BeginPlay()
 {
 	Super::BeginPlay();
+
+	FFluidMemoryTracker::Register(this);
 	
 	// Find components on the same actor if not set
 	if (AActor* Owner = GetOwner())
@@ -44,21 +51,46 @@ void UWaterActivationManager::BeginPlay()
 		UE_LOG(LogTemp, Warning, TEXT("WaterActivationManager: No FluidChunkManager set - will be configured by VoxelFluidActor"));
 	}
 
+	IdleTickInterval = GetComponentTickInterval();
 	bIsInitialized = true;
 }
 
 void UWaterActivationManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	FFluidMemoryTracker::Unregister(this);
+
 	// Clean up all active regions
 	{
 		FScopeLock Lock(&RegionsMutex);
 		ActiveRegions.Empty();
+		RegionGrid.Empty();
 		ActivationQueue.Empty();
+		PendingColumnFills.Empty();
+		PendingColumnFillCoords.Empty();
 	}
 	
 	Super::EndPlay(EndPlayReason);
 }
 
+void UWaterActivationManager::ReportMemory(FFluidMemoryReport& Report) const
+{
+	FScopeLock Lock(&RegionsMutex);
+
+	SIZE_T Bytes = ActiveRegions.GetAllocatedSize() + RegionGrid.GetAllocatedSize() + ActivationQueue.GetAllocatedSize()
+		+ PendingColumnFills.GetAllocatedSize() + PendingColumnFillCoords.GetAllocatedSize();
+
+	for (const FWaterActivationRegion& Region : ActiveRegions)
+	{
+		Bytes += Region.StaticWaterPositions.GetAllocatedSize() + Region.StaticWaterAmounts.GetAllocatedSize() + Region.OverlappingChunks.GetAllocatedSize();
+	}
+	for (const auto& Pair : RegionGrid)
+	{
+		Bytes += Pair.Value.GetAllocatedSize();
+	}
+
+	Report.Add(EFluidMemoryCategory::Activation, Bytes);
+}
+
 void UWaterActivationManager::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -66,7 +98,25 @@ void UWaterActivationManager::TickComponent(float DeltaTime, ELevelTick TickType
 	if (!bIsInitialized)
 		return;
 
-	UpdateActiveRegions(DeltaTime);
+	// Regions write chunk cells; if the simulation thread is mid-step, carry the time over to the next tick
+	FCriticalSection* SimulationLock = FluidChunkManager ? &FluidChunkManager->GetSimulationLock() : nullptr;
+	if (SimulationLock && !SimulationLock->TryLock())
+	{
+		DeferredTickTime += DeltaTime;
+		return;
+	}
+
+	{
+		FFluidFrameProfiler::FScopedPhase ProfilerScope(FFluidFrameProfiler::Get(FluidChunkManager), EFluidFramePhase::StaticWater);
+		UpdateActiveRegions(DeltaTime + DeferredTickTime);
+		ProcessPendingColumnFills();
+	}
+	DeferredTickTime = 0.0f;
+
+	if (SimulationLock)
+	{
+		SimulationLock->Unlock();
+	}
 
 #if WITH_EDITOR
 	if (bShowActiveRegions || bShowActivationRadius)
@@ -189,6 +239,8 @@ bool UWaterActivationManager::ActivateWaterInRegion(const FVector& Center, float
 			const FVector RegionSize = FVector(Radius * 2.0f, Radius * 2.0f, 2000.0f);
 			ExistingRegion->Bounds = FBox::BuildAABB(Center, RegionSize * 0.5f);
 			ExistingRegion->ActivationRadius = Radius;
+			ExistingRegion->OverlappingChunks = FluidChunkManager->GetChunksInBounds(ExistingRegion->Bounds);
+			RebuildRegionIndex();
 		}
 		return true;
 	}
@@ -200,11 +252,9 @@ bool UWaterActivationManager::ActivateWaterInRegion(const FVector& Center, float
 		
 		OnWaterRegionActivated.Broadcast(Center, Radius);
 		
-		if (bEnableLogging)
-		{
-			UE_LOG(LogTemp, Log, TEXT("WaterActivationManager: Activated water region at %s (radius: %.1f)"), 
-				*Center.ToString(), Radius);
-		}
+		VOXELFLUID_TRACE(RegionActivated, FMath::RoundToInt(Center.X), FMath::RoundToInt(Center.Y), 0, Radius);
+		VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidActivation, Log, TEXT("WaterActivationManager: Activated water region at %s (radius: %.1f)"), 
+			*Center.ToString(), Radius);
 		
 		return true;
 	}
@@ -224,13 +274,12 @@ bool UWaterActivationManager::DeactivateWaterInRegion(const FVector& Center, flo
 			DeactivateSimulation(Region);
 			OnWaterRegionDeactivated.Broadcast(Region.Bounds.GetCenter(), Region.ActivationRadius);
 			
-			if (bEnableLogging)
-			{
-				UE_LOG(LogTemp, Log, TEXT("WaterActivationManager: Deactivated water region at %s"), 
-					*Region.Bounds.GetCenter().ToString());
-			}
+			VOXELFLUID_TRACE(RegionDeactivated, FMath::RoundToInt(Region.Bounds.GetCenter().X), FMath::RoundToInt(Region.Bounds.GetCenter().Y), 0, Region.Metrics.TotalVolume);
+			VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidActivation, Log, TEXT("WaterActivationManager: Deactivated water region at %s"), 
+				*Region.Bounds.GetCenter().ToString());
 			
 			ActiveRegions.RemoveAt(i);
+			RebuildRegionIndex();
 			return true;
 		}
 	}
@@ -249,7 +298,10 @@ void UWaterActivationManager::ForceDeactivateAllRegions()
 	}
 	
 	ActiveRegions.Empty();
+	RegionGrid.Empty();
 	ActivationQueue.Empty();
+	PendingColumnFills.Empty();
+	PendingColumnFillCoords.Empty();
 	
 	UE_LOG(LogTemp, Log, TEXT("WaterActivationManager: Force deactivated all regions"));
 }
@@ -291,6 +343,25 @@ float UWaterActivationManager::GetRegionActivationTime(const FVector& Position)
 	return -1.0f;
 }
 
+int32 UWaterActivationManager::GetPendingTransferChunkCount() const
+{
+	FScopeLock Lock(&RegionsMutex);
+	return PendingColumnFills.Num();
+}
+
+bool UWaterActivationManager::GetRegionMetrics(const FVector& Position, FWaterRegionMetrics& OutMetrics) const
+{
+	FScopeLock Lock(&RegionsMutex);
+	
+	if (const FWaterActivationRegion* Region = FindRegionAtPosition(Position))
+	{
+		OutMetrics = Region->Metrics;
+		return true;
+	}
+	
+	return false;
+}
+
 void UWaterActivationManager::UpdateActiveRegions(float DeltaTime)
 {
 	RegionUpdateTimer += DeltaTime;
@@ -302,6 +373,12 @@ void UWaterActivationManager::UpdateActiveRegions(float DeltaTime)
 	{
 		RegionUpdateTimer = 0.0f;
 		ProcessActivationQueue();
+		
+		FScopeLock Lock(&RegionsMutex);
+		for (FWaterActivationRegion& Region : ActiveRegions)
+		{
+			UpdateRegionMetrics(Region);
+		}
 	}
 	
 	// Check for deactivation
@@ -339,6 +416,7 @@ void UWaterActivationManager::CheckForDeactivation(float DeltaTime)
 			continue;
 		
 		// Check if fluid has settled
+		UpdateRegionMetrics(Region);
 		if (IsFluidSettled(Region))
 		{
 			RegionsToDeactivate.Add(i);
@@ -354,15 +432,18 @@ void UWaterActivationManager::CheckForDeactivation(float DeltaTime)
 		DeactivateSimulation(Region);
 		OnWaterRegionDeactivated.Broadcast(Region.Bounds.GetCenter(), Region.ActivationRadius);
 		
-		if (bEnableLogging)
-		{
-			UE_LOG(LogTemp, Log, TEXT("WaterActivationManager: Auto-deactivated settled region at %s"), 
-				*Region.Bounds.GetCenter().ToString());
-		}
+		VOXELFLUID_TRACE(RegionDeactivated, FMath::RoundToInt(Region.Bounds.GetCenter().X), FMath::RoundToInt(Region.Bounds.GetCenter().Y), 0, Region.Metrics.TotalVolume);
+		VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidActivation, Log, TEXT("WaterActivationManager: Auto-deactivated settled region at %s"), 
+			*Region.Bounds.GetCenter().ToString());
 		
 		ActiveRegions.RemoveAt(RegionIndex);
 		++DeactivationsThisFrame;
 	}
+	
+	if (RegionsToDeactivate.Num() > 0)
+	{
+		RebuildRegionIndex();
+	}
 }
 
 void UWaterActivationManager::ProcessActivationQueue()
@@ -383,33 +464,43 @@ void UWaterActivationManager::ProcessActivationQueue()
 		FPendingActivation Activation = ActivationQueue[0];
 		ActivationQueue.RemoveAt(0);
 		
-		// Check if we're at the active region limit
-		if (ActiveRegions.Num() >= ActivationSettings.MaxActiveRegions)
+		// Check if we're at the active region limit (an activation inside an existing region never needs a slot)
+		if (ActiveRegions.Num() >= ActivationSettings.MaxActiveRegions && !FindRegionAtPosition(Activation.Center))
 		{
-			// Try to remove the oldest, least important region
-			int32 OldestRegionIndex = -1;
-			float OldestTime = MAX_flt;
-			
-			for (int32 i = 0; i < ActiveRegions.Num(); ++i)
+			// Evict the region that puts the least water at risk
+			int32 EvictIndex = FindCheapestRegionToEvict();
+			if (EvictIndex == INDEX_NONE)
 			{
-				if (ActiveRegions[i].ActivationTime < OldestTime)
+				if (Activation.EvictionRetries < ActivationSettings.MaxEvictionRetries)
 				{
-					OldestTime = ActiveRegions[i].ActivationTime;
-					OldestRegionIndex = i;
+					// Every region is still filling; retry on the next update
+					++Activation.EvictionRetries;
+					ActivationQueue.Insert(Activation, 0);
+					break;
+				}
+				
+				// Waited long enough; the oldest region goes so the queue keeps moving
+				EvictIndex = 0;
+				for (int32 i = 1; i < ActiveRegions.Num(); ++i)
+				{
+					if (ActiveRegions[i].ActivationTime < ActiveRegions[EvictIndex].ActivationTime)
+					{
+						EvictIndex = i;
+					}
 				}
 			}
 			
-			if (OldestRegionIndex >= 0)
-			{
-				FWaterActivationRegion& OldRegion = ActiveRegions[OldestRegionIndex];
-				DeactivateSimulation(OldRegion);
-				OnWaterRegionDeactivated.Broadcast(OldRegion.Bounds.GetCenter(), OldRegion.ActivationRadius);
-				ActiveRegions.RemoveAt(OldestRegionIndex);
-			}
-			else
-			{
-				break; // Can't make room
-			}
+			FWaterActivationRegion& OldRegion = ActiveRegions[EvictIndex];
+			
+			VOXELFLUID_TRACE(RegionEvicted, FMath::RoundToInt(OldRegion.Bounds.GetCenter().X), FMath::RoundToInt(OldRegion.Bounds.GetCenter().Y), 0, GetEvictionCost(OldRegion));
+			VOXELFLUID_CLOG(bEnableLogging, LogVoxelFluidActivation, Log, TEXT("WaterActivationManager: Evicting region at %s (cost %.2f, volume %.2f, unsettled %.1f%%)"), 
+				*OldRegion.Bounds.GetCenter().ToString(), GetEvictionCost(OldRegion), 
+				OldRegion.Metrics.TotalVolume, OldRegion.Metrics.UnsettledFraction * 100.0f);
+			
+			DeactivateSimulation(OldRegion);
+			OnWaterRegionDeactivated.Broadcast(OldRegion.Bounds.GetCenter(), OldRegion.ActivationRadius);
+			ActiveRegions.RemoveAt(EvictIndex);
+			RebuildRegionIndex();
 		}
 		
 		// Activate the region
@@ -422,23 +513,20 @@ void UWaterActivationManager::ProcessActivationQueue()
 
 FWaterActivationRegion* UWaterActivationManager::FindRegionAtPosition(const FVector& Position)
 {
-	for (FWaterActivationRegion& Region : ActiveRegions)
-	{
-		if (Region.ContainsPoint(Position))
-		{
-			return &Region;
-		}
-	}
-	return nullptr;
+	const UWaterActivationManager* ConstThis = this;
+	return const_cast<FWaterActivationRegion*>(ConstThis->FindRegionAtPosition(Position));
 }
 
 const FWaterActivationRegion* UWaterActivationManager::FindRegionAtPosition(const FVector& Position) const
 {
-	for (const FWaterActivationRegion& Region : ActiveRegions)
+	if (const TArray<int32>* RegionIndices = RegionGrid.Find(GetRegionGridCell(Position)))
 	{
-		if (Region.ContainsPoint(Position))
+		for (const int32 RegionIndex : *RegionIndices)
 		{
-			return &Region;
+			if (ActiveRegions.IsValidIndex(RegionIndex) && ActiveRegions[RegionIndex].ContainsPoint(Position))
+			{
+				return &ActiveRegions[RegionIndex];
+			}
 		}
 	}
 	return nullptr;
@@ -457,6 +545,7 @@ FWaterActivationRegion* UWaterActivationManager::CreateActivationRegion(const FV
 	NewRegion.Priority = 0;
 	
 	int32 Index = ActiveRegions.Add(NewRegion);
+	RebuildRegionIndex();
 	return &ActiveRegions[Index];
 }
 
@@ -465,14 +554,110 @@ void UWaterActivationManager::RemoveActivationRegion(int32 RegionIndex)
 	if (ActiveRegions.IsValidIndex(RegionIndex))
 	{
 		ActiveRegions.RemoveAt(RegionIndex);
+		RebuildRegionIndex();
+	}
+}
+
+FIntPoint UWaterActivationManager::GetRegionGridCell(const FVector& Position) const
+{
+	return FIntPoint(
+		FMath::FloorToInt(Position.X / RegionGridCellSize),
+		FMath::FloorToInt(Position.Y / RegionGridCellSize)
+	);
+}
+
+void UWaterActivationManager::RebuildRegionIndex()
+{
+	RegionGrid.Reset();
+	RegionGridCellSize = FMath::Max(ActivationSettings.DefaultActivationRadius * 2.0f, 100.0f);
+	
+	for (int32 RegionIndex = 0; RegionIndex < ActiveRegions.Num(); ++RegionIndex)
+	{
+		const FBox& Bounds = ActiveRegions[RegionIndex].Bounds;
+		const FIntPoint MinCell = GetRegionGridCell(Bounds.Min);
+		const FIntPoint MaxCell = GetRegionGridCell(Bounds.Max);
+		
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				RegionGrid.FindOrAdd(FIntPoint(X, Y)).Add(RegionIndex);
+			}
+		}
 	}
 }
 
+void UWaterActivationManager::GetRegionCandidates(const FBox& Bounds, TArray<int32>& OutRegionIndices) const
+{
+	OutRegionIndices.Reset();
+	
+	const FIntPoint MinCell = GetRegionGridCell(Bounds.Min);
+	const FIntPoint MaxCell = GetRegionGridCell(Bounds.Max);
+	
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			if (const TArray<int32>* RegionIndices = RegionGrid.Find(FIntPoint(X, Y)))
+			{
+				for (const int32 RegionIndex : *RegionIndices)
+				{
+					OutRegionIndices.AddUnique(RegionIndex);
+				}
+			}
+		}
+	}
+}
+
+float UWaterActivationManager::GetEvictionCost(const FWaterActivationRegion& Region) const
+{
+	// Regions still filling from static water would lose what has been transferred so far
+	const FWaterRegionMetrics& Metrics = Region.Metrics;
+	if (!Metrics.bComplete)
+		return MAX_flt;
+		
+	// Volume at risk, weighted up by how far the water is from settled
+	const float SettleThreshold = FMath::Max(ActivationSettings.FluidSettleThreshold, KINDA_SMALL_NUMBER);
+	const float UnsettledTolerance = FMath::Max(ActivationSettings.MaxUnsettledFraction, KINDA_SMALL_NUMBER);
+	const float Activity = Metrics.AverageCellChange / SettleThreshold + Metrics.UnsettledFraction / UnsettledTolerance;
+	
+	return Metrics.TotalVolume * (1.0f + ActivationSettings.EvictionActivityWeight * Activity) + Region.Priority;
+}
+
+int32 UWaterActivationManager::FindCheapestRegionToEvict()
+{
+	int32 CheapestIndex = INDEX_NONE;
+	float CheapestCost = MAX_flt;
+	
+	for (int32 i = 0; i < ActiveRegions.Num(); ++i)
+	{
+		UpdateRegionMetrics(ActiveRegions[i]);
+		
+		const float Cost = GetEvictionCost(ActiveRegions[i]);
+		if (Cost < CheapestCost)
+		{
+			CheapestCost = Cost;
+			CheapestIndex = i;
+		}
+	}
+	
+	return CheapestIndex;
+}
+
 bool UWaterActivationManager::ShouldMergeRegions(const FWaterActivationRegion& RegionA, const FWaterActivationRegion& RegionB) const
 {
-	// Check if regions overlap or are very close
-	const float MergeThreshold = ActivationSettings.DefaultActivationRadius * 0.5f;
-	return FVector::Dist(RegionA.Bounds.GetCenter(), RegionB.Bounds.GetCenter()) <= MergeThreshold;
+	// Overlapping regions simulate the same water
+	if (RegionA.Bounds.Intersect(RegionB.Bounds))
+		return true;
+		
+	// Regions simulating the same chunk are coupled through it even if their boxes don't touch
+	for (const FFluidChunkCoord& ChunkCoord : RegionA.OverlappingChunks)
+	{
+		if (RegionB.OverlappingChunks.Contains(ChunkCoord))
+			return true;
+	}
+	
+	return false;
 }
 
 void UWaterActivationManager::MergeRegions(FWaterActivationRegion& TargetRegion, const FWaterActivationRegion& SourceRegion)
@@ -489,6 +674,13 @@ void UWaterActivationManager::MergeRegions(FWaterActivationRegion& TargetRegion,
 	// Merge static water data
 	TargetRegion.StaticWaterPositions.Append(SourceRegion.StaticWaterPositions);
 	TargetRegion.StaticWaterAmounts.Append(SourceRegion.StaticWaterAmounts);
+	
+	// Bounds grew, so the overlapping chunk set has to be rebuilt
+	if (FluidChunkManager)
+	{
+		TargetRegion.OverlappingChunks = FluidChunkManager->GetChunksInBounds(TargetRegion.Bounds);
+	}
+	UpdateRegionMetrics(TargetRegion);
 }
 
 void UWaterActivationManager::ActivateSimulation(FWaterActivationRegion& Region)
@@ -496,6 +688,12 @@ void UWaterActivationManager::ActivateSimulation(FWaterActivationRegion& Region)
 	if (Region.bIsActive)
 		return;
 		
+	// Cache the chunks that feed this region's metrics
+	if (FluidChunkManager)
+	{
+		Region.OverlappingChunks = FluidChunkManager->GetChunksInBounds(Region.Bounds);
+	}
+	
 	// Transfer static water to simulation
 	TransferStaticToSimulation(Region);
 	
@@ -526,6 +724,9 @@ void UWaterActivationManager::DeactivateSimulation(FWaterActivationRegion& Regio
 		StaticWaterRenderer->RebuildChunksInRadius(Region.Bounds.GetCenter(), Region.ActivationRadius);
 	}
 	
+	// Drop any columns that were still waiting to be filled
+	CancelPendingColumnFills(Region);
+	
 	Region.bIsActive = false;
 	Region.Clear();
 }
@@ -534,43 +735,293 @@ void UWaterActivationManager::TransferStaticToSimulation(const FWaterActivationR
 {
 	if (!StaticWaterGenerator || !FluidChunkManager)
 		return;
+	
+	// Queue every chunk the region touches; columns are filled in bulk over the next frames
+	TArray<FFluidChunkCoord> ChunkCoords = FluidChunkManager->GetChunksInBounds(Region.Bounds);
+	const FVector RegionCenter = Region.Bounds.GetCenter();
+	const float HalfChunkWorldSize = FluidChunkManager->ChunkSize * FluidChunkManager->CellSize * 0.5f;
+	
+	// Dependency order: lower layers first so fluid always has a live chunk to drain into,
+	// then nearest to the activation point so the visible part fills first
+	ChunkCoords.Sort([this, &RegionCenter, HalfChunkWorldSize](const FFluidChunkCoord& A, const FFluidChunkCoord& B)
+	{
+		if (A.Z != B.Z)
+			return A.Z < B.Z;
+		const FVector CenterA = FluidChunkManager->GetChunkWorldPosition(A) + FVector(HalfChunkWorldSize);
+		const FVector CenterB = FluidChunkManager->GetChunkWorldPosition(B) + FVector(HalfChunkWorldSize);
+		return FVector::DistSquared2D(CenterA, RegionCenter) < FVector::DistSquared2D(CenterB, RegionCenter);
+	});
+	
+	int32 QueuedChunks = 0;
+	for (const FFluidChunkCoord& ChunkCoord : ChunkCoords)
+	{
+		bool bAlreadyQueued = false;
+		PendingColumnFillCoords.Add(ChunkCoord, &bAlreadyQueued);
+		if (bAlreadyQueued)
+			continue;
+		
+		FPendingColumnFill Fill;
+		Fill.ChunkCoord = ChunkCoord;
+		Fill.RegionCenter = RegionCenter;
+		PendingColumnFills.Add(Fill);
+		++QueuedChunks;
+	}
+	
+	// Tick every frame until the backlog drains so the budget is actually spread across frames
+	if (PendingColumnFills.Num() > 0)
+	{
+		SetComponentTickInterval(0.0f);
+	}
+	
+	if (bEnableLogging)
+	{
+		UE_LOG(LogTemp, Log, TEXT("WaterActivationManager: Queued %d chunks for static-to-simulation transfer (%d pending)"), 
+			QueuedChunks, PendingColumnFills.Num());
+	}
+}
+
+void UWaterActivationManager::ProcessPendingColumnFills()
+{
+	FScopeLock Lock(&RegionsMutex);
+	
+	if (PendingColumnFills.Num() == 0)
+		return;
+	
+	if (!StaticWaterGenerator || !FluidChunkManager)
+	{
+		PendingColumnFills.Empty();
+		PendingColumnFillCoords.Empty();
+		SetComponentTickInterval(IdleTickInterval);
+		return;
+	}
+	
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = ActivationSettings.TransferBudgetMs * 0.001;
+	const int32 BatchSize = FMath::Max(1, ActivationSettings.MaxChunksPerTransferBatch);
+	const float HalfChunkWorldSize = FluidChunkManager->ChunkSize * FluidChunkManager->CellSize * 0.5f;
+	
+	int32 ProcessedCount = 0;
+	int32 FilledChunks = 0;
+	float FilledVolume = 0.0f;
+	
+	// Always make progress on at least one batch, then stop once the frame budget is spent
+	while (ProcessedCount < PendingColumnFills.Num())
+	{
+		const int32 BatchCount = FMath::Min(BatchSize, PendingColumnFills.Num() - ProcessedCount);
+		
+		// Resolve column spans from the static representation in parallel
+		TArray<TArray<FFluidColumnSpan>> BatchSpans;
+		TArray<bool> BatchHasWater;
+		BatchSpans.SetNum(BatchCount);
+		BatchHasWater.SetNumZeroed(BatchCount);
+		
+		ParallelFor(BatchCount, [&](int32 Index)
+		{
+			BatchHasWater[Index] = BuildColumnSpans(PendingColumnFills[ProcessedCount + Index].ChunkCoord, BatchSpans[Index]);
+		});
+		
+		// Only chunks that actually hold static water get loaded and activated
+		TArray<FFluidChunkCoord> WetCoords;
+		TArray<TArray<FFluidColumnSpan>> WetSpans;
+		TArray<int32> WetFillIndices;
+		for (int32 Index = 0; Index < BatchCount; ++Index)
+		{
+			if (BatchHasWater[Index])
+			{
+				WetCoords.Add(PendingColumnFills[ProcessedCount + Index].ChunkCoord);
+				WetSpans.Add(MoveTemp(BatchSpans[Index]));
+				WetFillIndices.Add(ProcessedCount + Index);
+			}
+		}
 		
-	// Sample static water in the region and add to simulation
-	const FBox& Bounds = Region.Bounds;
-	const float SampleSpacing = 100.0f; // 1m spacing
+		if (WetCoords.Num() > 0)
+		{
+			// Pre-activate in dependency order, then write all columns in parallel
+			FluidChunkManager->PrepareChunksForBulkFill(WetCoords);
+			
+			TArray<float> ChunkVolumes;
+			FilledVolume += FluidChunkManager->FillChunkColumnsBulk(WetCoords, WetSpans, &ChunkVolumes);
+			FilledChunks += WetCoords.Num();
+			
+			// Remember what was transferred so the region can account for it later
+			for (int32 Index = 0; Index < WetCoords.Num(); ++Index)
+			{
+				const FPendingColumnFill& Fill = PendingColumnFills[WetFillIndices[Index]];
+				if (FWaterActivationRegion* Region = FindRegionAtPosition(Fill.RegionCenter))
+				{
+					Region->StaticWaterPositions.Add(FluidChunkManager->GetChunkWorldPosition(Fill.ChunkCoord) + FVector(HalfChunkWorldSize));
+					Region->StaticWaterAmounts.Add(ChunkVolumes.IsValidIndex(Index) ? ChunkVolumes[Index] : 0.0f);
+				}
+			}
+		}
+		
+		ProcessedCount += BatchCount;
+		
+		if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+			break;
+	}
+	
+	for (int32 Index = 0; Index < ProcessedCount; ++Index)
+	{
+		PendingColumnFillCoords.Remove(PendingColumnFills[Index].ChunkCoord);
+	}
+	PendingColumnFills.RemoveAt(0, ProcessedCount);
+	
+	if (PendingColumnFills.Num() == 0)
+	{
+		SetComponentTickInterval(IdleTickInterval);
+	}
 	
-	const int32 SamplesX = FMath::CeilToInt(Bounds.GetSize().X / SampleSpacing);
-	const int32 SamplesY = FMath::CeilToInt(Bounds.GetSize().Y / SampleSpacing);
+	if (bEnableLogging && FilledChunks > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("WaterActivationManager: Filled %d chunks (%.1f volume) in %.2fms, %d chunks pending"), 
+			FilledChunks, FilledVolume, (FPlatformTime::Seconds() - StartTime) * 1000.0, PendingColumnFills.Num());
+	}
+}
+
+bool UWaterActivationManager::BuildColumnSpans(const FFluidChunkCoord& ChunkCoord, TArray<FFluidColumnSpan>& OutSpans) const
+{
+	const int32 ChunkSize = FluidChunkManager->ChunkSize;
+	const float CellSize = FluidChunkManager->CellSize;
+	const FVector ChunkOrigin = FluidChunkManager->GetChunkWorldPosition(ChunkCoord);
+	const float ChunkBottom = ChunkOrigin.Z;
+	const float ChunkTop = ChunkOrigin.Z + ChunkSize * CellSize;
 	
-	for (int32 X = 0; X < SamplesX; ++X)
+	OutSpans.SetNum(ChunkSize * ChunkSize);
+	bool bAnyWater = false;
+	
+	for (int32 Y = 0; Y < ChunkSize; ++Y)
 	{
-		for (int32 Y = 0; Y < SamplesY; ++Y)
+		for (int32 X = 0; X < ChunkSize; ++X)
 		{
-			const FVector SamplePos = FVector(
-				Bounds.Min.X + X * SampleSpacing,
-				Bounds.Min.Y + Y * SampleSpacing,
-				0.0f
-			);
+			// Sample at the column centre
+			const FVector ColumnPos = ChunkOrigin + FVector((X + 0.5f) * CellSize, (Y + 0.5f) * CellSize, 0.0f);
 			
-			const float WaterDepth = StaticWaterGenerator->GetWaterDepthAtLocation(SamplePos);
-			if (WaterDepth > 0.0f)
+			FFluidColumnSpan& Span = OutSpans[X + Y * ChunkSize];
+			if (StaticWaterGenerator->GetWaterColumnAtLocation(ColumnPos, Span.SurfaceZ, Span.FloorZ))
 			{
-				// Add fluid to simulation at this position
-				FluidChunkManager->AddFluidAtWorldPosition(SamplePos, WaterDepth);
+				// A span only counts for this chunk if it overlaps the chunk vertically
+				bAnyWater |= Span.SurfaceZ > ChunkBottom && Span.FloorZ < ChunkTop;
 			}
 		}
 	}
+	
+	return bAnyWater;
+}
+
+void UWaterActivationManager::CancelPendingColumnFills(const FWaterActivationRegion& Region)
+{
+	for (int32 i = PendingColumnFills.Num() - 1; i >= 0; --i)
+	{
+		if (Region.ContainsPoint(PendingColumnFills[i].RegionCenter))
+		{
+			PendingColumnFillCoords.Remove(PendingColumnFills[i].ChunkCoord);
+			PendingColumnFills.RemoveAt(i);
+		}
+	}
 }
 
 void UWaterActivationManager::TransferSimulationToStatic(FWaterActivationRegion& Region)
 {
-	// TODO: Sample fluid from simulation and update static water generator
-	// This would involve reading fluid levels from active chunks and updating static regions
+	if (!FluidChunkManager)
+		return;
+		
+	UpdateRegionMetrics(Region);
+	
+	// Settled water matches the static representation again; moving water is handed to the chunk
+	// manager's settle tracking so it keeps simulating (and persists on deactivation) instead of vanishing
+	if (!IsFluidSettled(Region))
+	{
+		FFluidSimulationThread::FScopedAccess SimulationAccess(FluidChunkManager);
+		FluidChunkManager->RetainChunksUntilSettled(Region.OverlappingChunks);
+	}
 	
 	if (bEnableLogging)
 	{
-		UE_LOG(LogTemp, Log, TEXT("WaterActivationManager: Transferring simulation back to static (not fully implemented)"));
+		float TransferredVolume = 0.0f;
+		for (const float Amount : Region.StaticWaterAmounts)
+		{
+			TransferredVolume += Amount;
+		}
+		
+		UE_LOG(LogTemp, Log, TEXT("WaterActivationManager: Released region at %s - simulated volume %.2f (transferred %.2f), %s"), 
+			*Region.Bounds.GetCenter().ToString(), Region.Metrics.TotalVolume, TransferredVolume,
+			IsFluidSettled(Region) ? TEXT("settled") : TEXT("still flowing, handed to chunk manager"));
+	}
+}
+
+void UWaterActivationManager::UpdateRegionMetrics(FWaterActivationRegion& Region) const
+{
+	FWaterRegionMetrics Metrics;
+	Metrics.bComplete = FluidChunkManager != nullptr;
+	
+	if (FluidChunkManager)
+	{
+		// Chunks keep their own step summaries; the region only sums them. Steps write them, so hold the simulation off
+		FFluidSimulationThread::FScopedAccess SimulationAccess(FluidChunkManager);
+		int32 UnsettledCellCount = 0;
+		float AbsoluteFlux = 0.0f;
+		float WeightedFlowSpeed = 0.0f;
+		
+		for (const FFluidChunkCoord& ChunkCoord : Region.OverlappingChunks)
+		{
+			UFluidChunk* Chunk = FluidChunkManager->GetChunk(ChunkCoord);
+			if (!Chunk || Chunk->State == EChunkState::Unloaded)
+				continue;
+				
+			// A chunk that is not simulating will not step, so it is as still as it is now
+			if (!Chunk->Activity.bValid && Chunk->State != EChunkState::Active)
+			{
+				Chunk->SetIdleActivity();
+			}
+			
+			const FFluidChunkActivity& Activity = Chunk->Activity;
+			if (!Activity.bValid)
+			{
+				Metrics.bComplete = false;
+				continue;
+			}
+			
+			Metrics.TotalVolume += Activity.TotalVolume;
+			Metrics.NetMassFlux += Activity.NetFlux;
+			Metrics.FluidCellCount += Activity.FluidCellCount;
+			UnsettledCellCount += Activity.UnsettledCellCount;
+			AbsoluteFlux += Activity.AbsoluteFlux;
+			WeightedFlowSpeed += Activity.MeanFlowSpeed * Activity.TotalVolume;
+			++Metrics.ChunkCount;
+		}
+		
+		if (Metrics.FluidCellCount > 0)
+		{
+			Metrics.AverageCellChange = AbsoluteFlux / Metrics.FluidCellCount;
+			Metrics.UnsettledFraction = FMath::Min(1.0f, (float)UnsettledCellCount / Metrics.FluidCellCount);
+		}
+		
+		if (Metrics.TotalVolume > KINDA_SMALL_NUMBER)
+		{
+			Metrics.AverageFlowSpeed = WeightedFlowSpeed / Metrics.TotalVolume;
+		}
+	}
+	
+	// Columns still queued for transfer mean the measured volume is not final yet
+	if (HasPendingColumnFills(Region))
+	{
+		Metrics.bComplete = false;
 	}
+	
+	Region.Metrics = Metrics;
+}
+
+bool UWaterActivationManager::HasPendingColumnFills(const FWaterActivationRegion& Region) const
+{
+	for (const FPendingColumnFill& Fill : PendingColumnFills)
+	{
+		if (Region.ContainsPoint(Fill.RegionCenter))
+		{
+			return true;
+		}
+	}
+	return false;
 }
 
 bool UWaterActivationManager::IsFluidSettled(const FWaterActivationRegion& Region) const
@@ -578,8 +1029,15 @@ bool UWaterActivationManager::IsFluidSettled(const FWaterActivationRegion& Regio
 	if (!FluidChunkManager)
 		return true; // Assume settled if no chunk manager
 		
-	const float AverageVelocity = GetAverageFluidVelocity(Region);
-	return AverageVelocity < ActivationSettings.FluidSettleThreshold;
+	// Never settle on partial data
+	const FWaterRegionMetrics& Metrics = Region.Metrics;
+	if (!Metrics.bComplete)
+		return false;
+		
+	const float MaxNetFlux = ActivationSettings.MaxNetFluxRatio * FMath::Max(Metrics.TotalVolume, 1.0f);
+	return Metrics.AverageCellChange < ActivationSettings.FluidSettleThreshold &&
+		Metrics.UnsettledFraction <= ActivationSettings.MaxUnsettledFraction &&
+		FMath::Abs(Metrics.NetMassFlux) <= MaxNetFlux;
 }
 
 float UWaterActivationManager::GetAverageFluidVelocity(const FWaterActivationRegion& Region) const
@@ -587,9 +1045,7 @@ float UWaterActivationManager::GetAverageFluidVelocity(const FWaterActivationReg
 	if (!FluidChunkManager)
 		return 0.0f;
 		
-	// TODO: Sample fluid velocity from chunks in the region
-	// For now, return a dummy value
-	return 0.001f;
+	return Region.Metrics.AverageFlowSpeed;
 }
 
 bool UWaterActivationManager::HasFluidInRegion(const FWaterActivationRegion& Region) const
@@ -597,31 +1053,82 @@ bool UWaterActivationManager::HasFluidInRegion(const FWaterActivationRegion& Reg
 	if (!FluidChunkManager)
 		return false;
 		
-	// TODO: Check if there's any fluid in chunks that intersect this region
-	// For now, assume there is fluid
-	return true;
+	// Incomplete metrics can't prove the region is empty
+	if (!Region.Metrics.bComplete)
+		return true;
+		
+	return Region.Metrics.TotalVolume > ActivationSettings.MinRegionVolume;
 }
 
 void UWaterActivationManager::OptimizeRegions()
 {
 	FScopeLock Lock(&RegionsMutex);
 	
+	for (FWaterActivationRegion& Region : ActiveRegions)
+	{
+		UpdateRegionMetrics(Region);
+	}
+	
 	// Remove empty regions
 	RemoveEmptyRegions();
 	
-	// Merge overlapping regions
-	for (int32 i = 0; i < ActiveRegions.Num(); ++i)
+	// Group overlapping regions with union-find so chains of overlaps collapse in one pass
+	const int32 NumRegions = ActiveRegions.Num();
+	TArray<int32> Parent;
+	Parent.SetNumUninitialized(NumRegions);
+	for (int32 i = 0; i < NumRegions; ++i)
 	{
-		for (int32 j = i + 1; j < ActiveRegions.Num(); ++j)
+		Parent[i] = i;
+	}
+	
+	auto FindRoot = [&Parent](int32 Index)
+	{
+		while (Parent[Index] != Index)
+		{
+			Parent[Index] = Parent[Parent[Index]];
+			Index = Parent[Index];
+		}
+		return Index;
+	};
+	
+	// Chunk sharing can couple regions further apart than one index cell, so widen the query by a chunk
+	const float ChunkWorldSize = FluidChunkManager ? FluidChunkManager->ChunkSize * FluidChunkManager->CellSize : 0.0f;
+	
+	TArray<int32> Candidates;
+	for (int32 i = 0; i < NumRegions; ++i)
+	{
+		GetRegionCandidates(ActiveRegions[i].Bounds.ExpandBy(ChunkWorldSize), Candidates);
+		for (const int32 j : Candidates)
 		{
-			if (ShouldMergeRegions(ActiveRegions[i], ActiveRegions[j]))
+			if (j <= i || !ShouldMergeRegions(ActiveRegions[i], ActiveRegions[j]))
+				continue;
+				
+			// Lowest index becomes the root so higher indices can be removed without invalidating it
+			const int32 RootI = FindRoot(i);
+			const int32 RootJ = FindRoot(j);
+			if (RootI != RootJ)
 			{
-				MergeRegions(ActiveRegions[i], ActiveRegions[j]);
-				ActiveRegions.RemoveAt(j);
-				--j; // Adjust index after removal
+				Parent[FMath::Max(RootI, RootJ)] = FMath::Min(RootI, RootJ);
 			}
 		}
 	}
+	
+	bool bMerged = false;
+	for (int32 i = NumRegions - 1; i > 0; --i)
+	{
+		const int32 Root = FindRoot(i);
+		if (Root != i)
+		{
+			MergeRegions(ActiveRegions[Root], ActiveRegions[i]);
+			ActiveRegions.RemoveAt(i);
+			bMerged = true;
+		}
+	}
+	
+	if (bMerged)
+	{
+		RebuildRegionIndex();
+	}
 }
 
 void UWaterActivationManager::RemoveEmptyRegions()
@@ -636,6 +1143,8 @@ void UWaterActivationManager::RemoveEmptyRegions()
 			ActiveRegions.RemoveAt(i);
 		}
 	}
+	
+	RebuildRegionIndex();
 }
 
 void UWaterActivationManager::DrawDebugInfo() const
@@ -660,7 +1169,8 @@ void UWaterActivationManager::DrawDebugInfo() const
 			
 			// Draw activation time text
 			const float ActivationTime = GetWorld()->GetTimeSeconds() - Region.ActivationTime;
-			const FString TimeText = FString::Printf(TEXT("Active: %.1fs"), ActivationTime);
+			const FString TimeText = FString::Printf(TEXT("Active: %.1fs\nVolume: %.1f  Flux: %.3f  Unsettled: %.1f%%"), 
+				ActivationTime, Region.Metrics.TotalVolume, Region.Metrics.NetMassFlux, Region.Metrics.UnsettledFraction * 100.0f);
 			DrawDebugString(World, Region.Bounds.GetCenter() + FVector(0, 0, 200), 
 				TimeText, nullptr, RegionColor, 0.0f);
 		}
@@ -0,0 +1,485 @@
+#include "StaticWater/WaterBasinAnalyzer.h"
+#include "VoxelFluidStats.h"
+
+struct FBasinFloodNode
+{
+	float Elevation;
+	int32 Index;
+};
+
+struct FBasinFloodNodeLess
+{
+	// Ties broken by index so re-flooding a tile reproduces the same labels
+	bool operator()(const FBasinFloodNode& A, const FBasinFloodNode& B) const
+	{
+		return A.Elevation < B.Elevation || (A.Elevation == B.Elevation && A.Index < B.Index);
+	}
+};
+
+SIZE_T FWaterBasinAnalyzer::GetAllocatedSize() const
+{
+	SIZE_T Bytes = TileLabelBases.GetAllocatedSize() + TileEdges.GetAllocatedSize() + SpillEdges.GetAllocatedSize()
+		+ LabelSpillHeights.GetAllocatedSize() + TileHeights.GetAllocatedSize() + TileFilled.GetAllocatedSize()
+		+ TileLabels.GetAllocatedSize() + Basins.GetAllocatedSize();
+
+	for (const FTileEdges& Edges : TileEdges)
+	{
+		Bytes += Edges.SouthLabels.GetAllocatedSize() + Edges.NorthLabels.GetAllocatedSize() + Edges.WestLabels.GetAllocatedSize()
+			+ Edges.EastLabels.GetAllocatedSize() + Edges.SouthHeights.GetAllocatedSize() + Edges.NorthHeights.GetAllocatedSize()
+			+ Edges.WestHeights.GetAllocatedSize() + Edges.EastHeights.GetAllocatedSize();
+	}
+	for (const FWaterBasin& Basin : Basins)
+	{
+		if (Basin.Mask.IsValid())
+		{
+			Bytes += sizeof(FWaterBasinMask) + Basin.Mask->Cells.GetAllocatedSize();
+		}
+	}
+	return Bytes;
+}
+
+FWaterBasinAnalyzer::FWaterBasinAnalyzer(const FWaterBasinAnalysisSettings& InSettings, FHeightSampler InSampler)
+	: Settings(InSettings)
+	, Sampler(MoveTemp(InSampler))
+{
+	Settings.TileCells = FMath::Max(Settings.TileCells, 4);
+	Settings.CellSize = FMath::Max(Settings.CellSize, 1.0f);
+
+	NumTilesX = FMath::DivideAndRoundUp(FMath::Max(Settings.CellsX, 0), Settings.TileCells);
+	NumTilesY = FMath::DivideAndRoundUp(FMath::Max(Settings.CellsY, 0), Settings.TileCells);
+
+	const int32 NumTiles = NumTilesX * NumTilesY;
+	TileLabelBases.SetNumZeroed(NumTiles);
+	TileEdges.SetNum(NumTiles);
+
+	if (NumTiles == 0 || !Sampler)
+	{
+		Phase = EPhase::Complete;
+	}
+}
+
+bool FWaterBasinAnalyzer::Step()
+{
+	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_TerrainSampling);
+
+	const int32 NumTiles = NumTilesX * NumTilesY;
+
+	switch (Phase)
+	{
+	case EPhase::FloodTiles:
+	{
+		FIntPoint TileOrigin;
+		int32 SizeX, SizeY;
+		GetTileRect(CurrentTile, TileOrigin, SizeX, SizeY);
+
+		TileHeights.Reset();
+		Sampler(TileOrigin, SizeX, SizeY, TileHeights);
+		TileHeights.SetNumZeroed(SizeX * SizeY);
+
+		const int32 LabelBase = NextLabel;
+		NextLabel += FloodTile(TileHeights, SizeX, SizeY, LabelBase, TileFilled, TileLabels, true);
+		TileLabelBases[CurrentTile] = LabelBase;
+
+		// Keep only the perimeter for stitching; perimeter cells are flood seeds, so filled == terrain height
+		FTileEdges& Edges = TileEdges[CurrentTile];
+		for (int32 X = 0; X < SizeX; ++X)
+		{
+			const int32 South = X;
+			const int32 North = X + (SizeY - 1) * SizeX;
+			Edges.SouthLabels.Add(TileLabels[South]);
+			Edges.SouthHeights.Add(TileHeights[South]);
+			Edges.NorthLabels.Add(TileLabels[North]);
+			Edges.NorthHeights.Add(TileHeights[North]);
+		}
+		for (int32 Y = 0; Y < SizeY; ++Y)
+		{
+			const int32 West = Y * SizeX;
+			const int32 East = (SizeX - 1) + Y * SizeX;
+			Edges.WestLabels.Add(TileLabels[West]);
+			Edges.WestHeights.Add(TileHeights[West]);
+			Edges.EastLabels.Add(TileLabels[East]);
+			Edges.EastHeights.Add(TileHeights[East]);
+		}
+
+		if (++CurrentTile >= NumTiles)
+		{
+			Phase = EPhase::SolveSpillGraph;
+		}
+		break;
+	}
+
+	case EPhase::SolveSpillGraph:
+		StitchTileEdges();
+		SolveSpillGraph();
+		CurrentTile = 0;
+		Phase = EPhase::EmitBasins;
+		break;
+
+	case EPhase::EmitBasins:
+		EmitTileBasins(CurrentTile);
+		if (++CurrentTile >= NumTiles)
+		{
+			TileHeights.Empty();
+			TileFilled.Empty();
+			TileLabels.Empty();
+			LabelSpillHeights.Empty();
+			Phase = EPhase::Complete;
+		}
+		break;
+
+	case EPhase::Complete:
+		break;
+	}
+
+	return IsComplete();
+}
+
+void FWaterBasinAnalyzer::Run()
+{
+	while (!Step())
+	{
+	}
+}
+
+float FWaterBasinAnalyzer::GetProgress() const
+{
+	const int32 NumTiles = NumTilesX * NumTilesY;
+	switch (Phase)
+	{
+	case EPhase::FloodTiles:
+		return NumTiles > 0 ? 0.5f * CurrentTile / NumTiles : 0.0f;
+	case EPhase::SolveSpillGraph:
+		return 0.5f;
+	case EPhase::EmitBasins:
+		return 0.5f + 0.5f * CurrentTile / NumTiles;
+	default:
+		return 1.0f;
+	}
+}
+
+void FWaterBasinAnalyzer::GetTileRect(int32 TileIndex, FIntPoint& OutOrigin, int32& OutSizeX, int32& OutSizeY) const
+{
+	const int32 TileX = TileIndex % NumTilesX;
+	const int32 TileY = TileIndex / NumTilesX;
+
+	OutOrigin = FIntPoint(TileX * Settings.TileCells, TileY * Settings.TileCells);
+	OutSizeX = FMath::Min(Settings.TileCells, Settings.CellsX - OutOrigin.X);
+	OutSizeY = FMath::Min(Settings.TileCells, Settings.CellsY - OutOrigin.Y);
+}
+
+int32 FWaterBasinAnalyzer::FloodTile(const TArray<float>& Heights, int32 SizeX, int32 SizeY, int32 LabelBase,
+	TArray<float>& OutFilled, TArray<int32>& OutLabels, bool bRecordEdges)
+{
+	const int32 NumCells = SizeX * SizeY;
+	OutFilled.SetNumUninitialized(NumCells);
+	OutLabels.Init(INDEX_NONE, NumCells);
+
+	TBitArray<> Queued(false, NumCells);
+	TArray<FBasinFloodNode> Open;
+	Open.Reserve(2 * (SizeX + SizeY));
+	const FBasinFloodNodeLess Less;
+
+	// Seed the whole perimeter: locally, water can always leave the tile through its edge
+	auto PushSeed = [&](int32 X, int32 Y)
+	{
+		const int32 Index = X + Y * SizeX;
+		if (!Queued[Index])
+		{
+			Queued[Index] = true;
+			OutFilled[Index] = Heights[Index];
+			Open.HeapPush(FBasinFloodNode{ Heights[Index], Index }, Less);
+		}
+	};
+
+	for (int32 X = 0; X < SizeX; ++X)
+	{
+		PushSeed(X, 0);
+		PushSeed(X, SizeY - 1);
+	}
+	for (int32 Y = 0; Y < SizeY; ++Y)
+	{
+		PushSeed(0, Y);
+		PushSeed(SizeX - 1, Y);
+	}
+
+	static const FIntPoint NeighborOffsets[4] = { FIntPoint(1, 0), FIntPoint(-1, 0), FIntPoint(0, 1), FIntPoint(0, -1) };
+
+	int32 NumLabels = 0;
+	while (Open.Num() > 0)
+	{
+		FBasinFloodNode Node;
+		Open.HeapPop(Node, Less);
+
+		// A seed nobody flooded into starts its own watershed
+		if (OutLabels[Node.Index] == INDEX_NONE)
+		{
+			OutLabels[Node.Index] = LabelBase + NumLabels++;
+		}
+
+		const int32 Label = OutLabels[Node.Index];
+		const float Level = OutFilled[Node.Index];
+		const int32 X = Node.Index % SizeX;
+		const int32 Y = Node.Index / SizeX;
+
+		for (const FIntPoint& Offset : NeighborOffsets)
+		{
+			const int32 NX = X + Offset.X;
+			const int32 NY = Y + Offset.Y;
+			if (NX < 0 || NY < 0 || NX >= SizeX || NY >= SizeY)
+				continue;
+
+			const int32 NeighborIndex = NX + NY * SizeX;
+			if (Queued[NeighborIndex])
+			{
+				// Two watersheds meet: water crosses between them at the higher of the two levels
+				const int32 NeighborLabel = OutLabels[NeighborIndex];
+				if (bRecordEdges && NeighborLabel != INDEX_NONE && NeighborLabel != Label)
+				{
+					AddSpillEdge(Label, NeighborLabel, FMath::Max(Level, OutFilled[NeighborIndex]));
+				}
+				continue;
+			}
+
+			// Depressions are raised to the level of the cell that floods into them
+			Queued[NeighborIndex] = true;
+			OutFilled[NeighborIndex] = FMath::Max(Heights[NeighborIndex], Level);
+			OutLabels[NeighborIndex] = Label;
+			Open.HeapPush(FBasinFloodNode{ OutFilled[NeighborIndex], NeighborIndex }, Less);
+		}
+	}
+
+	return NumLabels;
+}
+
+void FWaterBasinAnalyzer::AddSpillEdge(int32 LabelA, int32 LabelB, float Elevation)
+{
+	const uint64 Key = ((uint64)(uint32)FMath::Min(LabelA, LabelB) << 32) | (uint64)(uint32)FMath::Max(LabelA, LabelB);
+	if (float* Existing = SpillEdges.Find(Key))
+	{
+		*Existing = FMath::Min(*Existing, Elevation);
+	}
+	else
+	{
+		SpillEdges.Add(Key, Elevation);
+	}
+}
+
+void FWaterBasinAnalyzer::StitchTileEdges()
+{
+	for (int32 TileY = 0; TileY < NumTilesY; ++TileY)
+	{
+		for (int32 TileX = 0; TileX < NumTilesX; ++TileX)
+		{
+			const FTileEdges& Edges = TileEdges[TileX + TileY * NumTilesX];
+
+			// Edges of the analysed area drain to the outside (label 0)
+			if (TileX == 0)
+			{
+				for (int32 i = 0; i < Edges.WestLabels.Num(); ++i)
+				{
+					AddSpillEdge(Edges.WestLabels[i], 0, Edges.WestHeights[i]);
+				}
+			}
+			if (TileX == NumTilesX - 1)
+			{
+				for (int32 i = 0; i < Edges.EastLabels.Num(); ++i)
+				{
+					AddSpillEdge(Edges.EastLabels[i], 0, Edges.EastHeights[i]);
+				}
+			}
+			if (TileY == 0)
+			{
+				for (int32 i = 0; i < Edges.SouthLabels.Num(); ++i)
+				{
+					AddSpillEdge(Edges.SouthLabels[i], 0, Edges.SouthHeights[i]);
+				}
+			}
+			if (TileY == NumTilesY - 1)
+			{
+				for (int32 i = 0; i < Edges.NorthLabels.Num(); ++i)
+				{
+					AddSpillEdge(Edges.NorthLabels[i], 0, Edges.NorthHeights[i]);
+				}
+			}
+
+			// Adjacent perimeter cells of neighbouring tiles exchange water at the higher of their heights
+			if (TileX + 1 < NumTilesX)
+			{
+				const FTileEdges& East = TileEdges[(TileX + 1) + TileY * NumTilesX];
+				for (int32 i = 0; i < Edges.EastLabels.Num(); ++i)
+				{
+					AddSpillEdge(Edges.EastLabels[i], East.WestLabels[i], FMath::Max(Edges.EastHeights[i], East.WestHeights[i]));
+				}
+			}
+			if (TileY + 1 < NumTilesY)
+			{
+				const FTileEdges& North = TileEdges[TileX + (TileY + 1) * NumTilesX];
+				for (int32 i = 0; i < Edges.NorthLabels.Num(); ++i)
+				{
+					AddSpillEdge(Edges.NorthLabels[i], North.SouthLabels[i], FMath::Max(Edges.NorthHeights[i], North.SouthHeights[i]));
+				}
+			}
+		}
+	}
+
+	TileEdges.Empty();
+}
+
+void FWaterBasinAnalyzer::SolveSpillGraph()
+{
+	TArray<TArray<TPair<int32, float>>> Adjacency;
+	Adjacency.SetNum(NextLabel);
+	for (const TPair<uint64, float>& Edge : SpillEdges)
+	{
+		const int32 LabelA = (int32)(Edge.Key >> 32);
+		const int32 LabelB = (int32)(Edge.Key & 0xFFFFFFFF);
+		Adjacency[LabelA].Emplace(LabelB, Edge.Value);
+		Adjacency[LabelB].Emplace(LabelA, Edge.Value);
+	}
+	SpillEdges.Empty();
+
+	// Priority-flood over the label graph from the outside: a label's spill height is the lowest
+	// possible maximum elevation along any path out of the area
+	LabelSpillHeights.Init(MAX_flt, NextLabel);
+	LabelSpillHeights[0] = -MAX_flt;
+
+	TArray<FBasinFloodNode> Open;
+	const FBasinFloodNodeLess Less;
+	Open.HeapPush(FBasinFloodNode{ -MAX_flt, 0 }, Less);
+
+	while (Open.Num() > 0)
+	{
+		FBasinFloodNode Node;
+		Open.HeapPop(Node, Less);
+		if (Node.Elevation > LabelSpillHeights[Node.Index])
+			continue;
+
+		for (const TPair<int32, float>& Edge : Adjacency[Node.Index])
+		{
+			const float Candidate = FMath::Max(Node.Elevation, Edge.Value);
+			if (Candidate < LabelSpillHeights[Edge.Key])
+			{
+				LabelSpillHeights[Edge.Key] = Candidate;
+				Open.HeapPush(FBasinFloodNode{ Candidate, Edge.Key }, Less);
+			}
+		}
+	}
+}
+
+void FWaterBasinAnalyzer::EmitTileBasins(int32 TileIndex)
+{
+	FIntPoint TileOrigin;
+	int32 SizeX, SizeY;
+	GetTileRect(TileIndex, TileOrigin, SizeX, SizeY);
+
+	// Re-sample and re-flood; identical input reproduces the labels from the first pass
+	TileHeights.Reset();
+	Sampler(TileOrigin, SizeX, SizeY, TileHeights);
+	TileHeights.SetNumZeroed(SizeX * SizeY);
+	FloodTile(TileHeights, SizeX, SizeY, TileLabelBases[TileIndex], TileFilled, TileLabels, false);
+
+	const int32 NumCells = SizeX * SizeY;
+	for (int32 i = 0; i < NumCells; ++i)
+	{
+		const float LabelHeight = LabelSpillHeights.IsValidIndex(TileLabels[i]) ? LabelSpillHeights[TileLabels[i]] : -MAX_flt;
+		if (LabelHeight < MAX_flt)
+		{
+			TileFilled[i] = FMath::Max(TileFilled[i], LabelHeight);
+		}
+	}
+
+	// Group flooded cells into connected surfaces of one level
+	const float FloodEpsilon = 1.0f;
+	const float CellArea = Settings.CellSize * Settings.CellSize;
+	static const FIntPoint NeighborOffsets[4] = { FIntPoint(1, 0), FIntPoint(-1, 0), FIntPoint(0, 1), FIntPoint(0, -1) };
+
+	TBitArray<> Visited(false, NumCells);
+	TArray<int32> Component;
+	TArray<int32> Stack;
+
+	for (int32 Seed = 0; Seed < NumCells; ++Seed)
+	{
+		if (Visited[Seed] || TileFilled[Seed] - TileHeights[Seed] <= FloodEpsilon)
+			continue;
+
+		const float Level = TileFilled[Seed];
+		Component.Reset();
+		Stack.Reset();
+		Stack.Add(Seed);
+		Visited[Seed] = true;
+
+		FIntPoint MinCell(SizeX, SizeY);
+		FIntPoint MaxCell(-1, -1);
+		float FloorHeight = MAX_flt;
+		float MaxDepth = 0.0f;
+		float Volume = 0.0f;
+		bool bTouchesInnerTileEdge = false;
+
+		while (Stack.Num() > 0)
+		{
+			const int32 Index = Stack.Pop();
+			Component.Add(Index);
+
+			const int32 X = Index % SizeX;
+			const int32 Y = Index / SizeX;
+			const float Depth = Level - TileHeights[Index];
+
+			MinCell = FIntPoint(FMath::Min(MinCell.X, X), FMath::Min(MinCell.Y, Y));
+			MaxCell = FIntPoint(FMath::Max(MaxCell.X, X), FMath::Max(MaxCell.Y, Y));
+			FloorHeight = FMath::Min(FloorHeight, TileHeights[Index]);
+			MaxDepth = FMath::Max(MaxDepth, Depth);
+			Volume += Depth * CellArea;
+
+			// Lakes cut by a tile seam continue in the next tile, so size filters can't judge them here
+			bTouchesInnerTileEdge |= (X == 0 && TileOrigin.X > 0) || (Y == 0 && TileOrigin.Y > 0) ||
+				(X == SizeX - 1 && TileOrigin.X + SizeX < Settings.CellsX) ||
+				(Y == SizeY - 1 && TileOrigin.Y + SizeY < Settings.CellsY);
+
+			for (const FIntPoint& Offset : NeighborOffsets)
+			{
+				const int32 NX = X + Offset.X;
+				const int32 NY = Y + Offset.Y;
+				if (NX < 0 || NY < 0 || NX >= SizeX || NY >= SizeY)
+					continue;
+
+				const int32 NeighborIndex = NX + NY * SizeX;
+				if (Visited[NeighborIndex] || TileFilled[NeighborIndex] - TileHeights[NeighborIndex] <= FloodEpsilon ||
+					FMath::Abs(TileFilled[NeighborIndex] - Level) > FloodEpsilon)
+				{
+					continue;
+				}
+
+				Visited[NeighborIndex] = true;
+				Stack.Add(NeighborIndex);
+			}
+		}
+
+		if (!bTouchesInnerTileEdge && (Component.Num() < Settings.MinLakeCells || MaxDepth < Settings.MinLakeDepth))
+			continue;
+
+		TSharedPtr<FWaterBasinMask> Mask = MakeShared<FWaterBasinMask>();
+		Mask->CellSize = Settings.CellSize;
+		Mask->SizeX = MaxCell.X - MinCell.X + 1;
+		Mask->SizeY = MaxCell.Y - MinCell.Y + 1;
+		Mask->Origin = Settings.Origin + FVector2D(TileOrigin + MinCell) * Settings.CellSize;
+		Mask->Cells.Init(false, Mask->SizeX * Mask->SizeY);
+
+		for (const int32 Index : Component)
+		{
+			const int32 LocalX = Index % SizeX - MinCell.X;
+			const int32 LocalY = Index / SizeX - MinCell.Y;
+			Mask->Cells[LocalX + LocalY * Mask->SizeX] = true;
+		}
+
+		FWaterBasin& Basin = Basins.AddDefaulted_GetRef();
+		Basin.SpillHeight = Level;
+		Basin.FloorHeight = FloorHeight;
+		Basin.CellCount = Component.Num();
+		Basin.Volume = Volume;
+		Basin.Bounds = FBox(
+			FVector(Mask->Origin, FloorHeight),
+			FVector(Mask->Origin + FVector2D(Mask->SizeX, Mask->SizeY) * Settings.CellSize, Level)
+		);
+		Basin.Mask = Mask;
+	}
+}
@@ -10,10 +10,17 @@
 #include "Engine/World.h"
 #include "Engine/StaticMesh.h"
 #include "Materials/Material.h"
+#include "Materials/MaterialInstanceDynamic.h"
 #include "VoxelFluidStats.h"
+#include "VoxelFluidProfiler.h"
+#include "VoxelFluidMemory.h"
 #include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "ConvexVolume.h"
 #include "Async/Async.h"
 #include "Async/TaskGraphInterfaces.h"
+#include "Misc/ScopeExit.h"
 
 UFluidVisualizationComponent::UFluidVisualizationComponent()
 {
@@ -23,6 +30,8 @@ UFluidVisualizationComponent::UFluidVisualizationComponent()
 void UFluidVisualizationComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	FFluidMemoryTracker::Register(this);
 	
 	if (RenderMode == EFluidRenderMode::Instances && !InstancedMeshComponent)
 	{
@@ -113,8 +122,61 @@ void UFluidVisualizationComponent::SetFluidGrid(UCAFluidGrid* InFluidGrid)
 	UpdateVisualization();
 }
 
+void UFluidVisualizationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FFluidMemoryTracker::Unregister(this);
+	Super::EndPlay(EndPlayReason);
+}
+
+static SIZE_T GetProcMeshAllocatedSize(UProceduralMeshComponent* Mesh)
+{
+	SIZE_T Bytes = 0;
+	if (Mesh)
+	{
+		for (int32 SectionIndex = 0; SectionIndex < Mesh->GetNumSections(); ++SectionIndex)
+		{
+			if (const FProcMeshSection* Section = Mesh->GetProcMeshSection(SectionIndex))
+			{
+				Bytes += Section->ProcVertexBuffer.GetAllocatedSize() + Section->ProcIndexBuffer.GetAllocatedSize();
+			}
+		}
+	}
+	return Bytes;
+}
+
+void UFluidVisualizationComponent::ReportMemory(FFluidMemoryReport& Report) const
+{
+	SIZE_T Bytes = PreviousDensityGrid.GetAllocatedSize() + CurrentDensityGrid.GetAllocatedSize() + InterpolatedDensityGrid.GetAllocatedSize();
+	Bytes += ChunkMeshComponents.GetAllocatedSize() + ChunkMarchingCubesMeshes.GetAllocatedSize()
+		+ ChunksNeedingMeshUpdate.GetAllocatedSize() + ChunkLastMeshUpdateTime.GetAllocatedSize() + ChunkMeshSteps.GetAllocatedSize();
+
+	// CPU copies held by the procedural mesh components; GPU buffers are owned by the renderer
+	Bytes += GetProcMeshAllocatedSize(MarchingCubesMesh);
+	for (const auto& Pair : ChunkMarchingCubesMeshes)
+	{
+		Bytes += GetProcMeshAllocatedSize(Pair.Value);
+	}
+
+	{
+		FScopeLock Lock(&AsyncTaskMutex);
+		Bytes += AsyncMeshTasks.GetAllocatedSize();
+		for (const TSharedPtr<FAsyncMeshGenerationTask>& Task : AsyncMeshTasks)
+		{
+			if (Task)
+			{
+				Bytes += sizeof(FAsyncMeshGenerationTask) + Task->Vertices.GetAllocatedSize() + Task->Triangles.GetAllocatedSize()
+					+ Task->Normals.GetAllocatedSize() + Task->UVs.GetAllocatedSize() + Task->VertexColors.GetAllocatedSize();
+			}
+		}
+	}
+
+	Report.Add(EFluidMemoryCategory::MeshBuffers, Bytes);
+}
+
 void UFluidVisualizationComponent::UpdateVisualization()
 {
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(FFluidFrameProfiler::Get(ChunkManager), EFluidFramePhase::Meshing);
+
 	if (bUseChunkedSystem && ChunkManager)
 	{
 		GenerateChunkedVisualization();
@@ -289,6 +351,7 @@ void UFluidVisualizationComponent::OnChunkUnloaded(const FFluidChunkCoord& Chunk
 		ChunkMarchingCubesMeshes.Remove(Chunk);
 		ChunksNeedingMeshUpdate.Remove(Chunk);
 		ChunkLastMeshUpdateTime.Remove(Chunk);
+		ChunkMeshSteps.Remove(Chunk);
 	}
 }
 
@@ -307,6 +370,22 @@ void UFluidVisualizationComponent::GenerateChunkedVisualization()
 		return;
 	}
 	
+	// Instanced and debug modes read live cells; with a simulation thread they only draw between its steps
+	FCriticalSection* SimulationLock = nullptr;
+	if (RenderMode != EFluidRenderMode::MarchingCubes && GetSimulationSnapshot().IsValid())
+	{
+		SimulationLock = &ChunkManager->GetSimulationLock();
+		if (!SimulationLock->TryLock())
+			return;
+	}
+	ON_SCOPE_EXIT
+	{
+		if (SimulationLock)
+		{
+			SimulationLock->Unlock();
+		}
+	};
+
 	// Debug: Check if we have active chunks
 	const TArray<UFluidChunk*> ActiveChunks = ChunkManager->GetActiveChunks();
 	UE_LOG(LogTemp, Warning, TEXT("FluidVisualizationComponent: Active chunks count: %d, RenderMode: %d"), ActiveChunks.Num(), (int32)RenderMode);
@@ -339,7 +418,7 @@ void UFluidVisualizationComponent::DrawChunkedDebugFluid()
 		return;
 	
 	const FVector ViewerPos = GetPrimaryViewerPosition();
-	const TArray<UFluidChunk*> ActiveChunks = ChunkManager->GetActiveChunks();
+	const TArray<UFluidChunk*> ActiveChunks = GetChunksInView(ViewerPos);
 	
 	int32 CellsRendered = 0;
 	
@@ -449,7 +528,7 @@ void UFluidVisualizationComponent::UpdateChunkedInstancedMeshes()
 	InstancedMeshComponent->ClearInstances();
 	
 	const FVector ViewerPos = GetPrimaryViewerPosition();
-	const TArray<UFluidChunk*> ActiveChunks = ChunkManager->GetActiveChunks();
+	const TArray<UFluidChunk*> ActiveChunks = GetChunksInView(ViewerPos);
 	
 	TArray<FTransform> Transforms;
 	Transforms.Reserve(MaxCellsToRenderPerFrame);
@@ -610,6 +689,26 @@ FVector UFluidVisualizationComponent::GetPrimaryViewerPosition() const
 	return GetComponentLocation();
 }
 
+bool UFluidVisualizationComponent::GetPrimaryViewFrustum(FConvexVolume& OutFrustum) const
+{
+	UWorld* World = GetWorld();
+	APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+	if (!PC || !PC->PlayerCameraManager)
+		return false;
+	
+	FMatrix ViewMatrix, ProjectionMatrix, ViewProjectionMatrix;
+	UGameplayStatics::GetViewProjectionMatrix(PC->PlayerCameraManager->GetCameraCacheView(), ViewMatrix, ProjectionMatrix, ViewProjectionMatrix);
+	GetViewFrustumBounds(OutFrustum, ViewProjectionMatrix, false);
+	return true;
+}
+
+TArray<UFluidChunk*> UFluidVisualizationComponent::GetChunksInView(const FVector& ViewerPosition) const
+{
+	FConvexVolume ViewFrustum;
+	const bool bHasFrustum = bUseFrustumCulling && GetPrimaryViewFrustum(ViewFrustum);
+	return ChunkManager->GetVisibleChunks(ViewerPosition, MaxRenderDistance, bHasFrustum ? &ViewFrustum : nullptr);
+}
+
 void UFluidVisualizationComponent::DrawChunkBounds() const
 {
 	if (!ChunkManager || !GetWorld())
@@ -837,7 +936,8 @@ void UFluidVisualizationComponent::GenerateChunkedMarchingCubes()
 	SCOPE_CYCLE_COUNTER(STAT_VoxelFluid_MarchingCubes);
 	
 	const FVector ViewerPos = GetPrimaryViewerPosition();
-	const TArray<UFluidChunk*> ActiveChunks = ChunkManager->GetActiveChunks();
+	// Meshes persist across frames and the renderer culls them, so only distance decides which chunks keep one
+	const TArray<UFluidChunk*> ActiveChunks = ChunkManager->GetVisibleChunks(ViewerPos, MaxRenderDistance);
 	const float CurrentTime = FPlatformTime::Seconds();
 	
 	// Reset rendering stats counters
@@ -902,6 +1002,7 @@ void UFluidVisualizationComponent::GenerateChunkedMarchingCubes()
 	for (UFluidChunk* ChunkToRemove : ChunksToRemove)
 	{
 		ChunkMarchingCubesMeshes.Remove(ChunkToRemove);
+		ChunkMeshSteps.Remove(ChunkToRemove);
 	}
 	
 	// Step 2: Process chunks that need mesh updates (limited per frame)
@@ -959,7 +1060,7 @@ void UFluidVisualizationComponent::GenerateChunkedMarchingCubes()
 				
 				if (FluidMaterial)
 				{
-					ChunkMesh->SetMaterial(0, FluidMaterial);
+					ChunkMesh->CreateDynamicMaterialInstance(0, FluidMaterial);
 				}
 				
 				ChunkMarchingCubesMeshes.Add(Chunk, ChunkMesh);
@@ -972,6 +1073,7 @@ void UFluidVisualizationComponent::GenerateChunkedMarchingCubes()
 				ChunkMesh->CreateMeshSection(0, StoredData.Vertices, StoredData.Triangles, 
 				                            StoredData.Normals, StoredData.UVs, StoredData.VertexColors, 
 				                            TArray<FProcMeshTangent>(), bGenerateCollision);
+				ChunkMeshSteps.Remove(Chunk); // Cached meshes carry no step offsets
 				RenderedChunks++;
 				CachedMeshesUsed++;
 			}
@@ -997,8 +1099,10 @@ void UFluidVisualizationComponent::GenerateChunkedMarchingCubes()
 				// Generate new mesh data
 				TArray<FMarchingCubes::FMarchingCubesVertex> MarchingVertices;
 				TArray<FMarchingCubes::FMarchingCubesTriangle> MarchingTriangles;
+				TArray<FVector> StepOffsets;
+				uint64 SnapshotStep = 0;
 				
-				GenerateChunkMeshWithLOD(Chunk, LODLevel, MarchingVertices, MarchingTriangles);
+				GenerateChunkMeshWithLOD(Chunk, LODLevel, MarchingVertices, MarchingTriangles, &StepOffsets, &SnapshotStep);
 				
 				// Convert to UE4 procedural mesh format
 				if (MarchingVertices.Num() > 0)
@@ -1068,7 +1172,7 @@ void UFluidVisualizationComponent::GenerateChunkedMarchingCubes()
 					
 					if (FluidMaterial)
 					{
-						ChunkMesh->SetMaterial(0, FluidMaterial);
+						ChunkMesh->CreateDynamicMaterialInstance(0, FluidMaterial);
 					}
 					
 					ChunkMarchingCubesMeshes.Add(Chunk, ChunkMesh);
@@ -1078,7 +1182,19 @@ void UFluidVisualizationComponent::GenerateChunkedMarchingCubes()
 				{
 					// Update procedural mesh with newly generated data
 					ChunkMesh->ClearAllMeshSections();
-					ChunkMesh->CreateMeshSection(0, Vertices, Triangles, Normals, UVs, VertexColors, TArray<FProcMeshTangent>(), bGenerateCollision);
+					if (StepOffsets.Num() == Vertices.Num())
+					{
+						TArray<FVector2D> StepOffsetsXY, StepOffsetsZ;
+						PackStepOffsets(StepOffsets, StepOffsetsXY, StepOffsetsZ);
+						ChunkMesh->CreateMeshSection(0, Vertices, Triangles, Normals, UVs, StepOffsetsXY, StepOffsetsZ, TArray<FVector2D>(), VertexColors,
+							TArray<FProcMeshTangent>(), bGenerateCollision);
+						ChunkMeshSteps.Add(Chunk, SnapshotStep);
+					}
+					else
+					{
+						ChunkMesh->CreateMeshSection(0, Vertices, Triangles, Normals, UVs, VertexColors, TArray<FProcMeshTangent>(), bGenerateCollision);
+						ChunkMeshSteps.Remove(Chunk);
+					}
 					RenderedChunks++;
 				}
 			}
@@ -1131,6 +1247,9 @@ void UFluidVisualizationComponent::GenerateChunkedMarchingCubes()
 		}
 	}
 	
+	// Step 4: Advance every mesh's blend toward the latest step; this runs each frame without remeshing
+	UpdateMeshStepBlend();
+	
 	// === Update Rendering Statistics ===
 	SET_DWORD_STAT(STAT_VoxelFluid_RenderedChunks, RenderedChunks);
 	// SET_DWORD_STAT(STAT_VoxelFluid_CachedMeshes, CachedMeshesUsed); // Hidden - not in top 20
@@ -1342,10 +1461,97 @@ int32 UFluidVisualizationComponent::CalculateLODLevel(float Distance) const
 	}
 }
 
-void UFluidVisualizationComponent::GenerateChunkMeshWithLOD(UFluidChunk* Chunk, int32 LODLevel, TArray<FMarchingCubes::FMarchingCubesVertex>& OutVertices, TArray<FMarchingCubes::FMarchingCubesTriangle>& OutTriangles)
+bool UFluidVisualizationComponent::GenerateSnapshotChunkMesh(const FFluidSimulationSnapshot& Snapshot, const FFluidChunkCoord& Coord, float IsoLevel,
+	TArray<FMarchingCubes::FMarchingCubesVertex>& OutVertices, TArray<FMarchingCubes::FMarchingCubesTriangle>& OutTriangles, TArray<FVector>* OutStepOffsets)
+{
+	TArray<float> DensityGrid;
+	FIntVector GridSize;
+	FVector GridOrigin;
+	if (!Snapshot.BuildDensityGrid(Coord, DensityGrid, GridSize, GridOrigin))
+		return false;
+
+	FMarchingCubes::GenerateGridMesh(DensityGrid, GridSize, Snapshot.CellSize, GridOrigin, IsoLevel, OutVertices, OutTriangles);
+	if (!OutStepOffsets)
+		return true;
+
+	OutStepOffsets->SetNumZeroed(OutVertices.Num());
+	const FFluidChunkSnapshot* ChunkSnapshot = Snapshot.FindChunk(Coord);
+	TArray<float> PreviousGrid;
+	if (!ChunkSnapshot || ChunkSnapshot->PreviousLevels.Num() == 0 || !Snapshot.BuildDensityGrid(Coord, PreviousGrid, GridSize, GridOrigin, 0.0f))
+		return true;
+
+	// One Newton step from each vertex on the current surface toward the iso level of the previous step,
+	// along the current gradient and capped at a cell so thin sheets that vanished do not stretch
+	const float CellSize = Snapshot.CellSize;
+	const float Half = CellSize * 0.5f;
+	auto Sample = [&](const TArray<float>& Grid, const FVector& At)
+	{
+		return FMarchingCubes::TrilinearInterpolate(Grid, GridSize, At, CellSize, GridOrigin);
+	};
+	for (int32 i = 0; i < OutVertices.Num(); ++i)
+	{
+		const FVector& P = OutVertices[i].Position;
+		const FVector Gradient(
+			Sample(DensityGrid, P + FVector(Half, 0, 0)) - Sample(DensityGrid, P - FVector(Half, 0, 0)),
+			Sample(DensityGrid, P + FVector(0, Half, 0)) - Sample(DensityGrid, P - FVector(0, Half, 0)),
+			Sample(DensityGrid, P + FVector(0, 0, Half)) - Sample(DensityGrid, P - FVector(0, 0, Half)));
+		// Gradient is the level change per cell; flatter than this the surface position is not well defined
+		const double GradientSq = Gradient.SizeSquared();
+		if (GradientSq > KINDA_SMALL_NUMBER)
+		{
+			const FVector Offset = Gradient * ((IsoLevel - Sample(PreviousGrid, P)) * CellSize / GradientSq);
+			(*OutStepOffsets)[i] = Offset.GetClampedToMaxSize(CellSize);
+		}
+	}
+	return true;
+}
+
+void UFluidVisualizationComponent::PackStepOffsets(const TArray<FVector>& StepOffsets, TArray<FVector2D>& OutUV1, TArray<FVector2D>& OutUV2)
+{
+	OutUV1.SetNumUninitialized(StepOffsets.Num());
+	OutUV2.SetNumUninitialized(StepOffsets.Num());
+	for (int32 i = 0; i < StepOffsets.Num(); ++i)
+	{
+		OutUV1[i] = FVector2D(StepOffsets[i].X, StepOffsets[i].Y);
+		OutUV2[i] = FVector2D(StepOffsets[i].Z, 0.0);
+	}
+}
+
+void UFluidVisualizationComponent::UpdateMeshStepBlend()
+{
+	const FFluidSimulationSnapshotPtr Snapshot = bInterpolateSimulationSteps ? GetSimulationSnapshot() : FFluidSimulationSnapshotPtr();
+	for (const auto& Pair : ChunkMarchingCubesMeshes)
+	{
+		UMaterialInstanceDynamic* Material = Pair.Value ? Cast<UMaterialInstanceDynamic>(Pair.Value->GetMaterial(0)) : nullptr;
+		if (!Material)
+			continue;
+
+		// Offsets lead back one step from the step the mesh was built at; a mesh that fell behind shows as built
+		const uint64* MeshStep = ChunkMeshSteps.Find(Pair.Key);
+		const bool bBlend = Snapshot.IsValid() && MeshStep && *MeshStep == Snapshot->StepIndex;
+		Material->SetScalarParameterValue(StepAlphaParameterName, bBlend ? SimulationStepAlpha : 1.0f);
+	}
+}
+
+void UFluidVisualizationComponent::GenerateChunkMeshWithLOD(UFluidChunk* Chunk, int32 LODLevel, TArray<FMarchingCubes::FMarchingCubesVertex>& OutVertices, TArray<FMarchingCubes::FMarchingCubesTriangle>& OutTriangles,
+	TArray<FVector>* OutStepOffsets, uint64* OutSnapshotStep)
 {
 	if (!Chunk || !ChunkManager)
 		return;
+
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(&ChunkManager->GetFrameProfiler(), EFluidFramePhase::Meshing, Chunk->ChunkCoord);
+	FFluidChunkProfiler::FScopedRemesh RemeshScope(&ChunkManager->GetChunkProfiler(), Chunk->ChunkCoord);
+
+	if (const FFluidSimulationSnapshotPtr Snapshot = GetSimulationSnapshot())
+	{
+		const float LODIsoLevel = LODLevel == 0 ? MarchingCubesIsoLevel : MarchingCubesIsoLevel * (LODLevel == 1 ? 1.2f : 1.5f);
+		GenerateSnapshotChunkMesh(*Snapshot, Chunk->ChunkCoord, LODIsoLevel, OutVertices, OutTriangles, bInterpolateSimulationSteps ? OutStepOffsets : nullptr);
+		if (OutSnapshotStep)
+		{
+			*OutSnapshotStep = Snapshot->StepIndex;
+		}
+		return;
+	}
 		
 	// Determine effective resolution multiplier based on LOD and adaptive settings
 	int32 EffectiveResolution = MarchingCubesResolutionMultiplier;
@@ -1420,6 +1626,7 @@ void UFluidVisualizationComponent::ProcessAsyncMeshTasks()
 	}
 	
 	// Apply completed meshes on the game thread
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(FFluidFrameProfiler::Get(ChunkManager), EFluidFramePhase::Meshing);
 	for (const TSharedPtr<FAsyncMeshGenerationTask>& Task : CompletedTasks)
 	{
 		ApplyGeneratedMesh(Task);
@@ -1467,14 +1674,18 @@ void UFluidVisualizationComponent::StartAsyncMeshGeneration(UFluidChunk* Chunk,
 	}
 	
 	// Capture necessary data for async generation
+	// With a simulation thread the task meshes the published snapshot and never reads live cells
+	const FFluidSimulationSnapshotPtr Snapshot = GetSimulationSnapshot();
+	const FFluidChunkCoord ChunkCoord = Chunk->ChunkCoord;
 	UFluidChunk* ChunkPtr = Chunk;
 	UFluidChunkManager* ChunkMgrPtr = ChunkManager;
 	int32 ResMultiplier = NewTask->ResolutionMultiplier;
 	float IsoLevel = NewTask->IsoLevel;
 	bool bFlipNorms = bFlipNormals;
+	const bool bStepOffsets = bInterpolateSimulationSteps;
 	
 	// Launch async task - Add validation to prevent crashes on runtime edits
-	Async(EAsyncExecution::TaskGraph, [NewTask, ChunkPtr, ChunkMgrPtr, LODLevel, ResMultiplier, IsoLevel, bFlipNorms]()
+	Async(EAsyncExecution::TaskGraph, [NewTask, Snapshot, ChunkCoord, ChunkPtr, ChunkMgrPtr, LODLevel, ResMultiplier, IsoLevel, bStepOffsets, bFlipNorms]()
 	{
 		// CRITICAL: Validate objects before accessing - prevent crash on runtime edits
 		if (!ChunkPtr || !ChunkMgrPtr || !IsValid(ChunkPtr) || !IsValid(ChunkMgrPtr))
@@ -1488,40 +1699,50 @@ void UFluidVisualizationComponent::StartAsyncMeshGeneration(UFluidChunk* Chunk,
 		// Generate mesh data on background thread
 		TArray<FMarchingCubes::FMarchingCubesVertex> MarchingVertices;
 		TArray<FMarchingCubes::FMarchingCubesTriangle> MarchingTriangles;
+		TArray<FVector> StepOffsets;
 		
 		// Generate based on LOD and resolution
-		switch (LODLevel)
+		if (Snapshot.IsValid())
 		{
-			case 0: // Full detail
-				if (ResMultiplier > 1)
-				{
-					FMarchingCubes::GenerateHighResChunkMesh(ChunkPtr, ChunkMgrPtr, IsoLevel, 
-					                                       ResMultiplier, MarchingVertices, MarchingTriangles);
-				}
-				else
-				{
-					FMarchingCubes::GenerateSeamlessChunkMesh(ChunkPtr, ChunkMgrPtr, IsoLevel, 
-					                                        MarchingVertices, MarchingTriangles);
-				}
-				break;
+			const float LODIsoLevel = LODLevel == 0 ? IsoLevel : IsoLevel * (LODLevel == 1 ? 1.2f : 1.5f);
+			GenerateSnapshotChunkMesh(*Snapshot, ChunkCoord, LODIsoLevel, MarchingVertices, MarchingTriangles, bStepOffsets ? &StepOffsets : nullptr);
+			NewTask->SnapshotStep = Snapshot->StepIndex;
+		}
+		else
+		{
+			switch (LODLevel)
+			{
+				case 0: // Full detail
+					if (ResMultiplier > 1)
+					{
+						FMarchingCubes::GenerateHighResChunkMesh(ChunkPtr, ChunkMgrPtr, IsoLevel, 
+						                                       ResMultiplier, MarchingVertices, MarchingTriangles);
+					}
+					else
+					{
+						FMarchingCubes::GenerateSeamlessChunkMesh(ChunkPtr, ChunkMgrPtr, IsoLevel, 
+						                                        MarchingVertices, MarchingTriangles);
+					}
+					break;
 				
-			case 1: // Medium detail
-				if (ResMultiplier > 1)
-				{
-					FMarchingCubes::GenerateHighResChunkMesh(ChunkPtr, ChunkMgrPtr, IsoLevel * 1.1f, 
-					                                       ResMultiplier, MarchingVertices, MarchingTriangles);
-				}
-				else
-				{
-					FMarchingCubes::GenerateSeamlessChunkMesh(ChunkPtr, ChunkMgrPtr, IsoLevel * 1.2f, 
-					                                        MarchingVertices, MarchingTriangles);
-				}
-				break;
+				case 1: // Medium detail
+					if (ResMultiplier > 1)
+					{
+						FMarchingCubes::GenerateHighResChunkMesh(ChunkPtr, ChunkMgrPtr, IsoLevel * 1.1f, 
+						                                       ResMultiplier, MarchingVertices, MarchingTriangles);
+					}
+					else
+					{
+						FMarchingCubes::GenerateSeamlessChunkMesh(ChunkPtr, ChunkMgrPtr, IsoLevel * 1.2f, 
+						                                        MarchingVertices, MarchingTriangles);
+					}
+					break;
 				
-			case 2: // Low detail
-			default:
-				FMarchingCubes::GenerateChunkMesh(ChunkPtr, IsoLevel * 1.5f, MarchingVertices, MarchingTriangles);
-				break;
+				case 2: // Low detail
+				default:
+					FMarchingCubes::GenerateChunkMesh(ChunkPtr, IsoLevel * 1.5f, MarchingVertices, MarchingTriangles);
+					break;
+			}
 		}
 		
 		// Convert to procedural mesh format
@@ -1564,6 +1785,11 @@ void UFluidVisualizationComponent::StartAsyncMeshGeneration(UFluidChunk* Chunk,
 				NewTask->Triangles.Add(MarchingTriangle.VertexIndices[1]);
 				NewTask->Triangles.Add(MarchingTriangle.VertexIndices[2]);
 			}
+
+			if (StepOffsets.Num() == MarchingVertices.Num())
+			{
+				PackStepOffsets(StepOffsets, NewTask->StepOffsetsXY, NewTask->StepOffsetsZ);
+			}
 		}
 		
 		// Mark as completed
@@ -1575,6 +1801,9 @@ void UFluidVisualizationComponent::ApplyGeneratedMesh(TSharedPtr<FAsyncMeshGener
 {
 	if (!Task || !Task->Chunk || Task->Vertices.Num() == 0)
 		return;
+
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(FFluidFrameProfiler::Get(ChunkManager), EFluidFramePhase::Meshing, Task->Chunk->ChunkCoord);
+	FFluidChunkProfiler::FScopedRemesh RemeshScope(FFluidChunkProfiler::Get(ChunkManager), Task->Chunk->ChunkCoord);
 	
 	// Get or create procedural mesh component for this chunk
 	UProceduralMeshComponent* ChunkMesh = nullptr;
@@ -1591,7 +1820,7 @@ void UFluidVisualizationComponent::ApplyGeneratedMesh(TSharedPtr<FAsyncMeshGener
 		
 		if (FluidMaterial)
 		{
-			ChunkMesh->SetMaterial(0, FluidMaterial);
+			ChunkMesh->CreateDynamicMaterialInstance(0, FluidMaterial);
 		}
 		
 		ChunkMarchingCubesMeshes.Add(Task->Chunk, ChunkMesh);
@@ -1604,17 +1833,28 @@ void UFluidVisualizationComponent::ApplyGeneratedMesh(TSharedPtr<FAsyncMeshGener
 		
 		if (Task->Vertices.Num() > 0 && Task->Triangles.Num() > 0)
 		{
-			// Create mesh section
-			ChunkMesh->CreateMeshSection(
-				0, // Section index
-				Task->Vertices,
-				Task->Triangles,
-				Task->Normals,
-				Task->UVs,
-				Task->VertexColors,
-				TArray<FProcMeshTangent>(), // Tangents (auto-calculated)
-				bGenerateCollision
-			);
+			if (Task->StepOffsetsXY.Num() == Task->Vertices.Num())
+			{
+				// Step offsets ride in UV1/UV2 for the material to blend toward the latest step
+				ChunkMesh->CreateMeshSection(0, Task->Vertices, Task->Triangles, Task->Normals, Task->UVs, Task->StepOffsetsXY, Task->StepOffsetsZ,
+					TArray<FVector2D>(), Task->VertexColors, TArray<FProcMeshTangent>(), bGenerateCollision);
+				ChunkMeshSteps.Add(Task->Chunk, Task->SnapshotStep);
+			}
+			else
+			{
+				// Create mesh section
+				ChunkMesh->CreateMeshSection(
+					0, // Section index
+					Task->Vertices,
+					Task->Triangles,
+					Task->Normals,
+					Task->UVs,
+					Task->VertexColors,
+					TArray<FProcMeshTangent>(), // Tangents (auto-calculated)
+					bGenerateCollision
+				);
+				ChunkMeshSteps.Remove(Task->Chunk);
+			}
 		}
 		
 		// Update cached mesh data on the chunk
@@ -1,6 +1,13 @@
 #include "VoxelFluidDebug.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDeviceRedirector.h"
 
 DEFINE_LOG_CATEGORY(LogVoxelFluidDebug);
+DEFINE_LOG_CATEGORY(LogVoxelFluidSim);
+DEFINE_LOG_CATEGORY(LogVoxelFluidStreaming);
+DEFINE_LOG_CATEGORY(LogVoxelFluidStaticWater);
+DEFINE_LOG_CATEGORY(LogVoxelFluidRender);
+DEFINE_LOG_CATEGORY(LogVoxelFluidActivation);
 
 // Console variable for global debug logging
 TAutoConsoleVariable<bool> CVarEnableVoxelFluidDebugLogging(
@@ -8,4 +15,150 @@ TAutoConsoleVariable<bool> CVarEnableVoxelFluidDebugLogging(
 	false,
 	TEXT("Enable debug logging for VoxelFluid system components"),
 	ECVF_Default
-);
\ No newline at end of file
+);
+
+#if VOXELFLUID_DIAGNOSTICS
+static bool GVoxelFluidTraceEnabled = true;
+static FAutoConsoleVariableRef CVarVoxelFluidTrace(
+	TEXT("voxelfluid.Trace"),
+	GVoxelFluidTraceEnabled,
+	TEXT("Record structured VoxelFluid events into the in-memory trace ring"),
+	ECVF_Default
+);
+
+static FAutoConsoleCommand CmdVoxelFluidDumpTrace(
+	TEXT("voxelfluid.DumpTrace"),
+	TEXT("Print the most recent VoxelFluid trace events to the log. Usage: voxelfluid.DumpTrace [Count]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 Count = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 256;
+		FVoxelFluidTrace::Dump(*GLog, FMath::Max(Count, 1));
+	})
+);
+
+static FAutoConsoleCommand CmdVoxelFluidResetTrace(
+	TEXT("voxelfluid.ResetTrace"),
+	TEXT("Discard all recorded VoxelFluid trace events"),
+	FConsoleCommandDelegate::CreateStatic(&FVoxelFluidTrace::Reset)
+);
+
+FVoxelFluidTrace::FSlot FVoxelFluidTrace::Slots[FVoxelFluidTrace::Capacity];
+std::atomic<uint64> FVoxelFluidTrace::Head{0};
+std::atomic<uint64> FVoxelFluidTrace::ResetIndex{0};
+
+static_assert((FVoxelFluidTrace::Capacity & (FVoxelFluidTrace::Capacity - 1)) == 0, "Trace capacity must be a power of two");
+
+bool FVoxelFluidTrace::IsEnabled()
+{
+	return GVoxelFluidTraceEnabled;
+}
+
+void FVoxelFluidTrace::Record(EVoxelFluidTraceEvent Event, int32 A, int32 B, int32 C, float Value)
+{
+	if (!GVoxelFluidTraceEnabled)
+	{
+		return;
+	}
+
+	const uint64 Index = Head.fetch_add(1, std::memory_order_relaxed);
+	FSlot& Slot = Slots[Index & (Capacity - 1)];
+
+	// Unpublish the slot while it is rewritten so a concurrent reader discards it
+	Slot.Sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	FVoxelFluidTraceRecord& Rec = Slot.Record;
+	Rec.Time = FPlatformTime::Seconds();
+	Rec.Sequence = Index;
+	Rec.ThreadId = FPlatformTLS::GetCurrentThreadId();
+	Rec.Event = Event;
+	Rec.A = A;
+	Rec.B = B;
+	Rec.C = C;
+	Rec.Value = Value;
+
+	Slot.Sequence.store(Index + 1, std::memory_order_release);
+}
+
+void FVoxelFluidTrace::Snapshot(TArray<FVoxelFluidTraceRecord>& OutRecords, int32 MaxRecords)
+{
+	OutRecords.Reset();
+
+	const uint64 End = Head.load(std::memory_order_acquire);
+	const uint64 Floor = ResetIndex.load(std::memory_order_relaxed);
+	const uint64 Count = FMath::Min<uint64>(FMath::Min<uint64>(End - FMath::Min(End, Floor), Capacity), (uint64)FMath::Max(MaxRecords, 0));
+	OutRecords.Reserve((int32)Count);
+
+	for (uint64 Index = End - Count; Index < End; ++Index)
+	{
+		const FSlot& Slot = Slots[Index & (Capacity - 1)];
+		const uint64 Before = Slot.Sequence.load(std::memory_order_acquire);
+		if (Before != Index + 1)
+		{
+			continue; // Still being written, or already overwritten by a newer lap
+		}
+
+		FVoxelFluidTraceRecord Copy = Slot.Record;
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (Slot.Sequence.load(std::memory_order_relaxed) == Before)
+		{
+			OutRecords.Add(Copy);
+		}
+	}
+}
+
+void FVoxelFluidTrace::Dump(FOutputDevice& Ar, int32 MaxRecords)
+{
+	TArray<FVoxelFluidTraceRecord> Records;
+	Snapshot(Records, MaxRecords);
+
+	Ar.Logf(TEXT("VoxelFluid trace: %d events shown, %llu recorded in total"), Records.Num(), GetTotalRecorded());
+	if (Records.Num() == 0)
+	{
+		return;
+	}
+
+	const double StartTime = Records[0].Time;
+	for (const FVoxelFluidTraceRecord& Rec : Records)
+	{
+		Ar.Logf(TEXT("  [%8llu] +%9.3fms T%-6u %-20s %d, %d, %d  %.3f"),
+			Rec.Sequence, (Rec.Time - StartTime) * 1000.0, Rec.ThreadId, GetEventName(Rec.Event),
+			Rec.A, Rec.B, Rec.C, Rec.Value);
+	}
+}
+
+void FVoxelFluidTrace::Reset()
+{
+	ResetIndex.store(Head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+const TCHAR* FVoxelFluidTrace::GetEventName(EVoxelFluidTraceEvent Event)
+{
+	switch (Event)
+	{
+	case EVoxelFluidTraceEvent::None:                return TEXT("None");
+	case EVoxelFluidTraceEvent::ChunkLoaded:         return TEXT("ChunkLoaded");
+	case EVoxelFluidTraceEvent::ChunkUnloaded:       return TEXT("ChunkUnloaded");
+	case EVoxelFluidTraceEvent::ChunkActivated:      return TEXT("ChunkActivated");
+	case EVoxelFluidTraceEvent::ChunkSettled:        return TEXT("ChunkSettled");
+	case EVoxelFluidTraceEvent::ChunkDeactivated:    return TEXT("ChunkDeactivated");
+	case EVoxelFluidTraceEvent::FluidAdded:          return TEXT("FluidAdded");
+	case EVoxelFluidTraceEvent::EditActivation:      return TEXT("EditActivation");
+	case EVoxelFluidTraceEvent::RenderChunkQueued:   return TEXT("RenderChunkQueued");
+	case EVoxelFluidTraceEvent::RenderChunkLoaded:   return TEXT("RenderChunkLoaded");
+	case EVoxelFluidTraceEvent::RenderChunkUnloaded: return TEXT("RenderChunkUnloaded");
+	case EVoxelFluidTraceEvent::RenderChunkHidden:   return TEXT("RenderChunkHidden");
+	case EVoxelFluidTraceEvent::RenderMeshBuilt:     return TEXT("RenderMeshBuilt");
+	case EVoxelFluidTraceEvent::RenderMeshEmpty:     return TEXT("RenderMeshEmpty");
+	case EVoxelFluidTraceEvent::RenderLoadQueue:     return TEXT("RenderLoadQueue");
+	case EVoxelFluidTraceEvent::OceanCreated:        return TEXT("OceanCreated");
+	case EVoxelFluidTraceEvent::OceanMoved:          return TEXT("OceanMoved");
+	case EVoxelFluidTraceEvent::StaticTileGenerated: return TEXT("StaticTileGenerated");
+	case EVoxelFluidTraceEvent::RegionActivated:     return TEXT("RegionActivated");
+	case EVoxelFluidTraceEvent::RegionDeactivated:   return TEXT("RegionDeactivated");
+	case EVoxelFluidTraceEvent::RegionEvicted:       return TEXT("RegionEvicted");
+	default:                                         return TEXT("Unknown");
+	}
+}
+
+#endif // VOXELFLUID_DIAGNOSTICS
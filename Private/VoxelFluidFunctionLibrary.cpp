@@ -39,17 +39,20 @@ void UVoxelFluidFunctionLibrary::AddRainToFluidSystem(AVoxelFluidActor* FluidAct
 
 	const FVector ActorLocation = FluidActor->GetActorLocation();
 	
-	// Add rain using the chunk manager
-	// This will automatically handle chunk loading and fluid distribution
+	// All drops go in as one scattered edit, grouped per chunk
 	const int32 NumDrops = FMath::CeilToInt(Radius * Radius * Intensity * 0.01f);
+	TArray<FVector> DropLocations;
+	DropLocations.Reserve(NumDrops);
 	for (int32 i = 0; i < NumDrops; ++i)
 	{
 		const float Angle = FMath::FRand() * 2.0f * PI;
 		const float Distance = FMath::Sqrt(FMath::FRand()) * Radius;
-		const FVector DropLocation = ActorLocation + FVector(FMath::Cos(Angle) * Distance, FMath::Sin(Angle) * Distance, 1000.0f);
-		
-		FluidActor->AddFluidAtLocation(DropLocation, Intensity * 0.1f);
+		DropLocations.Add(ActorLocation + FVector(FMath::Cos(Angle) * Distance, FMath::Sin(Angle) * Distance, 1000.0f));
 	}
+
+	FFluidBulkEdit Edit(*FluidActor->ChunkManager);
+	Edit.AddPoints(DropLocations, FluidActor->GetAdjustedFluidAmount(Intensity * 0.1f));
+	FluidActor->ApplyFluidBulkEdit(Edit);
 }
 
 void UVoxelFluidFunctionLibrary::CreateFluidSource(AVoxelFluidActor* FluidActor, const FVector& SourceLocation, float FlowRate)
@@ -65,8 +68,12 @@ void UVoxelFluidFunctionLibrary::CreateFluidSplash(AVoxelFluidActor* FluidActor,
 	if (!FluidActor || !FluidActor->ChunkManager)
 		return;
 
-	// Create splash using chunk manager
+	// Create splash as one scattered edit
 	const int32 NumSplashPoints = FMath::CeilToInt(SplashRadius * 0.1f);
+	TArray<FVector> SplashPoints;
+	TArray<float> SplashAmounts;
+	SplashPoints.Reserve(NumSplashPoints);
+	SplashAmounts.Reserve(NumSplashPoints);
 	for (int32 i = 0; i < NumSplashPoints; ++i)
 	{
 		const FVector RandomOffset = FVector(
@@ -75,12 +82,72 @@ void UVoxelFluidFunctionLibrary::CreateFluidSplash(AVoxelFluidActor* FluidActor,
 			FMath::RandRange(0.0f, SplashRadius * 0.5f)
 		);
 		
-		const FVector SplashPoint = ImpactLocation + RandomOffset;
 		const float Distance = RandomOffset.Size();
 		const float Falloff = 1.0f - FMath::Clamp(Distance / SplashRadius, 0.0f, 1.0f);
 		
-		FluidActor->AddFluidAtLocation(SplashPoint, SplashAmount * Falloff);
+		SplashPoints.Add(ImpactLocation + RandomOffset);
+		SplashAmounts.Add(FluidActor->GetAdjustedFluidAmount(SplashAmount * Falloff));
 	}
+
+	FFluidBulkEdit Edit(*FluidActor->ChunkManager);
+	Edit.AddPoints(SplashPoints, SplashAmounts);
+	FluidActor->ApplyFluidBulkEdit(Edit);
+}
+
+static FFluidBulkEditResult ApplyBulkEdit(AVoxelFluidActor* FluidActor, TFunctionRef<void(FFluidBulkEdit&)> Build)
+{
+	if (!FluidActor || !FluidActor->ChunkManager)
+		return FFluidBulkEditResult();
+
+	FFluidBulkEdit Edit(*FluidActor->ChunkManager);
+	Build(Edit);
+	return FluidActor->ApplyFluidBulkEdit(Edit);
+}
+
+FFluidBulkEditResult UVoxelFluidFunctionLibrary::FillFluidSphere(AVoxelFluidActor* FluidActor, const FVector& Center, float Radius, float Amount, bool bFalloff)
+{
+	return ApplyBulkEdit(FluidActor, [&](FFluidBulkEdit& Edit) { Edit.AddSphere(Center, Radius, Amount, EFluidEditOp::Add, bFalloff); });
+}
+
+FFluidBulkEditResult UVoxelFluidFunctionLibrary::DrainFluidSphere(AVoxelFluidActor* FluidActor, const FVector& Center, float Radius, float Amount)
+{
+	return ApplyBulkEdit(FluidActor, [&](FFluidBulkEdit& Edit) { Edit.AddSphere(Center, Radius, Amount, EFluidEditOp::Remove); });
+}
+
+FFluidBulkEditResult UVoxelFluidFunctionLibrary::FillFluidBox(AVoxelFluidActor* FluidActor, const FBox& Box, float Amount)
+{
+	return ApplyBulkEdit(FluidActor, [&](FFluidBulkEdit& Edit) { Edit.AddBox(Box, Amount, EFluidEditOp::Add); });
+}
+
+FFluidBulkEditResult UVoxelFluidFunctionLibrary::DrainFluidBox(AVoxelFluidActor* FluidActor, const FBox& Box, float Amount)
+{
+	return ApplyBulkEdit(FluidActor, [&](FFluidBulkEdit& Edit) { Edit.AddBox(Box, Amount, EFluidEditOp::Remove); });
+}
+
+FFluidBulkEditResult UVoxelFluidFunctionLibrary::SetFluidLevelInBox(AVoxelFluidActor* FluidActor, const FBox& Box, float Level)
+{
+	return ApplyBulkEdit(FluidActor, [&](FFluidBulkEdit& Edit) { Edit.AddBox(Box, Level, EFluidEditOp::SetLevel); });
+}
+
+FFluidBulkEditResult UVoxelFluidFunctionLibrary::SetFluidLevelInSphere(AVoxelFluidActor* FluidActor, const FVector& Center, float Radius, float Level)
+{
+	return ApplyBulkEdit(FluidActor, [&](FFluidBulkEdit& Edit) { Edit.AddSphere(Center, Radius, Level, EFluidEditOp::SetLevel); });
+}
+
+FFluidBulkEditResult UVoxelFluidFunctionLibrary::AddFluidAtLocations(AVoxelFluidActor* FluidActor, const TArray<FVector>& Locations, float AmountPerLocation)
+{
+	return ApplyBulkEdit(FluidActor, [&](FFluidBulkEdit& Edit) { Edit.AddPoints(Locations, AmountPerLocation); });
+}
+
+FFluidBulkEditResult UVoxelFluidFunctionLibrary::FloodFluidHeightfield(AVoxelFluidActor* FluidActor, const FVector2D& GridOrigin, float GridSpacing,
+	int32 SizeX, int32 SizeY, const TArray<float>& SurfaceHeights, float FloorZ, bool bDrain)
+{
+	return ApplyBulkEdit(FluidActor, [&](FFluidBulkEdit& Edit)
+	{
+		// Filling sets each column to its surface; draining empties everything under it
+		Edit.AddHeightfield(GridOrigin, GridSpacing, SizeX, SizeY, SurfaceHeights, FloorZ,
+			bDrain ? 0.0f : 1.0f, EFluidEditOp::SetLevel);
+	});
 }
 
 void UVoxelFluidFunctionLibrary::SyncAllFluidActorsWithTerrain(UObject* WorldContextObject)
@@ -111,10 +178,15 @@ float UVoxelFluidFunctionLibrary::GetFluidDepthAtLocation(AVoxelFluidActor* Flui
 	if (!FluidActor || !FluidActor->ChunkManager)
 		return 0.0f;
 
-	// Query fluid depth from chunk manager
-	// TODO: Implement GetFluidDepthAtWorldPosition in ChunkManager
-	// For now return 0.0f as placeholder
-	return 0.0f;
+	return FluidActor->GetFluidDepthAtLocation(WorldLocation);
+}
+
+FVector UVoxelFluidFunctionLibrary::GetFluidVelocityAtLocation(AVoxelFluidActor* FluidActor, const FVector& WorldLocation)
+{
+	if (!FluidActor || !FluidActor->ChunkManager)
+		return FVector::ZeroVector;
+
+	return FluidActor->GetFlowVelocityAtLocation(WorldLocation);
 }
 
 bool UVoxelFluidFunctionLibrary::IsLocationSubmerged(AVoxelFluidActor* FluidActor, const FVector& WorldLocation, float MinDepth)
@@ -0,0 +1,497 @@
+#include "VoxelFluidMemory.h"
+#include "VoxelFluidStats.h"
+#include "CellularAutomata/FluidSimulationThread.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DelayedAutoRegister.h"
+#include "Misc/OutputDeviceRedirector.h"
+
+FCriticalSection FFluidMemoryTracker::Mutex;
+TArray<const IFluidMemoryReporter*> FFluidMemoryTracker::Reporters;
+FFluidMemoryReport FFluidMemoryTracker::LastReport;
+FFluidMemoryReport FFluidMemoryTracker::PeakReport;
+int64 FFluidMemoryTracker::PeakTotal = 0;
+
+FFluidAllocationTracker::FSiteSlot FFluidAllocationTracker::Slots[FFluidAllocationTracker::MaxSites];
+std::atomic<bool> FFluidAllocationTracker::bEnabled{ false };
+FCriticalSection FFluidAllocationTracker::Mutex;
+int64 FFluidAllocationTracker::StepBaseAllocs[FFluidAllocationTracker::MaxSites] = {};
+int64 FFluidAllocationTracker::StepBaseBytes[FFluidAllocationTracker::MaxSites] = {};
+FFluidAllocationReport FFluidAllocationTracker::LastStep;
+int64 FFluidAllocationTracker::MaxStepAllocs = 0;
+int64 FFluidAllocationTracker::StepCount = 0;
+
+// Slot of the innermost allocation scope on this thread
+static thread_local int32 GCurrentAllocSlot = INDEX_NONE;
+
+#if VOXELFLUID_DIAGNOSTICS
+// Forwards everything to the allocator it replaced, counting requests made under an allocation scope
+class FFluidTrackingMalloc final : public FMalloc
+{
+public:
+	explicit FFluidTrackingMalloc(FMalloc* InInner) : Inner(InInner) {}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		FFluidAllocationTracker::NoteAllocation(Count);
+		return Inner->Malloc(Count, Alignment);
+	}
+
+	virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+	{
+		FFluidAllocationTracker::NoteAllocation(Count);
+		return Inner->TryMalloc(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+		{
+			FFluidAllocationTracker::NoteAllocation(Count);
+		}
+		return Inner->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+		{
+			FFluidAllocationTracker::NoteAllocation(Count);
+		}
+		return Inner->TryRealloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override { Inner->Free(Original); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+	virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+	virtual void UpdateStats() override { Inner->UpdateStats(); }
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+	virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+	virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+	virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+	virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+private:
+	FMalloc* Inner;
+};
+
+static FFluidTrackingMalloc* GFluidTrackingMalloc = nullptr;
+static FMalloc* GFluidTrackedMalloc = nullptr;
+
+// GMalloc only changes here, before gameplay starts, and only when the command line asks for tracking
+static FDelayedAutoRegisterHelper GFluidTrackingMallocInstaller(EDelayedRegisterRunPhase::ObjectSystemReady, []()
+{
+	int32 AllocBudget = 0;
+	if (!FParse::Param(FCommandLine::Get(), TEXT("FluidAllocTracking")) && !FParse::Value(FCommandLine::Get(), TEXT("allocbudget="), AllocBudget))
+	{
+		return;
+	}
+
+	check(IsInGameThread());
+	GFluidTrackedMalloc = GMalloc;
+	GFluidTrackingMalloc = new FFluidTrackingMalloc(GMalloc);
+	GMalloc = GFluidTrackingMalloc;
+
+	// The proxy itself is leaked; a thread may still be inside it when it comes out
+	FCoreDelegates::OnExit.AddLambda([]()
+	{
+		FFluidAllocationTracker::SetEnabled(false);
+		if (GMalloc == GFluidTrackingMalloc)
+		{
+			GMalloc = GFluidTrackedMalloc;
+		}
+	});
+});
+#endif
+
+static FAutoConsoleCommand CmdVoxelFluidMemory(
+	TEXT("voxelfluid.Memory"),
+	TEXT("Print allocated VoxelFluid memory per subsystem with high-water marks. Usage: voxelfluid.Memory [reset]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+		{
+			FFluidMemoryTracker::ResetPeaks();
+		}
+		FFluidMemoryTracker::Dump(*GLog);
+	})
+);
+
+static FAutoConsoleCommand CmdVoxelFluidAllocations(
+	TEXT("voxelfluid.Allocations"),
+	TEXT("Count heap allocations per fluid call site and step. Usage: voxelfluid.Allocations on|off|reset|dump"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FString Action = Args.Num() > 0 ? Args[0].ToLower() : FString(TEXT("dump"));
+		if (Action == TEXT("on") || Action == TEXT("off"))
+		{
+			FFluidAllocationTracker::SetEnabled(Action == TEXT("on"));
+		}
+		else if (Action == TEXT("reset"))
+		{
+			FFluidAllocationTracker::Reset();
+		}
+
+		GLog->Logf(TEXT("VoxelFluid allocations%s: %lld steps, worst step %lld allocs"), FFluidAllocationTracker::IsEnabled() ? TEXT("") : TEXT(" (disabled)"),
+			FFluidAllocationTracker::GetStepCount(), FFluidAllocationTracker::GetMaxStepAllocs());
+		GLog->Logf(TEXT("  Last step: %s"), *FFluidAllocationTracker::GetLastStep().ToString());
+		GLog->Logf(TEXT("  Total: %s"), *FFluidAllocationTracker::GetTotals().ToString());
+	})
+);
+
+static double ToMB(int64 Bytes)
+{
+	return Bytes / (1024.0 * 1024.0);
+}
+
+const TCHAR* LexToString(EFluidMemoryCategory Category)
+{
+	switch (Category)
+	{
+	case EFluidMemoryCategory::ChunkCells:        return TEXT("ChunkCells");
+	case EFluidMemoryCategory::ChunkSparse:       return TEXT("ChunkSparse");
+	case EFluidMemoryCategory::ChunkBorders:      return TEXT("ChunkBorders");
+	case EFluidMemoryCategory::ChunkFlow:         return TEXT("ChunkFlow");
+	case EFluidMemoryCategory::ChunkMeshCache:    return TEXT("ChunkMeshCache");
+	case EFluidMemoryCategory::ChunkPersistence:  return TEXT("ChunkPersistence");
+	case EFluidMemoryCategory::ChunkBookkeeping:  return TEXT("ChunkBookkeeping");
+	case EFluidMemoryCategory::Snapshots:         return TEXT("Snapshots");
+	case EFluidMemoryCategory::MeshBuffers:       return TEXT("MeshBuffers");
+	case EFluidMemoryCategory::TerrainCache:      return TEXT("TerrainCache");
+	case EFluidMemoryCategory::StaticWater:       return TEXT("StaticWater");
+	case EFluidMemoryCategory::StaticWaterRender: return TEXT("StaticWaterRender");
+	case EFluidMemoryCategory::Activation:        return TEXT("Activation");
+	default:                                      return TEXT("Unknown");
+	}
+}
+
+int64 FFluidMemoryReport::GetTotal() const
+{
+	int64 Total = 0;
+	for (int64 CategoryBytes : Bytes)
+	{
+		Total += CategoryBytes;
+	}
+	return Total;
+}
+
+int64 FFluidMemoryReport::GetChunkTotal() const
+{
+	return Get(EFluidMemoryCategory::ChunkCells) + Get(EFluidMemoryCategory::ChunkSparse) + Get(EFluidMemoryCategory::ChunkBorders)
+		+ Get(EFluidMemoryCategory::ChunkFlow) + Get(EFluidMemoryCategory::ChunkMeshCache) + Get(EFluidMemoryCategory::ChunkPersistence)
+		+ Get(EFluidMemoryCategory::ChunkBookkeeping);
+}
+
+FFluidMemoryReport& FFluidMemoryReport::operator+=(const FFluidMemoryReport& Other)
+{
+	for (int32 i = 0; i < (int32)EFluidMemoryCategory::Count; ++i)
+	{
+		Bytes[i] += Other.Bytes[i];
+	}
+	return *this;
+}
+
+FString FFluidMemoryReport::ToString() const
+{
+	FString Result = FString::Printf(TEXT("Total %.2f MB"), ToMB(GetTotal()));
+	for (int32 i = 0; i < (int32)EFluidMemoryCategory::Count; ++i)
+	{
+		if (Bytes[i] > 0)
+		{
+			Result += FString::Printf(TEXT(", %s %.2f MB"), LexToString((EFluidMemoryCategory)i), ToMB(Bytes[i]));
+		}
+	}
+	return Result;
+}
+
+void FFluidMemoryTracker::Register(const IFluidMemoryReporter* Reporter)
+{
+	if (Reporter)
+	{
+		FScopeLock Lock(&Mutex);
+		Reporters.AddUnique(Reporter);
+	}
+}
+
+void FFluidMemoryTracker::Unregister(const IFluidMemoryReporter* Reporter)
+{
+	FScopeLock Lock(&Mutex);
+	Reporters.RemoveSingleSwap(Reporter);
+}
+
+FFluidMemoryReport FFluidMemoryTracker::Capture()
+{
+	check(IsInGameThread());
+	FScopeLock Lock(&Mutex);
+
+	FFluidMemoryReport Report;
+	for (const IFluidMemoryReporter* Reporter : Reporters)
+	{
+		// Chunk containers change during a step; simulation threads never take Mutex, so this order cannot deadlock
+		FFluidSimulationThread::FScopedAccess SimulationAccess(Reporter->GetSimulationManager());
+		Reporter->ReportMemory(Report);
+	}
+
+	for (int32 i = 0; i < (int32)EFluidMemoryCategory::Count; ++i)
+	{
+		PeakReport.Bytes[i] = FMath::Max(PeakReport.Bytes[i], Report.Bytes[i]);
+	}
+	const int64 Total = Report.GetTotal();
+	PeakTotal = FMath::Max(PeakTotal, Total);
+	LastReport = Report;
+
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemTotal, Total);
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemPeak, PeakTotal);
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemChunkCells, Report.Get(EFluidMemoryCategory::ChunkCells));
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemChunkSparse, Report.Get(EFluidMemoryCategory::ChunkSparse));
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemChunkBorders, Report.Get(EFluidMemoryCategory::ChunkBorders));
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemChunkFlow, Report.Get(EFluidMemoryCategory::ChunkFlow));
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemChunkMeshCache, Report.Get(EFluidMemoryCategory::ChunkMeshCache));
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemChunkPersistence, Report.Get(EFluidMemoryCategory::ChunkPersistence));
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemChunkBookkeeping, Report.Get(EFluidMemoryCategory::ChunkBookkeeping));
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemSnapshots, Report.Get(EFluidMemoryCategory::Snapshots));
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemMeshBuffers, Report.Get(EFluidMemoryCategory::MeshBuffers));
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemTerrainCache, Report.Get(EFluidMemoryCategory::TerrainCache));
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemStaticWater, Report.Get(EFluidMemoryCategory::StaticWater));
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemStaticWaterRender, Report.Get(EFluidMemoryCategory::StaticWaterRender));
+	SET_MEMORY_STAT(STAT_VoxelFluid_MemActivation, Report.Get(EFluidMemoryCategory::Activation));
+	SET_DWORD_STAT(STAT_VoxelFluid_TotalMemoryMB, (uint32)(Total / (1024 * 1024)));
+
+	return Report;
+}
+
+FFluidMemoryReport FFluidMemoryTracker::GetLastReport()
+{
+	FScopeLock Lock(&Mutex);
+	return LastReport;
+}
+
+FFluidMemoryReport FFluidMemoryTracker::GetPeakReport()
+{
+	FScopeLock Lock(&Mutex);
+	return PeakReport;
+}
+
+int64 FFluidMemoryTracker::GetPeakTotal()
+{
+	FScopeLock Lock(&Mutex);
+	return PeakTotal;
+}
+
+void FFluidMemoryTracker::ResetPeaks()
+{
+	FScopeLock Lock(&Mutex);
+	PeakReport = LastReport;
+	PeakTotal = LastReport.GetTotal();
+}
+
+void FFluidMemoryTracker::Dump(FOutputDevice& Ar)
+{
+	const FFluidMemoryReport Current = Capture();
+	const FFluidMemoryReport Peak = GetPeakReport();
+
+	int32 ReporterCount = 0;
+	{
+		FScopeLock Lock(&Mutex);
+		ReporterCount = Reporters.Num();
+	}
+
+	Ar.Logf(TEXT("VoxelFluid memory (%d reporters): %.2f MB, peak %.2f MB"), ReporterCount, ToMB(Current.GetTotal()), ToMB(GetPeakTotal()));
+	for (int32 i = 0; i < (int32)EFluidMemoryCategory::Count; ++i)
+	{
+		Ar.Logf(TEXT("  %-18s %10.2f MB  (peak %10.2f MB)"), LexToString((EFluidMemoryCategory)i), ToMB(Current.Bytes[i]), ToMB(Peak.Bytes[i]));
+	}
+}
+
+const FFluidAllocationSite* FFluidAllocationReport::FindSite(const TCHAR* Site) const
+{
+	return Sites.FindByPredicate([Site](const FFluidAllocationSite& Entry) { return FCString::Strcmp(Entry.Site, Site) == 0; });
+}
+
+FString FFluidAllocationReport::ToString() const
+{
+	FString Result = FString::Printf(TEXT("%lld allocs, %.1f KB"), Allocs, Bytes / 1024.0);
+	for (const FFluidAllocationSite& Entry : Sites)
+	{
+		Result += FString::Printf(TEXT(", %s %lld (%.1f KB)"), Entry.Site, Entry.Allocs, Entry.Bytes / 1024.0);
+	}
+	return Result;
+}
+
+bool FFluidAllocationTracker::IsAvailable()
+{
+#if VOXELFLUID_DIAGNOSTICS
+	return GFluidTrackingMalloc && GMalloc == GFluidTrackingMalloc;
+#else
+	return false;
+#endif
+}
+
+void FFluidAllocationTracker::SetEnabled(bool bInEnabled)
+{
+	if (bInEnabled && !IsAvailable())
+	{
+#if VOXELFLUID_DIAGNOSTICS
+		UE_LOG(LogVoxelFluidSim, Warning, TEXT("Allocation tracking needs -FluidAllocTracking on the command line"));
+#else
+		UE_LOG(LogVoxelFluidSim, Warning, TEXT("Allocation tracking needs VOXELFLUID_DIAGNOSTICS"));
+#endif
+		return;
+	}
+	bEnabled.store(bInEnabled, std::memory_order_relaxed);
+}
+
+void FFluidAllocationTracker::Reset()
+{
+	FScopeLock Lock(&Mutex);
+
+	// Site names stay registered; another thread may be charging one right now
+	for (int32 i = 0; i < MaxSites; ++i)
+	{
+		Slots[i].Allocs.store(0, std::memory_order_relaxed);
+		Slots[i].Bytes.store(0, std::memory_order_relaxed);
+		StepBaseAllocs[i] = 0;
+		StepBaseBytes[i] = 0;
+	}
+	LastStep = FFluidAllocationReport();
+	MaxStepAllocs = 0;
+	StepCount = 0;
+}
+
+int32 FFluidAllocationTracker::FindOrAddSlot(const TCHAR* Site)
+{
+	for (int32 i = 0; i < MaxSites; ++i)
+	{
+		const TCHAR* Existing = Slots[i].Site.load(std::memory_order_acquire);
+		if (!Existing)
+		{
+			if (Slots[i].Site.compare_exchange_strong(Existing, Site, std::memory_order_acq_rel))
+			{
+				return i;
+			}
+		}
+
+		// The same literal can have a different address in each translation unit
+		if (Existing == Site || FCString::Strcmp(Existing, Site) == 0)
+		{
+			return i;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FFluidAllocationTracker::NoteAllocation(SIZE_T Size)
+{
+	const int32 SlotIndex = GCurrentAllocSlot;
+	if (SlotIndex == INDEX_NONE || !IsEnabled())
+	{
+		return;
+	}
+
+	Slots[SlotIndex].Allocs.fetch_add(1, std::memory_order_relaxed);
+	Slots[SlotIndex].Bytes.fetch_add((int64)Size, std::memory_order_relaxed);
+}
+
+FFluidAllocationReport FFluidAllocationTracker::BuildReport(const int64* BaseAllocs, const int64* BaseBytes)
+{
+	// Reports are built outside any scope, so their own allocations are not counted
+	FFluidAllocationReport Report;
+	for (int32 i = 0; i < MaxSites; ++i)
+	{
+		const TCHAR* Site = Slots[i].Site.load(std::memory_order_acquire);
+		if (!Site)
+		{
+			break;
+		}
+
+		FFluidAllocationSite Entry;
+		Entry.Site = Site;
+		Entry.Allocs = Slots[i].Allocs.load(std::memory_order_relaxed) - (BaseAllocs ? BaseAllocs[i] : 0);
+		Entry.Bytes = Slots[i].Bytes.load(std::memory_order_relaxed) - (BaseBytes ? BaseBytes[i] : 0);
+		if (Entry.Allocs > 0)
+		{
+			Report.Allocs += Entry.Allocs;
+			Report.Bytes += Entry.Bytes;
+			Report.Sites.Add(Entry);
+		}
+	}
+
+	Report.Sites.Sort([](const FFluidAllocationSite& A, const FFluidAllocationSite& B) { return A.Allocs > B.Allocs; });
+	return Report;
+}
+
+void FFluidAllocationTracker::BeginStep()
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	for (int32 i = 0; i < MaxSites; ++i)
+	{
+		StepBaseAllocs[i] = Slots[i].Allocs.load(std::memory_order_relaxed);
+		StepBaseBytes[i] = Slots[i].Bytes.load(std::memory_order_relaxed);
+	}
+}
+
+FFluidAllocationReport FFluidAllocationTracker::EndStep()
+{
+	if (!IsEnabled())
+	{
+		return FFluidAllocationReport();
+	}
+
+	FScopeLock Lock(&Mutex);
+	LastStep = BuildReport(StepBaseAllocs, StepBaseBytes);
+	MaxStepAllocs = FMath::Max(MaxStepAllocs, LastStep.Allocs);
+	++StepCount;
+	return LastStep;
+}
+
+FFluidAllocationReport FFluidAllocationTracker::GetLastStep()
+{
+	FScopeLock Lock(&Mutex);
+	return LastStep;
+}
+
+FFluidAllocationReport FFluidAllocationTracker::GetTotals()
+{
+	FScopeLock Lock(&Mutex);
+	return BuildReport(nullptr, nullptr);
+}
+
+int64 FFluidAllocationTracker::GetMaxStepAllocs()
+{
+	FScopeLock Lock(&Mutex);
+	return MaxStepAllocs;
+}
+
+int64 FFluidAllocationTracker::GetStepCount()
+{
+	FScopeLock Lock(&Mutex);
+	return StepCount;
+}
+
+FFluidAllocationTracker::FScope::FScope(const TCHAR* InSite)
+{
+	if (IsEnabled())
+	{
+		PreviousSlot = GCurrentAllocSlot;
+		GCurrentAllocSlot = FindOrAddSlot(InSite);
+		bActive = true;
+	}
+}
+
+FFluidAllocationTracker::FScope::~FScope()
+{
+	if (bActive)
+	{
+		GCurrentAllocSlot = PreviousSlot;
+	}
+}
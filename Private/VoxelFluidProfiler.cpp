@@ -0,0 +1,698 @@
+#include "VoxelFluidProfiler.h"
+#include "VoxelFluidDebug.h"
+#include "CellularAutomata/FluidChunkManager.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDeviceRedirector.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectIterator.h"
+
+// Innermost open scope on this thread, so nested scopes can report exclusive time
+static thread_local FFluidFrameProfiler::FScopedPhase* GCurrentFluidPhaseScope = nullptr;
+
+static void ForEachChunkProfiler(TFunctionRef<void(FFluidChunkProfiler&)> Callback)
+{
+	for (TObjectIterator<UFluidChunkManager> It; It; ++It)
+	{
+		if (!It->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+		{
+			Callback(It->GetChunkProfiler());
+		}
+	}
+}
+
+static FAutoConsoleCommand CmdVoxelFluidChunkProfile(
+	TEXT("voxelfluid.ChunkProfile"),
+	TEXT("Per-chunk fluid profiling. Usage: voxelfluid.ChunkProfile on|off|reset|top [Count] [Metric]|export [Path.csv|Path.json]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FString Action = Args.Num() > 0 ? Args[0].ToLower() : FString(TEXT("top"));
+		int32 ManagerIndex = 0;
+
+		ForEachChunkProfiler([&Args, &Action, &ManagerIndex](FFluidChunkProfiler& Profiler)
+		{
+			const int32 Index = ManagerIndex++;
+			if (Action == TEXT("on") || Action == TEXT("off"))
+			{
+				Profiler.SetEnabled(Action == TEXT("on"));
+			}
+			else if (Action == TEXT("reset"))
+			{
+				Profiler.Reset();
+			}
+			else if (Action == TEXT("export"))
+			{
+				FString Path = Args.Num() > 1 ? Args[1] : FPaths::ProfilingDir() / FString::Printf(TEXT("VoxelFluid/ChunkHeatmap_%s.csv"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+				if (Index > 0)
+				{
+					Path = FPaths::GetPath(Path) / FString::Printf(TEXT("%s_%d.%s"), *FPaths::GetBaseFilename(Path), Index, *FPaths::GetExtension(Path));
+				}
+				UE_LOG(LogVoxelFluidDebug, Log, TEXT("Chunk heatmap (%d chunks) %s %s"), Profiler.GetNumChunks(),
+					Profiler.SaveHeatmap(Path) ? TEXT("written to") : TEXT("failed to write to"), *Path);
+			}
+			else
+			{
+				const int32 Count = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 10;
+				EFluidChunkProfileMetric Metric = EFluidChunkProfileMetric::TotalMs;
+				for (int32 i = 0; Args.Num() > 2 && i < (int32)EFluidChunkProfileMetric::Count; ++i)
+				{
+					if (Args[2].Equals(LexToString((EFluidChunkProfileMetric)i), ESearchCase::IgnoreCase))
+					{
+						Metric = (EFluidChunkProfileMetric)i;
+					}
+				}
+				GLog->Log(Profiler.GetWorstChunksReport(Count, Metric));
+			}
+		});
+	})
+);
+
+const TCHAR* LexToString(EFluidFramePhase Phase)
+{
+	switch (Phase)
+	{
+	case EFluidFramePhase::Simulation: return TEXT("Simulation");
+	case EFluidFramePhase::BorderSync: return TEXT("BorderSync");
+	case EFluidFramePhase::Streaming: return TEXT("Streaming");
+	case EFluidFramePhase::TerrainSampling: return TEXT("TerrainSampling");
+	case EFluidFramePhase::Meshing: return TEXT("Meshing");
+	case EFluidFramePhase::StaticWater: return TEXT("StaticWater");
+	default: return TEXT("Unknown");
+	}
+}
+
+const TCHAR* LexToString(EFluidChunkProfileMetric Metric)
+{
+	switch (Metric)
+	{
+	case EFluidChunkProfileMetric::TotalMs: return TEXT("TotalMs");
+	case EFluidChunkProfileMetric::StepMs: return TEXT("StepMs");
+	case EFluidChunkProfileMetric::MaxStepMs: return TEXT("MaxStepMs");
+	case EFluidChunkProfileMetric::BorderSyncMs: return TEXT("BorderSyncMs");
+	case EFluidChunkProfileMetric::CellsProcessed: return TEXT("CellsProcessed");
+	case EFluidChunkProfileMetric::UnsettledRatio: return TEXT("UnsettledRatio");
+	case EFluidChunkProfileMetric::Remeshes: return TEXT("Remeshes");
+	default: return TEXT("Unknown");
+	}
+}
+
+int32 FFluidTimingHistogram::GetBucket(double Ms)
+{
+	if (Ms <= MinBucketMs)
+	{
+		return 0;
+	}
+
+	const int32 Bucket = FMath::CeilToInt(FMath::Loge(Ms / MinBucketMs) / FMath::Loge(BucketGrowth));
+	return FMath::Clamp(Bucket, 0, NumBuckets - 1);
+}
+
+double FFluidTimingHistogram::GetBucketUpperMs(int32 Bucket)
+{
+	return MinBucketMs * FMath::Pow(BucketGrowth, (double)Bucket);
+}
+
+void FFluidTimingHistogram::AddSample(double Ms)
+{
+	Ms = FMath::Max(Ms, 0.0);
+	++Buckets[GetBucket(Ms)];
+	++Count;
+	SumMs += Ms;
+	MaxMs = FMath::Max(MaxMs, Ms);
+}
+
+void FFluidTimingHistogram::Reset()
+{
+	FMemory::Memzero(Buckets, sizeof(Buckets));
+	Count = 0;
+	SumMs = 0.0;
+	MaxMs = 0.0;
+}
+
+double FFluidTimingHistogram::GetPercentile(double Percentile) const
+{
+	if (Count == 0)
+	{
+		return 0.0;
+	}
+
+	// Nearest rank, as in FFluidBenchmarkPhase
+	const int64 Rank = FMath::Clamp<int64>((int64)FMath::CeilToDouble(FMath::Clamp(Percentile, 0.0, 100.0) / 100.0 * Count), 1, Count);
+	int64 Seen = 0;
+	for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+	{
+		Seen += Buckets[Bucket];
+		if (Seen >= Rank)
+		{
+			return FMath::Min(GetBucketUpperMs(Bucket), MaxMs);
+		}
+	}
+	return MaxMs;
+}
+
+FString FFluidHitchRecord::ToString() const
+{
+	FString Result = FString::Printf(TEXT("Frame %llu: fluid %.2f ms (frame %.2f ms), %s %.2f ms"),
+		Frame, FluidMs, FrameMs, LexToString(Phase), PhaseMs);
+	if (Steps > 0)
+	{
+		Result += FString::Printf(TEXT(" over %d step(s), slowest %.2f ms"), Steps, MaxStepMs);
+	}
+
+	if (Chunks.Num() > 0)
+	{
+		Result += TEXT(" in");
+		for (const FFluidHitchChunk& Chunk : Chunks)
+		{
+			Result += FString::Printf(TEXT(" %s %.2f ms"), *Chunk.Coord.ToString(), Chunk.Ms);
+		}
+	}
+	return Result;
+}
+
+FFluidFrameProfiler* FFluidFrameProfiler::Get(const UFluidChunkManager* ChunkManager)
+{
+	return ChunkManager ? &ChunkManager->GetFrameProfiler() : nullptr;
+}
+
+void FFluidFrameProfiler::SetHitchThresholdMs(double InThresholdMs)
+{
+	FScopeLock Lock(&Mutex);
+	HitchThresholdMs = FMath::Max(InThresholdMs, 0.0);
+}
+
+void FFluidFrameProfiler::Reset()
+{
+	FScopeLock Lock(&Mutex);
+
+	for (int32 i = 0; i < (int32)EFluidFramePhase::Count; ++i)
+	{
+		CurrentPhases[i] = FFramePhase();
+		LastFramePhaseMs[i] = 0.0;
+		PhaseHistograms[i].Reset();
+	}
+	FrameHistogram.Reset();
+	FluidHistogram.Reset();
+	StepHistogram.Reset();
+	CurrentSteps = 0;
+	CurrentMaxStepMs = 0.0;
+
+	Hitches.Reset();
+	NextHitchIndex = 0;
+	TotalHitches = 0;
+	bFrameOpen = false;
+}
+
+void FFluidFrameProfiler::TickFrame()
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	SyncFrame_Locked();
+}
+
+void FFluidFrameProfiler::SyncFrame_Locked()
+{
+	const uint64 Frame = GFrameCounter;
+	if (bFrameOpen && Frame == OpenFrame)
+	{
+		return;
+	}
+
+	if (bFrameOpen)
+	{
+		CloseFrame_Locked();
+	}
+
+	OpenFrame = Frame;
+	bFrameOpen = true;
+}
+
+void FFluidFrameProfiler::CloseFrame_Locked()
+{
+	// Called from the next frame's tick, where the engine delta is the duration of the frame being closed
+	const double FrameMs = FApp::GetDeltaTime() * 1000.0;
+
+	double FluidMs = 0.0;
+	int32 WorstPhase = 0;
+	for (int32 i = 0; i < (int32)EFluidFramePhase::Count; ++i)
+	{
+		const double PhaseMs = CurrentPhases[i].Ms;
+		LastFramePhaseMs[i] = PhaseMs;
+		PhaseHistograms[i].AddSample(PhaseMs);
+		FluidMs += PhaseMs;
+
+		if (PhaseMs > CurrentPhases[WorstPhase].Ms)
+		{
+			WorstPhase = i;
+		}
+	}
+	FrameHistogram.AddSample(FrameMs);
+	FluidHistogram.AddSample(FluidMs);
+
+	if (HitchThresholdMs > 0.0 && FluidMs > HitchThresholdMs)
+	{
+		FFluidHitchRecord Record;
+		Record.Frame = OpenFrame;
+		Record.FrameMs = FrameMs;
+		Record.FluidMs = FluidMs;
+		Record.Phase = (EFluidFramePhase)WorstPhase;
+		Record.PhaseMs = CurrentPhases[WorstPhase].Ms;
+		Record.Steps = CurrentSteps;
+		Record.MaxStepMs = CurrentMaxStepMs;
+		Record.Chunks.Append(CurrentPhases[WorstPhase].Chunks);
+
+		UE_LOG(LogVoxelFluidSim, Warning, TEXT("Fluid hitch: %s"), *Record.ToString());
+
+		if (Hitches.Num() < MaxHitchRecords)
+		{
+			Hitches.Add(MoveTemp(Record));
+		}
+		else
+		{
+			Hitches[NextHitchIndex] = MoveTemp(Record);
+		}
+		NextHitchIndex = (NextHitchIndex + 1) % MaxHitchRecords;
+		++TotalHitches;
+	}
+
+	for (FFramePhase& Phase : CurrentPhases)
+	{
+		Phase.Ms = 0.0;
+		Phase.Chunks.Reset();
+	}
+	CurrentSteps = 0;
+	CurrentMaxStepMs = 0.0;
+}
+
+void FFluidFrameProfiler::AddPhaseTime(EFluidFramePhase Phase, double Ms)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	SyncFrame_Locked();
+	CurrentPhases[(int32)Phase].Ms += Ms;
+}
+
+void FFluidFrameProfiler::RecordStep(double Ms)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	SyncFrame_Locked();
+	StepHistogram.AddSample(Ms);
+	++CurrentSteps;
+	CurrentMaxStepMs = FMath::Max(CurrentMaxStepMs, Ms);
+}
+
+void FFluidFrameProfiler::NoteChunk(EFluidFramePhase Phase, const FFluidChunkCoord& Coord, double Ms)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	SyncFrame_Locked();
+	NoteChunk_Locked(Phase, Coord, Ms);
+}
+
+void FFluidFrameProfiler::NoteChunk_Locked(EFluidFramePhase Phase, const FFluidChunkCoord& Coord, double Ms)
+{
+	TArray<FFluidHitchChunk, TInlineAllocator<MaxChunksPerPhase>>& Chunks = CurrentPhases[(int32)Phase].Chunks;
+
+	// A chunk can be timed several times per frame (e.g. one border sync per neighbour)
+	for (FFluidHitchChunk& Chunk : Chunks)
+	{
+		if (Chunk.Coord == Coord)
+		{
+			Chunk.Ms += Ms;
+			Chunks.Sort([](const FFluidHitchChunk& A, const FFluidHitchChunk& B) { return A.Ms > B.Ms; });
+			return;
+		}
+	}
+
+	if (Chunks.Num() < MaxChunksPerPhase)
+	{
+		Chunks.Add({ Coord, Ms });
+	}
+	else if (Ms > Chunks.Last().Ms)
+	{
+		Chunks.Last() = { Coord, Ms };
+	}
+	else
+	{
+		return;
+	}
+	Chunks.Sort([](const FFluidHitchChunk& A, const FFluidHitchChunk& B) { return A.Ms > B.Ms; });
+}
+
+FFluidTimingHistogram FFluidFrameProfiler::GetPhaseHistogram(EFluidFramePhase Phase) const
+{
+	FScopeLock Lock(&Mutex);
+	return PhaseHistograms[(int32)Phase];
+}
+
+FFluidTimingHistogram FFluidFrameProfiler::GetFrameHistogram() const
+{
+	FScopeLock Lock(&Mutex);
+	return FrameHistogram;
+}
+
+FFluidTimingHistogram FFluidFrameProfiler::GetFluidHistogram() const
+{
+	FScopeLock Lock(&Mutex);
+	return FluidHistogram;
+}
+
+FFluidTimingHistogram FFluidFrameProfiler::GetStepHistogram() const
+{
+	FScopeLock Lock(&Mutex);
+	return StepHistogram;
+}
+
+double FFluidFrameProfiler::GetLastFramePhaseMs(EFluidFramePhase Phase) const
+{
+	FScopeLock Lock(&Mutex);
+	return LastFramePhaseMs[(int32)Phase];
+}
+
+TArray<FFluidHitchRecord> FFluidFrameProfiler::GetHitches() const
+{
+	FScopeLock Lock(&Mutex);
+
+	TArray<FFluidHitchRecord> Result;
+	Result.Reserve(Hitches.Num());
+
+	// Once the ring has wrapped, NextHitchIndex points at the oldest record
+	const int32 Start = Hitches.Num() < MaxHitchRecords ? 0 : NextHitchIndex;
+	for (int32 i = 0; i < Hitches.Num(); ++i)
+	{
+		Result.Add(Hitches[(Start + i) % Hitches.Num()]);
+	}
+	return Result;
+}
+
+int32 FFluidFrameProfiler::GetTotalHitchCount() const
+{
+	FScopeLock Lock(&Mutex);
+	return TotalHitches;
+}
+
+FFluidFrameProfiler::FScopedPhase::FScopedPhase(FFluidFrameProfiler* InProfiler, EFluidFramePhase InPhase)
+	: Phase(InPhase)
+{
+	if (InProfiler && InProfiler->IsEnabled())
+	{
+		Profiler = InProfiler;
+		Parent = GCurrentFluidPhaseScope;
+		GCurrentFluidPhaseScope = this;
+		StartTime = FPlatformTime::Seconds();
+	}
+}
+
+FFluidFrameProfiler::FScopedPhase::FScopedPhase(FFluidFrameProfiler* InProfiler, EFluidFramePhase InPhase, const FFluidChunkCoord& InCoord)
+	: FScopedPhase(InProfiler, InPhase)
+{
+	Coord = InCoord;
+	bHasCoord = true;
+}
+
+FFluidFrameProfiler::FScopedPhase::~FScopedPhase()
+{
+	if (!Profiler)
+	{
+		return;
+	}
+
+	const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	const double ExclusiveMs = FMath::Max(ElapsedMs - ChildMs, 0.0);
+
+	GCurrentFluidPhaseScope = Parent;
+	if (Parent)
+	{
+		Parent->ChildMs += ElapsedMs;
+	}
+
+	FScopeLock Lock(&Profiler->Mutex);
+	Profiler->SyncFrame_Locked();
+	Profiler->CurrentPhases[(int32)Phase].Ms += ExclusiveMs;
+	if (bHasCoord)
+	{
+		Profiler->NoteChunk_Locked(Phase, Coord, ExclusiveMs);
+	}
+}
+
+double FFluidChunkProfile::GetMetric(EFluidChunkProfileMetric Metric) const
+{
+	switch (Metric)
+	{
+	case EFluidChunkProfileMetric::StepMs: return StepMs;
+	case EFluidChunkProfileMetric::MaxStepMs: return MaxStepMs;
+	case EFluidChunkProfileMetric::BorderSyncMs: return BorderSyncMs;
+	case EFluidChunkProfileMetric::CellsProcessed: return (double)CellsProcessed;
+	case EFluidChunkProfileMetric::UnsettledRatio: return 1.0 - GetSettleRatio();
+	case EFluidChunkProfileMetric::Remeshes: return Remeshes;
+	default: return GetTotalMs();
+	}
+}
+
+FFluidChunkProfiler* FFluidChunkProfiler::Get(const UFluidChunkManager* ChunkManager)
+{
+	return ChunkManager ? &ChunkManager->GetChunkProfiler() : nullptr;
+}
+
+void FFluidChunkProfiler::SetEnabled(bool bInEnabled)
+{
+	FScopeLock Lock(&Mutex);
+	if (bInEnabled && !IsEnabled() && Profiles.Num() == 0)
+	{
+		StartTime = FPlatformTime::Seconds();
+	}
+	bEnabled.store(bInEnabled, std::memory_order_relaxed);
+}
+
+void FFluidChunkProfiler::Reset()
+{
+	FScopeLock Lock(&Mutex);
+	Profiles.Reset();
+	StartTime = FPlatformTime::Seconds();
+}
+
+FFluidChunkProfile& FFluidChunkProfiler::FindOrAdd_Locked(const FFluidChunkCoord& Coord)
+{
+	FFluidChunkProfile* Profile = Profiles.Find(Coord);
+	if (!Profile)
+	{
+		Profile = &Profiles.Add(Coord);
+		Profile->Coord = Coord;
+	}
+	return *Profile;
+}
+
+void FFluidChunkProfiler::RecordStep(const FFluidChunkCoord& Coord, double Ms, int32 CellsProcessed, int32 UnsettledCells)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	FFluidChunkProfile& Profile = FindOrAdd_Locked(Coord);
+	++Profile.Steps;
+	Profile.StepMs += Ms;
+	Profile.MaxStepMs = FMath::Max(Profile.MaxStepMs, Ms);
+	Profile.CellsProcessed += CellsProcessed;
+	Profile.UnsettledCells += UnsettledCells;
+}
+
+void FFluidChunkProfiler::RecordBorderSync(const FFluidChunkCoord& Coord, double Ms)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	FFluidChunkProfile& Profile = FindOrAdd_Locked(Coord);
+	++Profile.BorderSyncs;
+	Profile.BorderSyncMs += Ms;
+}
+
+void FFluidChunkProfiler::RecordRemesh(const FFluidChunkCoord& Coord, double Ms)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	FScopeLock Lock(&Mutex);
+	FFluidChunkProfile& Profile = FindOrAdd_Locked(Coord);
+	++Profile.Remeshes;
+	Profile.RemeshMs += Ms;
+}
+
+int32 FFluidChunkProfiler::GetNumChunks() const
+{
+	FScopeLock Lock(&Mutex);
+	return Profiles.Num();
+}
+
+double FFluidChunkProfiler::GetRecordedSeconds() const
+{
+	FScopeLock Lock(&Mutex);
+	return StartTime > 0.0 ? FPlatformTime::Seconds() - StartTime : 0.0;
+}
+
+TArray<FFluidChunkProfile> FFluidChunkProfiler::GetProfiles() const
+{
+	TArray<FFluidChunkProfile> Result;
+	{
+		FScopeLock Lock(&Mutex);
+		Profiles.GenerateValueArray(Result);
+	}
+
+	Result.Sort([](const FFluidChunkProfile& A, const FFluidChunkProfile& B)
+	{
+		if (A.Coord.Z != B.Coord.Z) return A.Coord.Z < B.Coord.Z;
+		if (A.Coord.Y != B.Coord.Y) return A.Coord.Y < B.Coord.Y;
+		return A.Coord.X < B.Coord.X;
+	});
+	return Result;
+}
+
+TArray<FFluidChunkProfile> FFluidChunkProfiler::GetWorstChunks(int32 Count, EFluidChunkProfileMetric Metric) const
+{
+	TArray<FFluidChunkProfile> Result;
+	{
+		FScopeLock Lock(&Mutex);
+		Profiles.GenerateValueArray(Result);
+	}
+
+	Result.Sort([Metric](const FFluidChunkProfile& A, const FFluidChunkProfile& B) { return A.GetMetric(Metric) > B.GetMetric(Metric); });
+	if (Result.Num() > Count)
+	{
+		Result.SetNum(FMath::Max(Count, 0));
+	}
+	return Result;
+}
+
+FString FFluidChunkProfiler::GetWorstChunksReport(int32 Count, EFluidChunkProfileMetric Metric) const
+{
+	const TArray<FFluidChunkProfile> Worst = GetWorstChunks(Count, Metric);
+
+	FString Report = FString::Printf(TEXT("Chunk profile%s: %d chunks over %.1f s, worst %d by %s\n"),
+		IsEnabled() ? TEXT("") : TEXT(" (disabled)"), GetNumChunks(), GetRecordedSeconds(), Worst.Num(), LexToString(Metric));
+	Report += FString::Printf(TEXT("%-14s %6s %9s %8s %8s %6s %9s %10s %6s %7s %9s\n"), TEXT("Chunk"), TEXT("Steps"), TEXT("StepMs"),
+		TEXT("MeanMs"), TEXT("MaxMs"), TEXT("Syncs"), TEXT("SyncMs"), TEXT("Cells"), TEXT("Settle"), TEXT("Remesh"), TEXT("TotalMs"));
+
+	for (const FFluidChunkProfile& Profile : Worst)
+	{
+		Report += FString::Printf(TEXT("%-14s %6d %9.2f %8.3f %8.3f %6d %9.2f %10lld %6.2f %7d %9.2f\n"), *Profile.Coord.ToString(),
+			Profile.Steps, Profile.StepMs, Profile.GetMeanStepMs(), Profile.MaxStepMs, Profile.BorderSyncs, Profile.BorderSyncMs,
+			Profile.CellsProcessed, Profile.GetSettleRatio(), Profile.Remeshes, Profile.GetTotalMs());
+	}
+	return Report;
+}
+
+FString FFluidChunkProfiler::ToCSV() const
+{
+	FString CSV = TEXT("X,Y,Z,Steps,StepMs,MeanStepMs,MaxStepMs,BorderSyncs,BorderSyncMs,CellsProcessed,SettleRatio,Remeshes,RemeshMs,TotalMs\n");
+	for (const FFluidChunkProfile& Profile : GetProfiles())
+	{
+		CSV += FString::Printf(TEXT("%d,%d,%d,%d,%.4f,%.4f,%.4f,%d,%.4f,%lld,%.4f,%d,%.4f,%.4f\n"),
+			Profile.Coord.X, Profile.Coord.Y, Profile.Coord.Z, Profile.Steps, Profile.StepMs, Profile.GetMeanStepMs(), Profile.MaxStepMs,
+			Profile.BorderSyncs, Profile.BorderSyncMs, Profile.CellsProcessed, Profile.GetSettleRatio(), Profile.Remeshes, Profile.RemeshMs,
+			Profile.GetTotalMs());
+	}
+	return CSV;
+}
+
+FString FFluidChunkProfiler::ToJson() const
+{
+	const TArray<FFluidChunkProfile> AllProfiles = GetProfiles();
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("seconds"), GetRecordedSeconds());
+
+	// Coordinate bounds so a viewer can size the heatmap without scanning the rows
+	FIntVector Min(MAX_int32), Max(MIN_int32);
+	TArray<TSharedPtr<FJsonValue>> Chunks;
+	for (const FFluidChunkProfile& Profile : AllProfiles)
+	{
+		const FIntVector Coord(Profile.Coord.X, Profile.Coord.Y, Profile.Coord.Z);
+		Min = FIntVector(FMath::Min(Min.X, Coord.X), FMath::Min(Min.Y, Coord.Y), FMath::Min(Min.Z, Coord.Z));
+		Max = FIntVector(FMath::Max(Max.X, Coord.X), FMath::Max(Max.Y, Coord.Y), FMath::Max(Max.Z, Coord.Z));
+
+		TSharedRef<FJsonObject> Chunk = MakeShared<FJsonObject>();
+		Chunk->SetNumberField(TEXT("x"), Coord.X);
+		Chunk->SetNumberField(TEXT("y"), Coord.Y);
+		Chunk->SetNumberField(TEXT("z"), Coord.Z);
+		Chunk->SetNumberField(TEXT("steps"), Profile.Steps);
+		Chunk->SetNumberField(TEXT("stepMs"), Profile.StepMs);
+		Chunk->SetNumberField(TEXT("meanStepMs"), Profile.GetMeanStepMs());
+		Chunk->SetNumberField(TEXT("maxStepMs"), Profile.MaxStepMs);
+		Chunk->SetNumberField(TEXT("borderSyncs"), Profile.BorderSyncs);
+		Chunk->SetNumberField(TEXT("borderSyncMs"), Profile.BorderSyncMs);
+		Chunk->SetNumberField(TEXT("cellsProcessed"), static_cast<double>(Profile.CellsProcessed));
+		Chunk->SetNumberField(TEXT("settleRatio"), Profile.GetSettleRatio());
+		Chunk->SetNumberField(TEXT("remeshes"), Profile.Remeshes);
+		Chunk->SetNumberField(TEXT("remeshMs"), Profile.RemeshMs);
+		Chunk->SetNumberField(TEXT("totalMs"), Profile.GetTotalMs());
+		Chunks.Add(MakeShared<FJsonValueObject>(Chunk));
+	}
+
+	if (AllProfiles.Num() > 0)
+	{
+		auto MakeCoordArray = [](const FIntVector& Coord)
+		{
+			return TArray<TSharedPtr<FJsonValue>>{ MakeShared<FJsonValueNumber>(Coord.X), MakeShared<FJsonValueNumber>(Coord.Y), MakeShared<FJsonValueNumber>(Coord.Z) };
+		};
+		Root->SetArrayField(TEXT("min"), MakeCoordArray(Min));
+		Root->SetArrayField(TEXT("max"), MakeCoordArray(Max));
+	}
+	Root->SetArrayField(TEXT("chunks"), Chunks);
+
+	FString Output;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Root, Writer);
+	return Output;
+}
+
+bool FFluidChunkProfiler::SaveHeatmap(const FString& FilePath) const
+{
+	const bool bJson = FPaths::GetExtension(FilePath).Equals(TEXT("json"), ESearchCase::IgnoreCase);
+	return FFileHelper::SaveStringToFile(bJson ? ToJson() : ToCSV(), *FilePath);
+}
+
+FFluidChunkProfiler::FScopedRemesh::FScopedRemesh(FFluidChunkProfiler* InProfiler, const FFluidChunkCoord& InCoord)
+{
+	if (InProfiler && InProfiler->IsEnabled())
+	{
+		Profiler = InProfiler;
+		Coord = InCoord;
+		StartTime = FPlatformTime::Seconds();
+	}
+}
+
+FFluidChunkProfiler::FScopedRemesh::~FScopedRemesh()
+{
+	if (Profiler)
+	{
+		Profiler->RecordRemesh(Coord, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+}
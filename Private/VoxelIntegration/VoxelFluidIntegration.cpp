@@ -2,6 +2,7 @@
 #include "VoxelIntegration/VoxelTerrainSampler.h"
 #include "CellularAutomata/FluidChunkManager.h"
 #include "CellularAutomata/FluidChunk.h"
+#include "CellularAutomata/FluidSimulationThread.h"
 #include "CellularAutomata/StaticWaterBody.h"
 #include "Actors/VoxelFluidActor.h"
 #include "DrawDebugHelpers.h"
@@ -9,6 +10,8 @@
 #include "Components/SceneComponent.h"
 #include "VoxelFluidStats.h"
 #include "VoxelFluidDebug.h"
+#include "VoxelFluidProfiler.h"
+#include "VoxelFluidMemory.h"
 #include "VoxelLayersBlueprintLibrary.h"
 
 UVoxelFluidIntegration::UVoxelFluidIntegration()
@@ -28,6 +31,8 @@ UVoxelFluidIntegration::UVoxelFluidIntegration()
 void UVoxelFluidIntegration::BeginPlay()
 {
 	Super::BeginPlay();
+
+	FFluidMemoryTracker::Register(this);
 	
 	// Check if using chunked system or grid system
 	if (bUseChunkedSystem && ChunkManager)
@@ -77,6 +82,26 @@ void UVoxelFluidIntegration::BeginPlay()
 	}
 }
 
+void UVoxelFluidIntegration::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	FFluidMemoryTracker::Unregister(this);
+	Super::EndPlay(EndPlayReason);
+}
+
+void UVoxelFluidIntegration::ReportMemory(FFluidMemoryReport& Report) const
+{
+	SIZE_T Bytes = TerrainHeightCache.GetAllocatedSize();
+	{
+		FScopeLock Lock(&TerrainUpdateMutex);
+		Bytes += CachedVoxelStates.GetAllocatedSize() + PendingTerrainUpdates.GetAllocatedSize();
+	}
+	{
+		FScopeLock Lock(&BatchSamplingMutex);
+		Bytes += BatchSamplePositions.GetAllocatedSize() + BatchChunkCoords.GetAllocatedSize();
+	}
+	Report.Add(EFluidMemoryCategory::TerrainCache, Bytes);
+}
+
 void UVoxelFluidIntegration::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -88,11 +113,18 @@ void UVoxelFluidIntegration::TickComponent(float DeltaTime, ELevelTick TickType,
 		
 		if (LastTerrainRefreshTime >= TerrainRefreshInterval)
 		{
-			if (bTerrainNeedsRefresh || PendingTerrainUpdates.Num() > 0)
+			// Skip while the simulation thread is mid-step; the timer stays expired so the next tick retries
+			FCriticalSection* SimulationLock = ChunkManager ? &ChunkManager->GetSimulationLock() : nullptr;
+			if ((bTerrainNeedsRefresh || PendingTerrainUpdates.Num() > 0) && (!SimulationLock || SimulationLock->TryLock()))
 			{
 				DetectTerrainChangesAndUpdate();
 				bTerrainNeedsRefresh = false;
 				LastTerrainRefreshTime = 0.0f;
+
+				if (SimulationLock)
+				{
+					SimulationLock->Unlock();
+				}
 			}
 		}
 	}
@@ -341,6 +373,8 @@ void UVoxelFluidIntegration::UpdateChunk3DVoxelTerrain(const FFluidChunkCoord& C
 	UFluidChunk* Chunk = ChunkManager->GetChunk(ChunkCoord);
 	if (!Chunk || !TerrainLayer.Layer)
 		return;
+
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(FFluidFrameProfiler::Get(ChunkManager), EFluidFramePhase::TerrainSampling, ChunkCoord);
 	
 	UObject* WorldContext = static_cast<UObject*>(VoxelWorld);
 	const int32 ChunkSize = Chunk->ChunkSize;
@@ -488,6 +522,8 @@ void UVoxelFluidIntegration::UpdateTerrainForChunk(const FVector& ChunkWorldMin,
 	
 	if (!Chunk)
 		return;
+
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(FFluidFrameProfiler::Get(ChunkManager), EFluidFramePhase::TerrainSampling, ChunkCoord);
 	
 	// Sample terrain heights for this chunk and set them directly
 	for (int32 LocalX = 0; LocalX < ChunkSize; ++LocalX)
@@ -620,6 +656,8 @@ void UVoxelFluidIntegration::OnVoxelTerrainModified(const FBox& ModifiedBounds)
 {
 	if (!bUse3DVoxelTerrain)
 		return;
+
+	FFluidSimulationThread::FScopedAccess SimulationAccess(ChunkManager);
 	
 	// Notify chunk manager about voxel edit for edit-triggered activation
 	if (bUseChunkedSystem && ChunkManager)
@@ -666,6 +704,8 @@ void UVoxelFluidIntegration::UpdateChunkCellsInRegion(UFluidChunk* Chunk, const
 {
 	if (!Chunk || !IsVoxelWorldValid() || !TerrainLayer.Layer)
 		return;
+
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(FFluidFrameProfiler::Get(ChunkManager), EFluidFramePhase::TerrainSampling, Chunk->ChunkCoord);
 	
 	UObject* WorldContext = static_cast<UObject*>(VoxelWorld);
 	const int32 ChunkSize = Chunk->ChunkSize;
@@ -793,6 +833,8 @@ void UVoxelFluidIntegration::RefreshTerrainInRadius(const FVector& Center, float
 	
 	if (!bUse3DVoxelTerrain)
 		return;
+
+	FFluidSimulationThread::FScopedAccess SimulationAccess(ChunkManager);
 	
 	// Notify chunk manager about voxel edit for edit-triggered activation
 	if (bUseChunkedSystem && ChunkManager)
@@ -916,6 +958,8 @@ int32 UVoxelFluidIntegration::UpdateChunkCellsInRadius(UFluidChunk* Chunk, const
 {
 	if (!Chunk || !IsVoxelWorldValid())
 		return 0;
+
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(FFluidFrameProfiler::Get(ChunkManager), EFluidFramePhase::TerrainSampling, Chunk->ChunkCoord);
 	
 	const float RadiusSq = Radius * Radius;
 	const int32 ChunkSize = Chunk->ChunkSize;
@@ -1518,6 +1562,8 @@ void UVoxelFluidIntegration::SampleChunkTerrainBatch(const FFluidChunkCoord& Chu
 {
 	if (!ChunkManager)
 		return;
+
+	FFluidFrameProfiler::FScopedPhase ProfilerScope(FFluidFrameProfiler::Get(ChunkManager), EFluidFramePhase::TerrainSampling, ChunkCoord);
 		
 	// Calculate chunk boundaries using chunk coordinate and manager settings
 	const float ChunkWorldSize = ChunkManager->ChunkSize * ChunkManager->CellSize;
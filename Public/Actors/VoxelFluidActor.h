@@ -3,6 +3,9 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "CellularAutomata/FluidChunkManager.h"
+#include "CellularAutomata/FluidSourceRegistry.h"
+#include "CellularAutomata/FluidBulkEdit.h"
+#include "CellularAutomata/FluidSimulationThread.h"
 #include "VoxelFluidActor.generated.h"
 
 class UCAFluidGrid;
@@ -49,15 +52,52 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid")
 	void ResetSimulation();
 
+	// Returns the source ID; adding a source in a cell that already has one updates its flow rate
 	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid", meta = (CallInEditor = "true"))
-	void AddFluidSource(const FVector& WorldPosition, float FlowRate = -1.0f);
+	int32 AddFluidSource(const FVector& WorldPosition, float FlowRate = -1.0f);
 
+	// Removes the source occupying the same simulation cell as WorldPosition
 	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid")
 	void RemoveFluidSource(const FVector& WorldPosition);
 
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid")
+	bool RemoveFluidSourceById(int32 SourceId);
+
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid")
+	bool SetFluidSourceFlowRate(int32 SourceId, float FlowRate);
+
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid")
+	int32 GetFluidSourceCount() const { return SourceRegistry.Num(); }
+
 	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid")
 	void AddFluidAtLocation(const FVector& WorldPosition, float Amount);
 
+	// Scale a scripted amount by the density multiplier and accumulation, as AddFluidAtLocation does
+	float GetAdjustedFluidAmount(float Amount) const { return Amount * FluidDensityMultiplier * (1.0f + FluidAccumulation); }
+
+	// Apply a prepared bulk edit in one pass (see FFluidBulkEdit); values are used as given
+	// Runs immediately, waiting for a threaded step to finish, so the result reflects the applied edit
+	FFluidBulkEditResult ApplyFluidBulkEdit(const FFluidBulkEdit& Edit);
+
+	// Fluid level (0-1) of the cell at a location, and the height of the water column above it
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid")
+	float GetFluidLevelAtLocation(const FVector& WorldPosition) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid")
+	float GetFluidDepthAtLocation(const FVector& WorldPosition) const;
+
+	// Current at a location in world units per second, from the solver's last step
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid")
+	FVector GetFlowVelocityAtLocation(const FVector& WorldPosition) const;
+
+	// Latest state published by the simulation thread; null when the simulation runs on the game thread
+	FFluidSimulationSnapshotPtr GetFluidSnapshot() const;
+
+	// How far simulation time has advanced past the latest step, as a fraction of one step (0-1)
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid")
+	float GetSimulationInterpolationAlpha() const;
+	bool IsSimulationThreaded() const { return SimulationThread.IsValid() && SimulationThread->IsRunning(); }
+
 	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid")
 	void SetVoxelWorld(AActor* InVoxelWorld);
 
@@ -122,6 +162,17 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation")
 	bool bUseFixedTimestep = true;
 
+	// Fixed steps run in one frame at most; simulation time owed beyond that after a hitch is dropped
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation", meta = (ClampMin = "1", ClampMax = "16"))
+	int32 MaxSimulationStepsPerFrame = 4;
+
+	// Step the chunk simulation on its own thread; edits are queued and queries read published snapshots
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation")
+	bool bUseSimulationThread = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation", meta = (EditCondition = "bUseSimulationThread", ClampMin = "10.0", ClampMax = "240.0"))
+	float SimulationThreadRate = 60.0f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chunk Settings", meta = (ClampMin = "16", ClampMax = "128"))
 	int32 ChunkSize = 32; // Reverted to standard size for performance
 	
@@ -244,6 +295,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Performance")
 	void EnableProfiling(bool bEnable);
 
+	// Frames whose fluid work (simulation, streaming, meshing, ...) exceeds this are logged as hitches while profiling
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.0"))
+	float HitchThresholdMs = 8.0f;
+
+	// Per-phase frame time percentiles and the most recent hitches
+	UFUNCTION(BlueprintCallable, Category = "Performance", meta = (CallInEditor = "true"))
+	FString GetHitchReport() const;
+
+	// Per-chunk step, border sync and remesh counters; off by default
+	UFUNCTION(BlueprintCallable, Category = "Performance")
+	void EnableChunkProfiling(bool bEnable);
+
+	// The Count most expensive chunks by total time since chunk profiling was enabled
+	UFUNCTION(BlueprintCallable, Category = "Performance")
+	FString GetWorstChunksReport(int32 Count = 10) const;
+
+	// Writes the per-chunk heatmap as JSON for a .json path, CSV otherwise
+	UFUNCTION(BlueprintCallable, Category = "Performance")
+	bool ExportChunkHeatmap(const FString& FilePath) const;
+
+	// Balance fluid volume against recorded sources and sinks every IntervalSteps steps; 0 turns audits off
+	UFUNCTION(BlueprintCallable, Category = "Debug")
+	void SetMassAuditInterval(int32 IntervalSteps);
+
+	// Last mass audit by category, plus the chunks with the most unexplained drift
+	UFUNCTION(BlueprintCallable, Category = "Debug")
+	FString GetMassAuditReport(int32 WorstChunkCount = 5) const;
+
 	UFUNCTION(BlueprintCallable, Category = "Performance")
 	float GetLastFrameSimulationTime() const { return LastFrameSimulationTime; }
 
@@ -321,13 +400,20 @@ public:
 private:
 	void ManageSimulationWaterAroundPlayer(const FVector& PlayerPos);
 	
-	TMap<FVector, float> FluidSources;
+	FFluidSourceRegistry SourceRegistry;
+	FDelegateHandle SourceRegistryUnloadHandle;
 	
 	void UpdateFluidSources(float DeltaTime);
 	void UpdateDebugVisualization();
 	void DrawDebugChunks();
 	void InitializeChunkSystem();
 	void UpdateChunkSystem(float DeltaTime);
+	void UpdateChunkStreaming(float DeltaTime);
+	void StartSimulationThread();
+	void StopSimulationThread();
+	void SyncSimulationThread(float DeltaTime);
+	void CaptureInterpolationSnapshot();
+	FFluidSimulationSnapshotPtr GetRenderSnapshot() const;
 	TArray<FVector> GetViewerPositions() const;
 
 	FVector SimulationOrigin;
@@ -340,6 +426,14 @@ private:
 	
 	// Simulation timing
 	float SimulationAccumulator = 0.0f;
+	float StatsUpdateTimer = 0.0f;
+
+	// Game-thread captures for render interpolation; the simulation thread publishes its own
+	FFluidSimulationSnapshotPtr InterpolationSnapshot;
+	uint64 GameThreadStepCount = 0;
+
+	TUniquePtr<FFluidSimulationThread> SimulationThread;
+	float PendingStreamingTime = 0.0f; // Frame time not yet handed to chunk streaming while the thread was mid-step
 	
 	// Communication with static water system
 	void NotifyStaticWaterOfSettledFluid(const FVector& Center, float Radius);
@@ -75,6 +75,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Static Water|Lakes", meta = (CallInEditor = "true"))
 	void RemoveStaticWaterRegion(const FVector& Center, float Radius);
 
+	// Fill every natural basin around Center up to its spill height (analysed over several frames)
+	UFUNCTION(BlueprintCallable, Category = "Static Water|Lakes", meta = (CallInEditor = "true"))
+	void CreateBasinLakes(const FVector& Center, float HalfExtent = 50000.0f);
+
 	// ========== Water Queries ==========
 	UFUNCTION(BlueprintCallable, Category = "Static Water|Queries")
 	bool IsPointInStaticWater(const FVector& WorldPosition) const;
@@ -172,6 +176,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ocean Settings", meta = (EditCondition = "bAutoCreateOcean"))
 	float OceanSize = 100000.0f;
 	
+	// Unbounded in XY: tiles and render chunks stream around the viewer instead of the region being recentred
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ocean Settings", meta = (EditCondition = "bAutoCreateOcean"))
+	bool bInfiniteOcean = true;
+	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ocean Settings", meta = (EditCondition = "bAutoCreateOcean"))
 	bool bFollowPlayer = false;
 	
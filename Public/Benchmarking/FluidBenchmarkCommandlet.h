@@ -0,0 +1,46 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "FluidBenchmarkCommandlet.generated.h"
+
+/**
+ * Runs the headless scenario benchmarks and writes CSV and JSON reports to Saved/Benchmarks
+ * Usage: -run=FluidBenchmark [-scenario=all|DamBreak,LakeFill,...] [-steps=600] [-chunks=4] [-chunksize=32] [-seed=1337]
+ *        [-output=Path.csv] [-json=Path.json] [-baseline=Baseline.json] [-threshold=0.05] [-zscore=3.0]
+ *        [-allocbudget=N] [-massaudit=Steps]
+ * With -baseline the run is compared against the stored report and the commandlet exits with 2 on a regression;
+ * peak chunk memory and steady-state allocation counts that grow by more than -threshold count as regressions too.
+ * With -allocbudget allocations are tracked and the commandlet exits with 3 if any scenario's steady-state step
+ * (one in the last quarter of the run that neither edits nor streams) allocates more than N times inside the simulation.
+ * Scenarios that edit every step (LakeFill, RiverChannel, RainOverTerrain, StreamingFlythrough) are reported but not gated;
+ * without VOXELFLUID_DIAGNOSTICS the commandlet exits with 1.
+ * With -massaudit the mass ledger audits every N steps and the report breaks the mass error down by source and sink.
+ *
+ * Kernel microbenchmarks: -run=FluidBenchmark -kernels[=all|GridEqualization,MarchingCubes,...] [-sizes=16,32,64]
+ *        [-fills=0.1,0.5,0.9] [-iterations=20] [-warmup=3] [-seed=1337] [-output=Path.csv]
+ *
+ * Scaling sweep: -run=FluidBenchmark -scaling [-chunks=1,2,4,8] [-threads=1,2,4,8] [-chunksizes=16,32]
+ *        [-fills=Pool:0.25,Pool:0.6,DamBreak] [-steps=120] [-seed=1337] [-budget=8.0] [-knee=0.5] [-output=Path.csv]
+ * Writes one CSV row per run plus a summary of the knees and the MaxActiveChunks that fits -budget ms per step.
+ *
+ * Golden outputs: -run=FluidBenchmark -golden[=Path.json] [-update] [-scenario=all|...] [-steps=240] [-interval=60]
+ * Fingerprints each scenario every -interval steps and compares against the reference file (Tests/FluidGolden.json
+ * under the plugin's base directory by default), exiting with 4 when the solver's behaviour changed. -update rewrites the
+ * reference; run it once on a trusted build and commit the file, since a missing reference fails with 1.
+ */
+UCLASS()
+class VOXELFLUIDSYSTEM_API UFluidBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UFluidBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	int32 RunKernelBenchmarks(const FString& Params);
+	int32 RunScalingBenchmark(const FString& Params);
+	int32 RunGoldenTests(const FString& Params);
+};
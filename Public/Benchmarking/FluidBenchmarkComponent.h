@@ -4,6 +4,31 @@
 #include "Components/ActorComponent.h"
 #include "FluidBenchmarkComponent.generated.h"
 
+// Per-frame time distribution of one phase (or the whole frame) over a benchmark run
+USTRUCT(BlueprintType)
+struct FBenchmarkPhasePercentiles
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly)
+	FString Phase;
+
+	UPROPERTY(BlueprintReadOnly)
+	float P50 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly)
+	float P90 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly)
+	float P99 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly)
+	float P999 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly)
+	float MaxMs = 0.0f;
+};
+
 USTRUCT(BlueprintType)
 struct FBenchmarkResult
 {
@@ -45,9 +70,26 @@ struct FBenchmarkResult
 	UPROPERTY(BlueprintReadOnly)
 	int32 SampleCount = 0;
 
+	// Frame, Fluid (all phases) and then each EFluidFramePhase
+	UPROPERTY(BlueprintReadOnly)
+	TArray<FBenchmarkPhasePercentiles> PhasePercentiles;
+
+	// Frames whose fluid work exceeded the actor's HitchThresholdMs
+	UPROPERTY(BlueprintReadOnly)
+	int32 HitchCount = 0;
+
+	// Most recent hitches with the phase and chunks responsible
+	UPROPERTY(BlueprintReadOnly)
+	TArray<FString> HitchLog;
+
+	const FBenchmarkPhasePercentiles* FindPercentiles(const FString& Phase) const
+	{
+		return PhasePercentiles.FindByPredicate([&Phase](const FBenchmarkPhasePercentiles& Entry) { return Entry.Phase == Phase; });
+	}
+
 	FString ToString() const
 	{
-		return FString::Printf(
+		FString Result = FString::Printf(
 			TEXT("%s:\n")
 			TEXT("  Frame: %.2fms (min: %.2fms, max: %.2fms)\n")
 			TEXT("  Simulation: %.2fms, Mesh: %.2fms, Border: %.2fms\n")
@@ -61,6 +103,17 @@ struct FBenchmarkResult
 			MemoryUsageMB,
 			SampleCount
 		);
+
+		for (const FBenchmarkPhasePercentiles& Entry : PhasePercentiles)
+		{
+			Result += FString::Printf(TEXT("\n  %s: p50 %.2fms, p90 %.2fms, p99 %.2fms, p99.9 %.2fms, max %.2fms"),
+				*Entry.Phase, Entry.P50, Entry.P90, Entry.P99, Entry.P999, Entry.MaxMs);
+		}
+		if (PhasePercentiles.Num() > 0)
+		{
+			Result += FString::Printf(TEXT("\n  Hitches: %d"), HitchCount);
+		}
+		return Result;
 	}
 };
 
@@ -183,6 +236,7 @@ private:
 	float WarmupTimer = 0.0f;
 	int32 CurrentConfigIndex = 0;
 	bool bInWarmup = false;
+	bool bProfilerWasEnabled = false;
 
 	// Helper Functions
 	void ApplyConfiguration(const FBenchmarkConfig& Config);
@@ -192,6 +246,7 @@ private:
 	void RunNextConfiguration();
 	FString GenerateCSVReport() const;
 	float CalculateMemoryUsage() const;
+	class FFluidFrameProfiler* GetFrameProfiler() const;
 
 	// Original settings storage
 	FBenchmarkConfig OriginalConfig;
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Benchmarking/FluidScenarioBenchmark.h"
+
+class FJsonObject;
+
+// Where a benchmark ran; baselines from other machines still load but are flagged in the comparison
+struct VOXELFLUIDSYSTEM_API FFluidBenchmarkMachineInfo
+{
+	FString CPUBrand;
+	int32 LogicalCores = 0;
+	uint32 MemoryGB = 0;
+	FString OSVersion;
+	FString BuildConfiguration;
+	FString EngineVersion;
+	FString Timestamp;
+
+	static FFluidBenchmarkMachineInfo Capture();
+	bool IsSameMachine(const FFluidBenchmarkMachineInfo& Other) const;
+};
+
+struct VOXELFLUIDSYSTEM_API FFluidBenchmarkCompareSettings
+{
+	// Median slowdown that counts as a regression (0.05 = 5%); also the allowed growth of peak memory and allocations
+	double RelativeThreshold = 0.05;
+
+	// Mann-Whitney z-score the shift must exceed; 3.0 is roughly p < 0.0015 one-sided
+	double ZScoreThreshold = 3.0;
+
+	// Phases whose baseline median is below this are too small to judge
+	double MinMedianMs = 0.05;
+
+	// Allowed growth of the relative mass error before it is flagged
+	double MassErrorTolerance = 0.001;
+};
+
+struct VOXELFLUIDSYSTEM_API FFluidBenchmarkDelta
+{
+	FString Scenario;
+	FString Phase;
+	double BaselineMedianMs = 0.0;
+	double CurrentMedianMs = 0.0;
+	double RelativeChange = 0.0;
+	double ZScore = 0.0;
+	bool bRegression = false;
+	bool bImprovement = false;
+};
+
+struct VOXELFLUIDSYSTEM_API FFluidBenchmarkComparison
+{
+	TArray<FFluidBenchmarkDelta> Deltas;
+	TArray<FString> MassErrorRegressions;
+	TArray<FString> MemoryRegressions;
+	TArray<FString> Warnings;
+
+	int32 GetRegressionCount() const;
+	bool HasRegressions() const { return GetRegressionCount() > 0; }
+	FString ToString() const;
+};
+
+/**
+ * Structured results of a scenario benchmark run
+ * Serialized as JSON with the per-step samples of every phase, so a stored report can serve as the
+ * baseline for later runs. Compare flags phases whose median slowed by more than a threshold and whose
+ * samples are shifted significantly (Mann-Whitney U), so ordinary run-to-run noise is not reported.
+ * Peak chunk memory and steady-state allocation counts are deterministic and use the threshold alone.
+ */
+class VOXELFLUIDSYSTEM_API FFluidBenchmarkReport
+{
+public:
+	FFluidBenchmarkMachineInfo Machine;
+	TArray<FFluidScenarioResult> Results;
+
+	FString ToJson() const;
+	bool FromJson(const FString& JsonString);
+
+	bool SaveToFile(const FString& FilePath) const;
+	bool LoadFromFile(const FString& FilePath);
+
+	const FFluidScenarioResult* FindResult(const FString& ScenarioName) const;
+
+	static FFluidBenchmarkComparison Compare(const FFluidBenchmarkReport& Baseline, const FFluidBenchmarkReport& Current,
+		const FFluidBenchmarkCompareSettings& Settings = FFluidBenchmarkCompareSettings());
+
+	// Normal approximation of the Mann-Whitney U statistic; positive when Current tends to be larger
+	static double ComputeMannWhitneyZ(const TArray<double>& Baseline, const TArray<double>& Current);
+
+private:
+	static TSharedRef<FJsonObject> ResultToJson(const FFluidScenarioResult& Result);
+	static bool ResultFromJson(const TSharedPtr<FJsonObject>& Object, FFluidScenarioResult& OutResult);
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CellularAutomata/FluidChunk.h"
+
+class FJsonObject;
+class UFluidChunkManager;
+
+// Compact state of one chunk; SurfaceHeights is SurfaceResolution^2 block means, row-major in X
+struct VOXELFLUIDSYSTEM_API FFluidChunkFingerprint
+{
+	FFluidChunkCoord Coord;
+	double Mass = 0.0;
+	int32 FluidCells = 0;
+	int32 SettledCells = 0;
+	TArray<float> SurfaceHeights; // In cells above the chunk floor, 0 for dry columns
+};
+
+// State of every loaded chunk after a step, chunks ordered by coordinate
+struct VOXELFLUIDSYSTEM_API FFluidStateFingerprint
+{
+	int32 Step = 0;
+	double TotalMass = 0.0;
+	double SettledFraction = 0.0; // Settled cells over cells holding fluid
+	TArray<FFluidChunkFingerprint> Chunks;
+
+	const FFluidChunkFingerprint* FindChunk(const FFluidChunkCoord& Coord) const;
+
+	// SurfaceResolution blocks per chunk side; must divide the chunk size
+	static FFluidStateFingerprint Capture(const UFluidChunkManager& ChunkManager, int32 Step, int32 SurfaceResolution = 8);
+};
+
+struct VOXELFLUIDSYSTEM_API FFluidGoldenTolerances
+{
+	double TotalMassRelative = 0.001;
+	double ChunkMassRelative = 0.01;   // Of the reference chunk mass, at least one cell of fluid
+	double SettledFraction = 0.05;     // Absolute
+	double SurfaceRMSCells = 0.25;     // Over all surface blocks of a fingerprint
+	double SurfaceMaxCells = 2.0;      // Any single block
+};
+
+// Fingerprints of one scenario run; ConfigurationHash ties them to the settings they came from
+struct VOXELFLUIDSYSTEM_API FFluidGoldenScenario
+{
+	FString ScenarioName;
+	FString ConfigurationHash;
+	TArray<FFluidStateFingerprint> Fingerprints;
+};
+
+struct VOXELFLUIDSYSTEM_API FFluidGoldenComparison
+{
+	TArray<FString> Failures;
+	TArray<FString> Notes; // Largest errors per scenario, passing or not
+
+	bool HasFailures() const { return Failures.Num() > 0; }
+	FString ToString() const;
+};
+
+/**
+ * Reference fingerprints of the canonical scenarios, stored as JSON next to the project
+ * The scenarios are deterministic for a seed, so a solver change that keeps behaviour reproduces the stored
+ * fingerprints within the tolerances: total and per-chunk mass, settled fraction and surface height. A file is
+ * only ever written on request; regenerating it is a deliberate acceptance of the new behaviour.
+ */
+class VOXELFLUIDSYSTEM_API FFluidGoldenFile
+{
+public:
+	static constexpr int32 Version = 1;
+
+	TArray<FFluidGoldenScenario> Scenarios;
+
+	const FFluidGoldenScenario* FindScenario(const FString& ScenarioName) const;
+
+	FString ToJson() const;
+	bool FromJson(const FString& JsonString);
+
+	bool SaveToFile(const FString& FilePath) const;
+	bool LoadFromFile(const FString& FilePath);
+
+	// Every scenario of Current against the same scenario in Reference
+	static FFluidGoldenComparison Compare(const FFluidGoldenFile& Reference, const FFluidGoldenFile& Current,
+		const FFluidGoldenTolerances& Tolerances = FFluidGoldenTolerances());
+
+private:
+	static TSharedRef<FJsonObject> FingerprintToJson(const FFluidStateFingerprint& Fingerprint);
+	static bool FingerprintFromJson(const TSharedPtr<FJsonObject>& Object, FFluidStateFingerprint& OutFingerprint);
+	static void CompareScenario(const FFluidGoldenScenario& Reference, const FFluidGoldenScenario& Current,
+		const FFluidGoldenTolerances& Tolerances, FFluidGoldenComparison& OutComparison);
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Benchmarking/FluidScenarioBenchmark.h"
+
+struct FCAFluidCell;
+
+// Solver and meshing kernels that can be timed on their own
+enum class EFluidBenchmarkKernel : uint8
+{
+	GridCombinedPhysics, // UCAFluidGrid::ProcessCombinedPhysics (gravity and compression)
+	GridHorizontalFlow,  // UCAFluidGrid::ProcessHorizontalFlow
+	GridEqualization,    // UCAFluidGrid::ProcessEqualization
+	ChunkGravity,        // UFluidChunk::ApplyGravity
+	ChunkFlowRules,      // UFluidChunk::ApplyFlowRules
+	ChunkPressure,       // UFluidChunk::ApplyPressure
+	ChunkColumnPressure, // UFluidChunk::ApplyColumnPressure
+	ChunkStep,           // UFluidChunk::UpdateSimulation + FinalizeSimulationStep
+	CrossChunkFlow,      // UFluidChunkManager::ProcessCrossChunkFlow over one shared face
+	MarchingCubes,       // FMarchingCubes::GenerateGridMesh
+	MultiResPressure,    // FMultiResolutionSolver::SolvePressureMultiRes
+	Count
+};
+
+struct VOXELFLUIDSYSTEM_API FFluidKernelBenchmarkSettings
+{
+	TArray<int32> Sizes = { 16, 32, 64 };            // Edge length of the cubic input, in cells
+	TArray<float> FillRatios = { 0.1f, 0.5f, 0.9f }; // Fraction of open cells holding fluid
+	int32 WarmupIterations = 3;
+	int32 Iterations = 20;
+	int32 Seed = 1337;
+	float DeltaTime = 1.0f / 60.0f;
+	float CellSize = 100.0f;
+};
+
+struct VOXELFLUIDSYSTEM_API FFluidKernelResult
+{
+	EFluidBenchmarkKernel Kernel = EFluidBenchmarkKernel::GridCombinedPhysics;
+	int32 Size = 0;
+	float FillRatio = 0.0f;
+	int64 Cells = 0;        // Cells the kernel covers per iteration (face cells for CrossChunkFlow)
+	int64 BytesTouched = 0; // Input read once plus output written once; a lower bound on memory traffic
+	FFluidBenchmarkPhase Timing;
+
+	// Per-cell figures use the median iteration, which is less sensitive to scheduling noise than the mean
+	double GetNsPerCell() const;
+	double GetCellsPerSecond() const;
+	double GetGBPerSecond() const;
+
+	FString ToString() const;
+	static FString GetCSVHeader();
+	FString ToCSVRow() const;
+};
+
+/**
+ * Times single simulation and meshing kernels on synthetic inputs, with no world, actor or rendering
+ * Inputs are cubes of cells with a seeded rough floor and fluid in a given fraction of the open cells.
+ * Every iteration restores the same input before the timed call, so iterations do identical work and
+ * results only depend on size, fill ratio and seed. Settling is disabled to measure the full kernel.
+ */
+class VOXELFLUIDSYSTEM_API FFluidKernelBenchmark
+{
+public:
+	explicit FFluidKernelBenchmark(const FFluidKernelBenchmarkSettings& InSettings);
+
+	// Every kernel at every size and fill ratio in the settings
+	TArray<FFluidKernelResult> Run(const TArray<EFluidBenchmarkKernel>& Kernels) const;
+	FFluidKernelResult RunKernel(EFluidBenchmarkKernel Kernel, int32 Size, float FillRatio) const;
+
+	static const TCHAR* GetKernelName(EFluidBenchmarkKernel Kernel);
+	static bool ParseKernelName(const FString& Name, EFluidBenchmarkKernel& OutKernel);
+	static TArray<EFluidBenchmarkKernel> GetAllKernels();
+
+private:
+	void BuildInput(int32 Size, float FillRatio, TArray<FCAFluidCell>& OutCells) const;
+	void Measure(FFluidKernelResult& Result, TFunctionRef<void()> Setup, TFunctionRef<void()> Kernel) const;
+
+	void RunGridKernel(FFluidKernelResult& Result, const TArray<FCAFluidCell>& Input) const;
+	void RunChunkKernel(FFluidKernelResult& Result, const TArray<FCAFluidCell>& Input) const;
+	void RunCrossChunkFlow(FFluidKernelResult& Result, const TArray<FCAFluidCell>& Input) const;
+	void RunMarchingCubes(FFluidKernelResult& Result, const TArray<FCAFluidCell>& Input) const;
+
+	FFluidKernelBenchmarkSettings Settings;
+};
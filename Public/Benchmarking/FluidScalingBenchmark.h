@@ -0,0 +1,101 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Benchmarking/FluidScenarioBenchmark.h"
+
+// Scenario that sets the fluid load of a sweep; FillFraction only applies to Pool
+struct VOXELFLUIDSYSTEM_API FFluidScalingFill
+{
+	EFluidBenchmarkScenario Scenario = EFluidBenchmarkScenario::Pool;
+	float FillFraction = 0.5f;
+
+	FString GetName() const;
+
+	// "Pool:0.25", "Pool" or any scenario name
+	static bool Parse(const FString& Text, FFluidScalingFill& OutFill);
+};
+
+struct VOXELFLUIDSYSTEM_API FFluidScalingSettings
+{
+	TArray<int32> ChunksPerSide = { 1, 2, 4, 8 }; // One layer of chunks, so ChunksPerSide^2 active chunks
+	TArray<int32> ThreadCounts = { 1, 2, 4, 8 };
+	TArray<int32> ChunkSizes = { 16, 32 };
+	TArray<FFluidScalingFill> Fills;              // Empty means Pool at 0.25 and 0.6
+	int32 StepCount = 120;
+	int32 Seed = 1337;
+	float CellSize = 100.0f;
+
+	// Parallel efficiency below which another thread is not worth its core
+	float EfficiencyKnee = 0.5f;
+
+	// Simulation time per step that MaxActiveChunks is sized against
+	double StepBudgetMs = 8.0;
+};
+
+// One run of the sweep; per-step figures are medians over the run's steps
+struct VOXELFLUIDSYSTEM_API FFluidScalingPoint
+{
+	FFluidScalingFill Fill;
+	int32 ChunkSize = 0;
+	int32 ChunksPerSide = 0;
+	int32 Threads = 0;
+	double MeanChunksSimulated = 0.0;
+
+	double GatherMs = 0.0;
+	double ChunkUpdateMs = 0.0;
+	double BorderSyncMs = 0.0;
+	double FinalizeMs = 0.0;
+
+	// Against the run with the fewest threads at the same fill, chunk size and chunk count
+	double Speedup = 1.0;
+	double Efficiency = 1.0;
+
+	int32 GetChunkCount() const { return ChunksPerSide * ChunksPerSide; }
+	double GetSimulationMs() const { return GatherMs + ChunkUpdateMs + BorderSyncMs + FinalizeMs; }
+	double GetCellsPerSecond() const;
+	double GetChunkStepsPerSecond() const;
+
+	// Gather, border sync and finalize run on one thread under the manager's locks; no thread count shrinks them
+	double GetSerialShare() const;
+
+	FString ToString() const;
+	static FString GetCSVHeader();
+	FString ToCSVRow() const;
+};
+
+struct VOXELFLUIDSYSTEM_API FFluidScalingReport
+{
+	TArray<FFluidScalingPoint> Points;
+
+	// Where scaling stops paying, one line per curve, and the largest chunk count per configuration within the step budget
+	TArray<FString> Knees;
+	TArray<FString> Recommendations;
+
+	FString ToString() const;
+	FString ToCSV() const;
+};
+
+/**
+ * Sweeps chunk counts, worker threads, chunk sizes and fill patterns through the headless scenario benchmark
+ * Each point is one FFluidScenarioBenchmark run with the manager's chunk update limited to the given thread count.
+ * Along threads the report gives speedup and parallel efficiency, and the first thread count whose efficiency
+ * falls below EfficiencyKnee; along chunk counts it finds where border sync outgrows the chunk update and where
+ * the serial phases take over the step. With fewer than three chunks the manager updates serially, and the
+ * task graph's worker count caps how many threads a point can actually use.
+ */
+class VOXELFLUIDSYSTEM_API FFluidScalingBenchmark
+{
+public:
+	explicit FFluidScalingBenchmark(const FFluidScalingSettings& InSettings);
+
+	// OnPoint sees each point as it finishes, before speedups are known; collects garbage between runs
+	FFluidScalingReport Run(TFunction<void(const FFluidScalingPoint&)> OnPoint = nullptr) const;
+
+	// Fills in the speedups, knees and recommendations from measured points
+	void Analyze(FFluidScalingReport& Report) const;
+
+private:
+	FFluidScalingPoint RunPoint(const FFluidScalingFill& Fill, int32 ChunkSize, int32 ChunksPerSide, int32 Threads) const;
+
+	FFluidScalingSettings Settings;
+};
@@ -0,0 +1,263 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/StrongObjectPtr.h"
+#include "CellularAutomata/FluidChunk.h"
+#include "CellularAutomata/FluidMassLedger.h"
+#include "Benchmarking/FluidGoldenState.h"
+#include "FluidScenarioBenchmark.generated.h"
+
+class UFluidChunkManager;
+class FFluidBulkEdit;
+
+UENUM(BlueprintType)
+enum class EFluidBenchmarkScenario : uint8
+{
+	DamBreak UMETA(DisplayName = "Dam Break"),
+	RiverChannel UMETA(DisplayName = "River Channel"),
+	LakeFill UMETA(DisplayName = "Lake Fill"),
+	RainOverTerrain UMETA(DisplayName = "Rain Over Rough Terrain"),
+	StreamingFlythrough UMETA(DisplayName = "Streaming Flythrough"),
+	Pool UMETA(DisplayName = "Pool (Fill Fraction)")
+};
+
+USTRUCT(BlueprintType)
+struct VOXELFLUIDSYSTEM_API FFluidScenarioSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario")
+	EFluidBenchmarkScenario Scenario = EFluidBenchmarkScenario::DamBreak;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario", meta = (ClampMin = "1"))
+	int32 StepCount = 600;
+
+	// Fixed simulation step; wall-clock time never feeds back into the run
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario", meta = (ClampMin = "0.001"))
+	float StepDeltaTime = 1.0f / 60.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario")
+	int32 Seed = 1337;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "World", meta = (ClampMin = "4"))
+	int32 ChunkSize = 32;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "World", meta = (ClampMin = "1.0"))
+	float CellSize = 100.0f;
+
+	// Chunks along X and Y of the simulated area; the flythrough streams a corridor this wide
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "World", meta = (ClampMin = "1"))
+	int32 ChunksPerSide = 4;
+
+	// Flythrough only: viewer speed in chunks per simulated second
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "World", meta = (ClampMin = "0.0"))
+	float FlythroughChunksPerSecond = 2.0f;
+
+	// Pool only: mean depth as a fraction of the open height; the surface starts tilted and sloshes
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "World", meta = (ClampMin = "0.0", ClampMax = "0.66"))
+	float FillFraction = 0.5f;
+
+	// Workers for the parallel chunk update (0 = the manager's default)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario", meta = (ClampMin = "0"))
+	int32 SimulationThreads = 0;
+
+	// Count heap allocations per step through FFluidAllocationTracker; slows every allocation, so timings are not comparable
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario")
+	bool bTrackAllocations = false;
+
+	// Steps between mass ledger audits (0 = off); each audit measures every loaded chunk
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario", meta = (ClampMin = "0"))
+	int32 MassAuditInterval = 0;
+
+	// Steps between state fingerprints (0 = off); the last step is always fingerprinted when on
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Scenario", meta = (ClampMin = "0"))
+	int32 FingerprintInterval = 0;
+};
+
+// Per-step wall time of one phase of a scenario run
+struct VOXELFLUIDSYSTEM_API FFluidBenchmarkPhase
+{
+	FString Name;
+	TArray<double> SamplesMs;
+
+	FFluidBenchmarkPhase() = default;
+	explicit FFluidBenchmarkPhase(const TCHAR* InName) : Name(InName) {}
+
+	double GetTotal() const;
+	double GetMean() const;
+	double GetMin() const;
+	double GetMax() const;
+
+	// Nearest-rank percentile, Percentile in [0, 100]
+	double GetPercentile(double Percentile) const;
+	double GetMedian() const { return GetPercentile(50.0); }
+};
+
+USTRUCT(BlueprintType)
+struct VOXELFLUIDSYSTEM_API FFluidScenarioResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	FString ScenarioName;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 StepCount = 0;
+
+	// Identifies the scenario definition and settings; only runs with equal hashes are comparable
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	FString ConfigurationHash;
+
+	// Phase totals over the whole run, in milliseconds
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double SetupMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double EditMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double StreamingMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double GatherMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double ChunkUpdateMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double BorderSyncMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double FinalizeMs = 0.0;
+
+	// Whole step (edits + streaming + simulation)
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double MeanStepMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double MinStepMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double MaxStepMs = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 PeakLoadedChunks = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 PeakActiveChunks = 0;
+
+	// Chunk steps actually simulated, summed over the run
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int64 ChunkSteps = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	float VolumeAdded = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	float VolumeRemoved = 0.0f;
+
+	// Fluid dropped with chunks that streamed out (flythrough only; persistence is off)
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	float VolumeDiscarded = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	float FinalVolume = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 FinalActiveCells = 0;
+
+	// Cell storage of all loaded chunks at its largest during the run
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	float PeakChunkMemoryMB = 0.0f;
+
+	// Allocations made by the simulation over the last quarter of the steps, once the scenario has settled
+	// (only with bTrackAllocations). Steps that edit or stream chunks allocate by design and are not sampled
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int64 SteadyStateMaxAllocsPerStep = 0;
+
+	// Steady-state steps sampled for the figures above; 0 when the scenario edits or streams every step
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int32 SteadyStateAllocSteps = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	double SteadyStateMeanAllocsPerStep = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	int64 SteadyStateBytesPerStep = 0;
+
+	// Call site with the most steady-state allocations
+	UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+	FString AllocationHotspot;
+
+	// Step, Edit, Streaming, Gather, ChunkUpdate, BorderSync, Finalize
+	TArray<FFluidBenchmarkPhase> Phases;
+
+	double GetSimulationMs() const { return GatherMs + ChunkUpdateMs + BorderSyncMs + FinalizeMs; }
+	const FFluidBenchmarkPhase* FindPhase(const FString& PhaseName) const;
+
+	// Final volume minus everything that was added, removed or discarded, in cells of fluid
+	float GetMassError() const { return FinalVolume - (VolumeAdded - VolumeRemoved - VolumeDiscarded); }
+	float GetRelativeMassError() const { return GetMassError() / FMath::Max(VolumeAdded, 1.0f); }
+
+	// Ledger balance at the last audit (only with MassAuditInterval); Drift is what no recorded flow explains
+	FFluidMassAudit MassAudit;
+	TArray<FFluidChunkMassRecord> WorstDriftChunks;
+
+	// State after every FingerprintInterval steps, for golden-output comparisons
+	TArray<FFluidStateFingerprint> Fingerprints;
+
+	FString ToString() const;
+	static FString GetCSVHeader();
+	FString ToCSVRow() const;
+};
+
+/**
+ * Builds a UFluidChunkManager world from a canonical scenario and steps it a fixed number of times
+ * No actor, world or rendering is involved: terrain is synthetic and seeded, edits are applied as bulk
+ * edits between steps, and every step uses the same delta time, so runs are comparable across machines
+ * and builds. Only the timings vary from run to run.
+ */
+class VOXELFLUIDSYSTEM_API FFluidScenarioBenchmark
+{
+public:
+	explicit FFluidScenarioBenchmark(const FFluidScenarioSettings& InSettings);
+	~FFluidScenarioBenchmark();
+
+	FFluidScenarioResult Run();
+
+	static FFluidScenarioResult RunScenario(const FFluidScenarioSettings& Settings);
+	static FString GetScenarioName(EFluidBenchmarkScenario Scenario);
+	static bool ParseScenarioName(const FString& Name, EFluidBenchmarkScenario& OutScenario);
+	static TArray<EFluidBenchmarkScenario> GetAllScenarios();
+
+	// Bump when a scenario's terrain, edits or stepping change so stale baselines stop matching
+	static constexpr uint32 ScenarioVersion = 1;
+	static FString GetConfigurationHash(const FFluidScenarioSettings& Settings);
+
+	// Terrain surface height at a world XY position for this scenario and seed
+	float GetTerrainHeight(float WorldX, float WorldY) const;
+
+	UFluidChunkManager* GetChunkManager() const { return ChunkManager.Get(); }
+
+private:
+	void SetupWorld();
+	void ApplyInitialFluid(FFluidBulkEdit& Edit);
+	void ApplyStepEdits(int32 StepIndex, FFluidBulkEdit& Edit);
+	void OnChunkLoaded(const FFluidChunkCoord& Coord);
+
+	float GetAreaSize() const { return Settings.ChunksPerSide * GetChunkWorldSize(); }
+	float GetChunkWorldSize() const { return Settings.ChunkSize * Settings.CellSize; }
+	float GetValueNoise(float X, float Y, float Scale) const;
+	float GetRiverCenterY(float WorldX) const;
+	FVector GetViewerPosition(int32 StepIndex) const;
+	float GetLoadedVolume() const;
+	float GetLoadedChunkMemoryMB() const;
+
+	FFluidScenarioSettings Settings;
+	TStrongObjectPtr<UFluidChunkManager> ChunkManager;
+	FRandomStream Random;
+	FDelegateHandle ChunkLoadedHandle;
+
+	// Fluid placed by chunk load handlers (flythrough lakes), folded into the result's VolumeAdded
+	float StreamedVolume = 0.0f;
+};
@@ -75,6 +75,9 @@ class VOXELFLUIDSYSTEM_API UCAFluidGrid : public UObject
 {
 	GENERATED_BODY()
 
+	// Times the protected kernels in isolation
+	friend class FFluidKernelBenchmark;
+
 public:
 	UCAFluidGrid();
 
@@ -184,6 +187,9 @@ public:
 
 	TArray<FCAFluidCell> Cells;
 	TArray<FCAFluidCell> NextCells;
+
+	// Off for grids stepped from worker threads (chunk coarse solvers); stats are set from one thread only
+	bool bPublishStats = true;
 	
 	// Settling optimization
 	TArray<bool> CellNeedsUpdate;
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CellularAutomata/FluidChunk.h"
+#include "FluidBulkEdit.generated.h"
+
+class UFluidChunkManager;
+
+USTRUCT(BlueprintType)
+struct VOXELFLUIDSYSTEM_API FFluidBulkEditResult
+{
+	GENERATED_BODY()
+
+	// Fluid in cell units (1.0 = one full cell)
+	UPROPERTY(BlueprintReadOnly, Category = "Fluid Edit")
+	float VolumeAdded = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Fluid Edit")
+	float VolumeRemoved = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Fluid Edit")
+	int32 CellsEdited = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Fluid Edit")
+	int32 ChunksChanged = 0;
+
+	float GetNetVolume() const { return VolumeAdded - VolumeRemoved; }
+};
+
+/**
+ * Collects fluid edits for many cells, grouped per chunk as they are rasterized
+ * Shapes are walked chunk by chunk so each chunk is looked up once per shape, not once per cell.
+ * Apply with UFluidChunkManager::ApplyBulkEdit, which writes all chunks in parallel.
+ */
+class VOXELFLUIDSYSTEM_API FFluidBulkEdit
+{
+public:
+	explicit FFluidBulkEdit(const UFluidChunkManager& ChunkManager);
+
+	void AddPoint(const FVector& WorldPosition, float Value, EFluidEditOp Op = EFluidEditOp::Add);
+	void AddPoints(const TArray<FVector>& WorldPositions, float Value, EFluidEditOp Op = EFluidEditOp::Add);
+	void AddPoints(const TArray<FVector>& WorldPositions, const TArray<float>& Values, EFluidEditOp Op = EFluidEditOp::Add);
+
+	// Cells whose centre lies inside the sphere; with falloff, Value scales down linearly to zero at the radius
+	void AddSphere(const FVector& Center, float Radius, float Value, EFluidEditOp Op = EFluidEditOp::Add, bool bFalloff = false);
+	void AddBox(const FBox& Box, float Value, EFluidEditOp Op = EFluidEditOp::Add);
+
+	// Columns on a regular XY grid (SurfaceHeights indexed X + Y * SizeX), wet from FloorZ up to each column's surface
+	// Partially covered cells receive Value scaled by the wet fraction; Add stacks it on the existing level,
+	// SetLevel replaces the level with it
+	void AddHeightfield(const FVector2D& GridOrigin, float GridSpacing, int32 SizeX, int32 SizeY,
+		const TArray<float>& SurfaceHeights, float FloorZ, float Value, EFluidEditOp Op = EFluidEditOp::Add);
+
+	void Reset() { ChunkEdits.Reset(); CellCount = 0; }
+	bool IsEmpty() const { return CellCount == 0; }
+	int32 GetCellCount() const { return CellCount; }
+	const TMap<FFluidChunkCoord, FFluidChunkCellEdits>& GetChunkEdits() const { return ChunkEdits; }
+
+private:
+	FIntVector WorldToCell(const FVector& WorldPosition) const;
+	FVector GetCellCenter(const FIntVector& Cell) const;
+	static int32 FloorDiv(int32 A, int32 B) { return A >= 0 ? A / B : (A - B + 1) / B; }
+
+	// Visit every cell in [MinCell, MaxCell] one chunk at a time; Weight returns the value multiplier, <= 0 skips the cell
+	void AddCellRange(const FIntVector& MinCell, const FIntVector& MaxCell, float Value, EFluidEditOp Op,
+		TFunctionRef<float(const FIntVector& Cell, const FVector& CellCenter)> Weight);
+
+	void AddCell(FFluidChunkCellEdits& Edits, const FIntVector& LocalCell, float Value, EFluidEditOp Op);
+
+	int32 ChunkSize = 32;
+	float CellSize = 100.0f;
+	FVector WorldOrigin = FVector::ZeroVector;
+
+	TMap<FFluidChunkCoord, FFluidChunkCellEdits> ChunkEdits;
+	int32 CellCount = 0;
+};
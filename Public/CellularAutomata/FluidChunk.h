@@ -4,6 +4,8 @@
 #include "CAFluidGrid.h"
 #include "FluidChunk.generated.h"
 
+struct FFluidMemoryReport;
+
 // Structure to store serialized mesh data for chunk persistence
 USTRUCT()
 struct FChunkMeshData
@@ -102,6 +104,14 @@ struct VOXELFLUIDSYSTEM_API FFluidChunkCoord
 	}
 };
 
+UENUM(BlueprintType)
+enum class EFluidEditOp : uint8
+{
+	Add,
+	Remove,
+	SetLevel
+};
+
 UENUM(BlueprintType)
 enum class EChunkState : uint8
 {
@@ -289,11 +299,146 @@ struct FSparseFluidBlock
 	bool IsEmpty() const { return OccupancyMask == 0; }
 };
 
+// Vertical water span of one XY column, used to seed chunks in bulk from static water
+struct FFluidColumnSpan
+{
+	float SurfaceZ = -FLT_MAX; // World Z of the water surface
+	float FloorZ = -FLT_MAX;   // World Z below which the column holds no water (-FLT_MAX = bottomless)
+
+	bool HasWater() const { return SurfaceZ > -FLT_MAX && SurfaceZ > FloorZ; }
+};
+
+// Run of fluid in one column for the hydrostatic solve: full cells from Bottom up to FullTop, then at most one partial cell
+struct FFluidColumnSegment
+{
+	int32 Column = 0;    // X + Y * ChunkSize
+	int32 Parent = 0;    // Union-find over connected segments
+	int16 Bottom = 0;
+	int16 FullTop = -1;  // Highest full cell, below Bottom if none
+	int16 Ceiling = 0;   // First solid cell or next segment above, ChunkSize at the top
+	float Head = 0.0f;   // Free surface, in cells from the chunk floor
+};
+
+// Cell edits for one chunk, built by FFluidBulkEdit; indices are dense (X + Y * ChunkSize + Z * ChunkSize^2)
+struct FFluidChunkCellEdits
+{
+	TArray<int32> CellIndices;
+	TArray<float> Values;
+	TArray<EFluidEditOp> Ops;
+
+	int32 Num() const { return CellIndices.Num(); }
+};
+
+// Per-step activity summary, refreshed by UpdateSimulation from the cells it already visits
+struct FFluidChunkActivity
+{
+	float TotalVolume = 0.0f;
+	float NetFlux = 0.0f;         // Signed fluid change per second (positive = chunk gaining fluid)
+	float AbsoluteFlux = 0.0f;    // Sum of per-cell |change| per second
+	int32 FluidCellCount = 0;
+	int32 UnsettledCellCount = 0; // Cells whose level moved faster than SettleChangeRate this step
+	int32 CellsProcessed = 0;     // Cells the step visited: every dense cell, or the sparse set
+	float MeanFlowSpeed = 0.0f;   // Volume-weighted mean flow speed (world units per second), set with the flow field
+	bool bValid = false;          // False until the chunk has completed a simulation step
+};
+
+// Where fluid enters or leaves a chunk other than through the solver's own transfers
+enum class EFluidMassCategory : uint8
+{
+	Edit,          // Add, remove and set edits, fluid sources and cleared chunks
+	Fill,          // Column fills from bulk lake and activation seeding
+	StaticWater,   // Static water placed into or sealed out of chunk cells
+	Terrain,       // Fluid removed from cells that are or become solid
+	Evaporation,
+	MinLevelClamp, // Levels below MinFluidLevel dropped to zero
+	Transfer,      // Cross-chunk flow; sums to zero over all chunks
+	Streaming,     // Volume arriving with loaded chunks and leaving with unloaded ones
+	Persistence,   // Volume a chunk came back from the cache with, minus the volume it left with
+	CoarseSolve,   // Net change from a coarse LOD step, which only its level clamping should cause
+	Count
+};
+
+// Signed volume per category, in cells of fluid (positive = into the chunk)
+struct FFluidMassFlows
+{
+	double Volume[(int32)EFluidMassCategory::Count] = {};
+
+	void Add(EFluidMassCategory Category, double InVolume) { Volume[(int32)Category] += InVolume; }
+	double Get(EFluidMassCategory Category) const { return Volume[(int32)Category]; }
+	void Reset() { *this = FFluidMassFlows(); }
+
+	double GetNet() const
+	{
+		double Net = 0.0;
+		for (double Entry : Volume)
+		{
+			Net += Entry;
+		}
+		return Net;
+	}
+
+	FFluidMassFlows& operator+=(const FFluidMassFlows& Other)
+	{
+		for (int32 i = 0; i < (int32)EFluidMassCategory::Count; ++i)
+		{
+			Volume[i] += Other.Volume[i];
+		}
+		return *this;
+	}
+};
+
+// Flow per 4x4x4 brick, accumulated from the transfers the solver already computes
+// During a step Flux holds raw transfers (fluid level x cells, signed by direction); Resolve turns it into rates
+struct VOXELFLUIDSYSTEM_API FFluidFlowField
+{
+	static constexpr int32 BrickSize = FSparseFluidBlock::BLOCK_SIZE;
+
+	int32 BricksPerAxis = 0;
+	TArray<FVector3f> Flux;     // Fluid level moved per second, in cells (1 = one full cell per second)
+	TArray<FVector3f> Velocity; // Flux over the brick's fluid volume, in world units per second
+	float StepDeltaTime = 0.0f;
+	bool bPendingResolve = false;
+
+	bool IsValid() const { return BricksPerAxis > 0; }
+
+	int32 GetBrickIndex(int32 X, int32 Y, int32 Z) const
+	{
+		return X / BrickSize + (Y / BrickSize + (Z / BrickSize) * BricksPerAxis) * BricksPerAxis;
+	}
+
+	// Zero the accumulators for a new step, allocating on first use
+	void BeginStep(int32 ChunkSize, float DeltaTime);
+
+	void Record(int32 X, int32 Y, int32 Z, const FVector3f& Transfer)
+	{
+		if (bPendingResolve)
+		{
+			Flux[GetBrickIndex(X, Y, Z)] += Transfer;
+		}
+	}
+
+	// BrickVolumes: fluid level summed per brick after the step
+	// Returns the volume-weighted mean speed
+	float Resolve(const TArray<float>& BrickVolumes, float CellSize);
+
+	// Trilinear between brick centres; LocalCellPos is in cells from the chunk's minimum corner
+	FVector SampleVelocity(const FVector& LocalCellPos) const;
+	FVector SampleFlux(const FVector& LocalCellPos) const;
+
+	void Reset() { *this = FFluidFlowField(); }
+};
+
 UCLASS(BlueprintType)
 class VOXELFLUIDSYSTEM_API UFluidChunk : public UObject
 {
 	GENERATED_BODY()
 
+	// Times the protected kernels in isolation
+	friend class FFluidKernelBenchmark;
+
+	// Measures chunk volume at each audit
+	friend class FFluidMassLedger;
+
 public:
 	UFluidChunk();
 
@@ -313,7 +458,27 @@ public:
 	bool HasFluid() const;
 	float GetTotalFluidVolume() const;
 
+	// Valid activity for a chunk the manager does not step: its current volume and no flux
+	void SetIdleActivity();
+
 	void AddFluid(int32 LocalX, int32 LocalY, int32 LocalZ, float Amount);
+
+	// Fill whole columns up to their water surface in one pass (ChunkSize * ChunkSize spans, indexed X + Y * ChunkSize)
+	// Returns the fluid volume added; safe to run in parallel across different chunks
+	float FillColumnsFromSpans(const TArray<FFluidColumnSpan>& Spans);
+
+	// Add Rates[i] * DeltaTime to each dense cell index (X + Y * ChunkSize + Z * ChunkSize^2)
+	// Returns the fluid volume added; safe to run in parallel across different chunks
+	float AddFluidToCells(const TArray<int32>& CellIndices, const TArray<float>& Rates, float DeltaTime);
+
+	// Apply a bulk edit batch in order; returns true if any cell changed. Safe to run in parallel across chunks
+	bool ApplyCellEdits(const FFluidChunkCellEdits& Edits, float& OutAdded, float& OutRemoved);
+
+	// Flow from the last simulation step, interpolated between bricks; zero where the chunk has not flowed
+	FVector SampleFlowVelocity(const FVector& WorldPos) const;
+	FVector SampleFlowFlux(const FVector& WorldPos) const;
+	void RecordBorderFlow(int32 CellIndex, const FVector3f& Transfer);
+
 	void RemoveFluid(int32 LocalX, int32 LocalY, int32 LocalZ, float Amount);
 	float GetFluidAt(int32 LocalX, int32 LocalY, int32 LocalZ) const;
 	
@@ -370,6 +535,9 @@ public:
 	int32 GetDenseMemoryUsage() const;
 	float GetCompressionRatio() const;
 
+	// Allocated bytes of every container the chunk owns; the manager reports these for its loaded chunks
+	void ReportMemory(FFluidMemoryReport& Report) const;
+
 public:
 	UPROPERTY(BlueprintReadOnly)
 	FFluidChunkCoord ChunkCoord;
@@ -416,6 +584,13 @@ public:
 	
 	UPROPERTY(BlueprintReadOnly)
 	int32 CurrentLOD = 0;
+
+	// LOD 1 and 2 simulate on a 2x / 4x coarser grid; set by the manager from its streaming config
+	bool bCoarseLODSimulation = true;
+
+	// Solver for the coarse LODs, created and released by SetLODLevel on the game thread
+	UPROPERTY()
+	UCAFluidGrid* CoarseGrid = nullptr;
 	
 	// Mesh persistence data
 	UPROPERTY()
@@ -455,24 +630,43 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Settings", meta = (ClampMin = "0.0", ClampMax = "1.0"))
 	float EvaporationRate = 0.0f; // Amount of fluid to evaporate per second (0 = no evaporation)
 
+	// Level the free surfaces of water bodies connected through full cells each step (U-bends, flooded tunnels)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Settings")
+	bool bUseColumnPressure = true;
+
+	// Fraction of the head difference closed per step
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Settings", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float ColumnPressureRelaxation = 0.5f;
+
+	// Largest surface move per step, in cells
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Settings", meta = (ClampMin = "0.0"))
+	float MaxColumnHeadChange = 1.0f;
+
 	bool bDirty = false;
 	bool bBorderDirty = false;
 	
 	// Activity tracking for optimization
 	bool bFullySettled = false;
 	float TotalFluidActivity = 0.0f;
+	float SettledSkipTimer = 0.0f; // Time since a fully settled chunk last stepped
+	FFluidChunkActivity Activity;
+	FFluidMassFlows MassFlows; // Sources and sinks since FFluidMassLedger last audited this chunk
+	float SettleChangeRate = 0.03f; // Level change per second below which a cell counts as settled, like FluidSettleThreshold
 	float LastActivityLevel = 0.0f;
 	int32 InactiveFrameCount = 0;
 	int32 UpdateFrequency = 1; // 1 = every frame, 2 = every other frame, etc.
 	
 	TSet<FFluidChunkCoord> ActiveNeighbors;
 
+	FFluidFlowField FlowField;
+
 protected:
 	bool IsValidLocalCell(int32 X, int32 Y, int32 Z) const;
 	
 	void ApplyGravity(float DeltaTime);
 	void ApplyFlowRules(float DeltaTime);
 	void ApplyPressure(float DeltaTime);
+	void ApplyColumnPressure();
 	void ApplyEvaporation(float DeltaTime);
 	void UpdateVelocities(float DeltaTime);
 	
@@ -483,6 +677,21 @@ protected:
 	void ApplyPressureEqualization(float DeltaTime);
 	
 	void ProcessBorderFlow(float DeltaTime);
+	void ResolveFlowField();
+
+	// Cells per coarse cell edge at the current LOD, 1 at full resolution
+	int32 GetCoarseFactor() const;
+
+	// Restricts NextCells onto CoarseGrid, steps it and prolongs the change back; false if the chunk can't run coarse
+	bool SimulateCoarse(float DeltaTime);
+	TArray<float> CoarseStartLevels;
+
+	// Scratch for ApplyColumnPressure, kept between steps
+	TArray<FFluidColumnSegment> ColumnSegments;
+	TArray<int32> ColumnSegmentStart; // Prefix sums of segments per column, ChunkSize^2 + 1 entries
+	TArray<int32> BodySegments;
+
+	SIZE_T GetSparseAllocatedSize() const;
 	
 	FChunkBorderData PendingBorderData;
 	FCriticalSection BorderDataMutex;
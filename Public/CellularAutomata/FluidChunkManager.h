@@ -2,9 +2,18 @@
 
 #include "CoreMinimal.h"
 #include "FluidChunk.h"
+#include "FluidMassLedger.h"
+#include "FluidChunkSpatialIndex.h"
+#include "FluidEditActivation.h"
+#include "VoxelFluidProfiler.h"
+#include "VoxelFluidMemory.h"
 #include "Engine/World.h"
 #include "FluidChunkManager.generated.h"
 
+class FFluidBulkEdit;
+struct FConvexVolume;
+struct FFluidBulkEditResult;
+
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnChunkLoaded, const FFluidChunkCoord&);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnChunkUnloaded, const FFluidChunkCoord&);
 
@@ -57,6 +66,10 @@ struct VOXELFLUIDSYSTEM_API FChunkStreamingConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
 	float LOD2Distance = 4000.0f;
 
+	// Simulate LOD 1 and 2 chunks on 2x and 4x coarser grids instead of thinning the rules at full resolution
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
+	bool bCoarseLODSimulation = true;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
 	bool bUseAsyncLoading = true;
 
@@ -73,6 +86,18 @@ struct VOXELFLUIDSYSTEM_API FChunkStreamingConfig
 	float CacheExpirationTime = 300.0f; // 5 minutes
 };
 
+// Wall-clock cost of each phase of the last UpdateSimulation call
+struct FFluidStepTimings
+{
+	double GatherMs = 0.0; // Chunk filtering and cell statistics
+	double ChunkUpdateMs = 0.0;
+	double BorderSyncMs = 0.0;
+	double FinalizeMs = 0.0;
+	int32 ChunksSimulated = 0;
+
+	double GetTotalMs() const { return GatherMs + ChunkUpdateMs + BorderSyncMs + FinalizeMs; }
+};
+
 USTRUCT(BlueprintType)
 struct VOXELFLUIDSYSTEM_API FChunkManagerStats
 {
@@ -107,16 +132,35 @@ struct VOXELFLUIDSYSTEM_API FChunkManagerStats
 
 	UPROPERTY(BlueprintReadOnly)
 	int32 ChunkUnloadQueueSize = 0;
+
+	// Allocated bytes of this manager's chunks, cache and bookkeeping
+	UPROPERTY(BlueprintReadOnly)
+	int64 MemoryBytes = 0;
+
+	// High-water mark of MemoryBytes over the manager's lifetime
+	UPROPERTY(BlueprintReadOnly)
+	int64 PeakMemoryBytes = 0;
+
+	FFluidMemoryReport Memory;
 };
 
 UCLASS(BlueprintType, Blueprintable)
-class VOXELFLUIDSYSTEM_API UFluidChunkManager : public UObject
+class VOXELFLUIDSYSTEM_API UFluidChunkManager : public UObject, public IFluidMemoryReporter
 {
 	GENERATED_BODY()
 
+	// Times the protected kernels in isolation
+	friend class FFluidKernelBenchmark;
+
 public:
 	UFluidChunkManager();
 
+	virtual void BeginDestroy() override;
+
+	// IFluidMemoryReporter
+	virtual void ReportMemory(FFluidMemoryReport& Report) const override;
+	virtual UFluidChunkManager* GetSimulationManager() const override { return const_cast<UFluidChunkManager*>(this); }
+
 	void Initialize(int32 InChunkSize, float InCellSize, const FVector& InWorldOrigin, const FVector& InWorldSize);
 	
 	void SetStaticWaterManager(class UStaticWaterManager* InStaticWaterManager) { StaticWaterManager = InStaticWaterManager; }
@@ -138,19 +182,44 @@ public:
 	bool GetCellFromWorldPosition(const FVector& WorldPos, FFluidChunkCoord& OutChunkCoord, int32& OutLocalX, int32& OutLocalY, int32& OutLocalZ) const;
 	
 	void AddFluidAtWorldPosition(const FVector& WorldPos, float Amount);
+	
+	// Bulk column seeding (static water promoted to simulation)
+	// Prepare loads and activates chunks in the given order; fill then writes the columns in parallel
+	void PrepareChunksForBulkFill(const TArray<FFluidChunkCoord>& Coords);
+	float FillChunkColumnsBulk(const TArray<FFluidChunkCoord>& Coords, const TArray<TArray<FFluidColumnSpan>>& ColumnSpans, TArray<float>* OutChunkVolumes = nullptr);
+	FVector GetChunkWorldPosition(const FFluidChunkCoord& Coord) const;
+
+	// Apply every cell of a bulk edit, one parallel task per chunk; changed chunks are woken once
+	FFluidBulkEditResult ApplyBulkEdit(const FFluidBulkEdit& Edit);
 	void RemoveFluidAtWorldPosition(const FVector& WorldPos, float Amount);
 	float GetFluidAtWorldPosition(const FVector& WorldPos) const;
+
+	// Flow from the last step (world units per second / cells of fluid per second), sampled from the chunk's brick field
+	FVector GetFlowVelocityAtWorldPosition(const FVector& WorldPos) const;
+	FVector GetFlowFluxAtWorldPosition(const FVector& WorldPos) const;
 	
 	void SetTerrainHeightAtWorldPosition(const FVector& WorldPos, float Height);
 	
 	void ClearAllChunks();
 	
 	TArray<UFluidChunk*> GetActiveChunks() const;
-	TArray<UFluidChunk*> GetVisibleChunks() const; // Only chunks that should be rendered
+	TArray<UFluidChunk*> GetLoadedChunks() const;
+	// Active chunks within MaxDistance of ViewLocation and, when given, overlapping ViewFrustum
+	TArray<UFluidChunk*> GetVisibleChunks(const FVector& ViewLocation, float MaxDistance, const FConvexVolume* ViewFrustum = nullptr) const;
 	TArray<UFluidChunk*> GetChunksInRadius(const FVector& Center, float Radius) const;
-	TArray<FFluidChunkCoord> GetChunksInBounds(const FBox& Bounds) const;
+	TArray<UFluidChunk*> GetLoadedChunksInBounds(const FBox& Bounds) const;
+	TArray<FFluidChunkCoord> GetChunksInBounds(const FBox& Bounds) const; // Every chunk coordinate, loaded or not
 	
 	FChunkManagerStats GetStats() const;
+	const FFluidStepTimings& GetLastStepTimings() const { return LastStepTimings; }
+	FFluidFrameProfiler& GetFrameProfiler() const { return FrameProfiler; }
+	FFluidChunkProfiler& GetChunkProfiler() const { return ChunkProfiler; }
+	FFluidMassLedger& GetMassLedger() { return MassLedger; }
+	const FFluidMassLedger& GetMassLedger() const { return MassLedger; }
+
+	// Caps the workers of the parallel chunk update; 0 uses three quarters of the cores, at most 8
+	void SetMaxSimulationThreads(int32 InThreads) { MaxSimulationThreads = FMath::Max(0, InThreads); }
+	int32 GetMaxSimulationThreads() const { return MaxSimulationThreads; }
 	
 	UFUNCTION(BlueprintCallable, Category = "Chunk System")
 	int32 GetLoadedChunkCount() const { return LoadedChunks.Num(); }
@@ -198,6 +267,11 @@ public:
 	void ActivateChunksForEdit(const FVector& EditLocation, float Radius);
 	void CheckForSettledChunks();
 	bool IsChunkEditActivated(const FFluidChunkCoord& Coord) const;
+	// Keep already-active chunks simulating until settled-chunk tracking puts them to sleep
+	void RetainChunksUntilSettled(const TArray<FFluidChunkCoord>& Coords);
+
+	// Held by FFluidSimulationThread for each step; anything else writing chunks while that thread runs takes it too
+	FCriticalSection& GetSimulationLock() { return SimulationLock; }
 
 public:
 	FOnChunkLoaded OnChunkLoadedDelegate;
@@ -229,6 +303,17 @@ public:
 	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Settings", meta = (ClampMin = "0.0", ClampMax = "1.0"))
 	float EvaporationRate = 0.0f;
+
+	// Hydrostatic column solve on every chunk; see UFluidChunk::bUseColumnPressure
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Settings")
+	bool bUseColumnPressure = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Settings", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float ColumnPressureRelaxation = 0.5f;
+
+	// Largest surface move per step, in cells
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid Settings", meta = (ClampMin = "0.0"))
+	float MaxColumnHeadChange = 1.0f;
 	
 	
 	
@@ -262,6 +347,9 @@ protected:
 	
 	UPROPERTY()
 	TMap<FFluidChunkCoord, UFluidChunk*> LoadedChunks;
+
+	// Same keys as LoadedChunks, bucketed by position for radius, box and view queries
+	FFluidChunkSpatialIndex ChunkIndex;
 	
 	TSet<FFluidChunkCoord> ActiveChunkCoords;
 	TSet<FFluidChunkCoord> InactiveChunkCoords;
@@ -315,20 +403,35 @@ protected:
 	bool ShouldUpdateChunk(UFluidChunk* Chunk) const;
 	
 	FChunkManagerStats CachedStats;
+	mutable int64 PeakMemoryBytes = 0;
 	float StatsUpdateTimer = 0.0f;
+	FFluidStepTimings LastStepTimings;
+
+	// Const accessors (meshing, terrain sampling) record into it too
+	mutable FFluidFrameProfiler FrameProfiler;
+	mutable FFluidChunkProfiler ChunkProfiler;
+	FFluidMassLedger MassLedger;
+	int32 MaxSimulationThreads = 0;
 	
 	// Debug timing and tracking
 	float DebugUpdateTimer = 0.0f;
 	TMap<FFluidChunkCoord, float> ChunkLoadTimes;
-	TMap<FFluidChunkCoord, FString> ChunkStateHistory;
+	
+	// Last state transition per chunk; only formatted when the debug text is drawn
+	struct FChunkStateRecord
+	{
+		const TCHAR* Label = nullptr;
+		double Time = 0.0;
+	};
+	TMap<FFluidChunkCoord, FChunkStateRecord> ChunkStateHistory;
 	
 	FCriticalSection ChunkMapMutex;
+	FCriticalSection SimulationLock;
 	
 	bool bIsInitialized = false;
 
-	// Edit-triggered activation tracking
-	TMap<FFluidChunkCoord, float> EditActivatedChunks; // Coord -> Time when activated
-	TMap<FFluidChunkCoord, float> ChunkSettledTimes; // Coord -> Time when chunk became settled
+	// Edit-triggered activation tracking; settle checks come due on its timer wheel
+	FFluidEditActivationTracker EditActivation;
 	float SettledChunkCheckTimer = 0.0f;
 	const float SettledChunkCheckInterval = 0.5f; // Check every 500ms
 };
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CellularAutomata/FluidChunk.h"
+
+/**
+ * Loaded chunk coordinates bucketed into columns of ColumnChunks x ColumnChunks chunks in X and Y
+ * A box query visits the buckets it overlaps, or every occupied bucket when that is fewer, and tests
+ * coordinates as integers, so its cost follows the query area and the result rather than the number
+ * of loaded chunks. Not synchronized; the owner guards it like its chunk map.
+ */
+class VOXELFLUIDSYSTEM_API FFluidChunkSpatialIndex
+{
+public:
+	static constexpr int32 ColumnChunks = 4;
+
+	void Add(const FFluidChunkCoord& Coord);
+	void Remove(const FFluidChunkCoord& Coord);
+	void Reset();
+
+	int32 Num() const { return ChunkCount; }
+	int32 GetBucketCount() const { return Buckets.Num(); }
+
+	// Every indexed coordinate within [Min, Max], both inclusive
+	void QueryRange(const FIntVector& Min, const FIntVector& Max, TArray<FFluidChunkCoord>& OutCoords) const;
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	static FIntPoint GetBucketKey(int32 ChunkX, int32 ChunkY)
+	{
+		return FIntPoint(FMath::FloorToInt((float)ChunkX / ColumnChunks), FMath::FloorToInt((float)ChunkY / ColumnChunks));
+	}
+
+	TMap<FIntPoint, TArray<FFluidChunkCoord>> Buckets;
+	int32 ChunkCount = 0;
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CellularAutomata/FluidChunk.h"
+
+/**
+ * Edit-activated chunks and the edit regions that woke them, for edit-triggered activation
+ * Each tracked chunk sits in one slot of a timer wheel at the time of its next settle check, so a check pass
+ * only visits the chunks that are due, and chunks that unloaded or went to sleep some other way drop out when
+ * their slot comes up. Each edit that did per-chunk work is kept as its box of chunk coordinates, as of the
+ * time it activated them; a later edit inside one of those boxes within a short age needs no per-chunk work,
+ * which keeps constant digging in one place cheap. Covered edits never extend a box's age.
+ * Not synchronized itself. The manager reaches it from the game thread and, through ApplyBulkEdit, from the
+ * simulation thread; while that thread runs, every call is serialized by the manager's SimulationLock.
+ */
+class VOXELFLUIDSYSTEM_API FFluidEditActivationTracker
+{
+public:
+	static constexpr int32 WheelSlots = 64;
+
+	// Width of one wheel slot; checks are never early, and late by at most one slot
+	void SetCheckInterval(double InSeconds);
+	double GetCheckInterval() const { return CheckInterval; }
+
+	void Reset();
+
+	// Starts or refreshes tracking and clears the settled time; the first check is one interval after Time
+	void Activate(const FFluidChunkCoord& Coord, double Time);
+	void Remove(const FFluidChunkCoord& Coord);
+	bool IsActivated(const FFluidChunkCoord& Coord) const { return Chunks.Contains(Coord); }
+	int32 Num() const { return Chunks.Num(); }
+
+	// Negative while the chunk is still moving
+	double GetSettledTime(const FFluidChunkCoord& Coord) const;
+	void SetSettledTime(const FFluidChunkCoord& Coord, double Time);
+
+	// Chunks whose check is due by Time, taken off the wheel; each must be scheduled again or removed
+	void PopDue(double Time, TArray<FFluidChunkCoord>& OutCoords);
+	void Schedule(const FFluidChunkCoord& Coord, double Time);
+
+	// Records an edit over chunk coordinates [Min, Max]; false when a box recorded within MaxAge already covers it
+	bool AddEditRegion(const FIntVector& Min, const FIntVector& Max, double Time, double MaxAge);
+	int32 GetRegionCount() const { return Regions.Num(); }
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FChunkEntry
+	{
+		double SettledTime = -1.0;
+		int64 DueTick = INDEX_NONE; // Slot entries with another tick are stale
+	};
+
+	struct FSlotEntry
+	{
+		FFluidChunkCoord Coord;
+		int64 DueTick = 0;
+	};
+
+	struct FEditRegion
+	{
+		FIntVector Min;
+		FIntVector Max;
+		double Time = 0.0;
+	};
+
+	int64 GetTick(double Time) const { return (int64)FMath::FloorToDouble(Time / CheckInterval); }
+
+	TMap<FFluidChunkCoord, FChunkEntry> Chunks;
+	TArray<FSlotEntry> Slots[WheelSlots];
+	TArray<FEditRegion> Regions;
+	double CheckInterval = 0.5;
+	int64 LastTick = INDEX_NONE; // Last tick PopDue processed
+};
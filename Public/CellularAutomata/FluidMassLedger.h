@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CellularAutomata/FluidChunk.h"
+#include <atomic>
+
+VOXELFLUIDSYSTEM_API const TCHAR* LexToString(EFluidMassCategory Category);
+
+// Running balance of one chunk since it was first audited
+struct VOXELFLUIDSYSTEM_API FFluidChunkMassRecord
+{
+	FFluidChunkCoord Coord;
+	double Volume = 0.0;    // Measured at the last audit
+	double Drift = 0.0;     // Volume the recorded flows don't explain, summed over all audits
+	double LastDrift = 0.0; // Unexplained change since the previous audit
+};
+
+// World-wide balance at one audit; Expected + Drift = Measured
+struct VOXELFLUIDSYSTEM_API FFluidMassAudit
+{
+	int64 Step = 0;
+	int32 Chunks = 0;
+	double MeasuredVolume = 0.0;
+	double ExpectedVolume = 0.0;
+	double Drift = 0.0;          // Since the ledger was reset
+	double DriftSinceLast = 0.0; // Since the previous audit
+	FFluidMassFlows Flows;       // Recorded sources and sinks since the ledger was reset
+
+	double GetRelativeDrift() const { return Drift / FMath::Max(MeasuredVolume, 1.0); }
+	FString ToString() const;
+};
+
+/**
+ * Balances the fluid volume of a chunk manager against every source and sink it knows about
+ * Chunks record edits, fills, static water, terrain removal, evaporation, clamping, coarse LOD steps and
+ * cross-chunk transfers into UFluidChunk::MassFlows as they happen. Every AuditInterval steps the ledger measures each loaded chunk
+ * and charges whatever those flows don't explain to the chunk as drift, which is solver error. Chunks that
+ * stream out are balanced on the way out; with persistence on, the difference between the volume a chunk
+ * left with and the volume it comes back with is charged to Persistence.
+ */
+class VOXELFLUIDSYSTEM_API FFluidMassLedger
+{
+public:
+	// 0 disables audits; chunks keep recording flows, which the next Reset discards
+	void SetAuditInterval(int32 InSteps);
+	int32 GetAuditInterval() const { return AuditInterval.load(std::memory_order_relaxed); }
+	bool IsEnabled() const { return GetAuditInterval() > 0; }
+
+	// Relative drift per audit above which a warning is logged
+	void SetDriftTolerance(double InTolerance) { DriftTolerance = InTolerance; }
+
+	// Rebaselines on the next audit: current volumes become the starting point
+	void Reset();
+
+	// Once per simulation step; audits when the interval has elapsed
+	void OnStep(const TArray<UFluidChunk*>& LoadedChunks);
+	FFluidMassAudit Audit(const TArray<UFluidChunk*>& LoadedChunks);
+
+	// Before the chunk's cells are released; bKeptForReload when the persistence cache may bring it back
+	void RetireChunk(UFluidChunk& Chunk, bool bKeptForReload);
+
+	FFluidMassAudit GetLastAudit() const;
+	TArray<FFluidChunkMassRecord> GetWorstChunks(int32 Count) const; // By |Drift|
+	FString GetReport(int32 WorstChunkCount) const;
+
+private:
+	FFluidChunkMassRecord& AuditChunk_Locked(UFluidChunk& Chunk);
+	void RetireRecord_Locked(const FFluidChunkMassRecord& Record, bool bKeptForReload);
+
+	mutable FCriticalSection Mutex;
+	std::atomic<int32> AuditInterval{ 0 }; // Written under Mutex; atomic so IsEnabled can be asked from any thread
+	int32 StepsSinceAudit = 0;
+	int64 StepCount = 0;
+	double DriftTolerance = 0.001;
+	bool bRebaseline = true;
+
+	TMap<FFluidChunkCoord, FFluidChunkMassRecord> Records;
+	TMap<FFluidChunkCoord, double> RetiredVolumes; // Volume each cached chunk had when it unloaded
+	FFluidMassFlows Flows;
+	double Drift = 0.0;
+	double DriftAtLastAudit = 0.0;
+	FFluidMassAudit LastAudit;
+};
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+#include "CellularAutomata/FluidChunk.h"
+#include "VoxelFluidMemory.h"
+#include <atomic>
+
+class UFluidChunkManager;
+class FRunnableThread;
+class FEvent;
+
+// Fluid levels of one chunk at the end of a simulation step; never modified once published
+struct VOXELFLUIDSYSTEM_API FFluidChunkSnapshot
+{
+	FFluidChunkCoord Coord;
+	FVector WorldPosition = FVector::ZeroVector;
+	int32 ChunkSize = 0;
+	EChunkState State = EChunkState::Unloaded;
+	uint64 CapturedStep = 0;
+	TArray<float> FluidLevels; // Dense, X + Y * ChunkSize + Z * ChunkSize^2
+	TArray<float> PreviousLevels; // Levels before the captured step; empty when the chunk did not step
+	FFluidFlowField Flow;
+
+	float GetFluidAt(int32 X, int32 Y, int32 Z) const
+	{
+		return FluidLevels[X + (Y + Z * ChunkSize) * ChunkSize];
+	}
+
+	// Blend from the previous step (Alpha 0) to the captured one (Alpha 1)
+	float GetInterpolatedFluidAt(int32 X, int32 Y, int32 Z, float Alpha) const
+	{
+		const int32 Index = X + (Y + Z * ChunkSize) * ChunkSize;
+		return PreviousLevels.Num() > 0 ? FMath::Lerp(PreviousLevels[Index], FluidLevels[Index], Alpha) : FluidLevels[Index];
+	}
+};
+
+typedef TSharedPtr<const FFluidChunkSnapshot, ESPMode::ThreadSafe> FFluidChunkSnapshotPtr;
+
+// Published view of every loaded chunk; readable from any thread while the simulation keeps stepping
+class VOXELFLUIDSYSTEM_API FFluidSimulationSnapshot
+{
+public:
+	// Copy the manager's chunks after a step. Chunks that cannot have changed since Previous are shared with it
+	static TSharedRef<FFluidSimulationSnapshot, ESPMode::ThreadSafe> Capture(UFluidChunkManager& Manager, const FFluidSimulationSnapshot* Previous,
+		uint64 StepIndex, double SimulationTime);
+
+	uint64 StepIndex = 0;
+	double SimulationTime = 0.0;
+	FVector WorldOrigin = FVector::ZeroVector;
+	int32 ChunkSize = 32;
+	float CellSize = 100.0f;
+	TMap<FFluidChunkCoord, FFluidChunkSnapshotPtr> Chunks;
+
+	const FFluidChunkSnapshot* FindChunk(const FFluidChunkCoord& Coord) const;
+
+	// Includes chunk snapshots shared with the previous step
+	SIZE_T GetAllocatedSize() const;
+	float GetFluidAtWorldPosition(const FVector& WorldPos) const;
+	FVector GetFlowVelocityAtWorldPosition(const FVector& WorldPos) const;
+
+	// Height of the contiguous fluid column from WorldPos up to its surface, in world units; 0 when the cell is dry
+	float GetFluidDepthAtWorldPosition(const FVector& WorldPos) const;
+
+	// One chunk plus a one-cell skirt from its neighbours ((ChunkSize + 2)^3), laid out for FMarchingCubes::GenerateGridMesh
+	// Alpha below 1 blends each chunk from its previous step toward the captured one
+	bool BuildDensityGrid(const FFluidChunkCoord& Coord, TArray<float>& OutDensity, FIntVector& OutGridSize, FVector& OutGridOrigin, float Alpha = 1.0f) const;
+
+private:
+	FIntVector WorldToGlobalCell(const FVector& WorldPos) const;
+	float GetFluidAtGlobalCell(const FIntVector& Cell, float Alpha = 1.0f) const;
+};
+
+typedef TSharedPtr<const FFluidSimulationSnapshot, ESPMode::ThreadSafe> FFluidSimulationSnapshotPtr;
+
+/**
+ * Runs the chunk simulation on a dedicated worker thread at a fixed rate
+ * The game thread never touches cell data while the thread runs: edits are queued as commands and
+ * executed at the start of the next step, and reads go through the latest published snapshot.
+ * Chunk streaming and other UObject work happen at a per-frame sync point that only proceeds when the
+ * thread is between steps, so the game thread never waits on the simulation.
+ */
+class VOXELFLUIDSYSTEM_API FFluidSimulationThread : public FRunnable, public IFluidMemoryReporter
+{
+public:
+	typedef TUniqueFunction<void(UFluidChunkManager&)> FCommand;
+	typedef TFunction<void(float)> FStepCallback;
+
+	FFluidSimulationThread(UFluidChunkManager* InChunkManager, float InStepRate);
+	virtual ~FFluidSimulationThread() override;
+
+	bool Start();
+	void Shutdown();
+	bool IsRunning() const { return Thread != nullptr; }
+
+	void SetStepRate(float InStepRate);
+	void SetTimeScale(float InTimeScale) { TimeScale.store(InTimeScale); }
+	void SetPaused(bool bInPaused) { bPaused.store(bInPaused); }
+
+	// Steps the thread may run back to back after falling behind; older debt is dropped
+	void SetMaxCatchUpSteps(int32 InMaxSteps) { MaxCatchUpSteps.store(FMath::Max(1, InMaxSteps)); }
+
+	// Progress from the latest published step toward the next one (0-1), for render interpolation
+	float GetInterpolationAlpha() const;
+
+	// Runs on the simulation thread inside each step, before the chunks are simulated (e.g. source emission)
+	void SetPreStepCallback(FStepCallback InCallback) { PreStepCallback = MoveTemp(InCallback); }
+
+	// Queue an edit; RequiredChunks are created and woken on the game thread at the next sync point
+	void EnqueueCommand(const TArray<FFluidChunkCoord>& RequiredChunks, FCommand&& Command);
+
+	// Game thread, once per frame. Returns false (and defers GameThreadWork) while a step is running
+	bool SyncWithGameThread(TFunctionRef<void()> GameThreadWork);
+
+	FFluidSimulationSnapshotPtr GetLatestSnapshot() const;
+
+	uint64 GetStepCount() const { return StepCount.load(); }
+	float GetLastStepTimeMs() const { return LastStepTimeMs.load(); }
+	int32 GetPendingCommandCount() const { return PendingCommands.Num(); }
+
+	// Blocks the simulation thread for the guard's lifetime; for rare game-thread paths that write chunks directly
+	// Taking it waits for a running step to finish, so anything per frame should queue a command instead.
+	// Without a running thread it only takes the manager's simulation lock, so callers take it unconditionally.
+	class VOXELFLUIDSYSTEM_API FScopedAccess
+	{
+	public:
+		explicit FScopedAccess(UFluidChunkManager* InChunkManager);
+		~FScopedAccess();
+
+	private:
+		FCriticalSection* Lock = nullptr;
+	};
+
+	// FRunnable
+	virtual bool Init() override { return true; }
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+	// IFluidMemoryReporter; the latest published snapshot, registered while the thread runs
+	virtual void ReportMemory(FFluidMemoryReport& Report) const override;
+
+private:
+	struct FPendingCommand
+	{
+		TArray<FFluidChunkCoord> RequiredChunks;
+		FCommand Command;
+	};
+
+	void Step(float DeltaTime);
+	void PublishSnapshot();
+
+	TWeakObjectPtr<UFluidChunkManager> ChunkManager;
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+
+	std::atomic<bool> bStopRequested{ false };
+	std::atomic<bool> bPaused{ false };
+	std::atomic<bool> bSyncRequested{ false };
+	std::atomic<float> StepInterval{ 1.0f / 60.0f };
+	std::atomic<float> TimeScale{ 1.0f };
+	std::atomic<uint64> StepCount{ 0 };
+	std::atomic<float> LastStepTimeMs{ 0.0f };
+	std::atomic<int32> MaxCatchUpSteps{ 4 };
+	std::atomic<double> LastPublishTime{ 0.0 };
+
+	// Game thread only until a sync point moves them into CommandQueue
+	TArray<FPendingCommand> PendingCommands;
+	TQueue<FCommand, EQueueMode::Mpsc> CommandQueue;
+
+	FStepCallback PreStepCallback;
+
+	// Simulation thread only
+	double SimulationTime = 0.0;
+	FFluidSimulationSnapshotPtr LastPublished;
+
+	mutable FCriticalSection SnapshotMutex;
+	FFluidSimulationSnapshotPtr LatestSnapshot;
+};
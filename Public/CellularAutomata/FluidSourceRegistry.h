@@ -0,0 +1,85 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeLock.h"
+#include "CellularAutomata/FluidChunk.h"
+
+class UFluidChunkManager;
+
+/**
+ * Continuous fluid emitters (springs, pipes, rain) resolved to chunk cells once
+ * Sources are grouped per chunk with their dense cell indices, so a tick is one pass per chunk
+ * with no coordinate conversion or chunk map lookup per source. Only the chunk pointer is
+ * re-resolved, and only after that chunk streams out.
+ * All public calls are serialized, so sources can be edited while another thread emits.
+ */
+class VOXELFLUIDSYSTEM_API FFluidSourceRegistry
+{
+public:
+	// Returns a stable ID; a source in an already occupied cell updates that source instead
+	int32 AddSource(const FVector& WorldPosition, float FlowRate);
+	bool RemoveSource(int32 SourceId);
+	bool SetFlowRate(int32 SourceId, float FlowRate);
+	bool GetSourcePosition(int32 SourceId, FVector& OutPosition) const;
+
+	// Source occupying the same simulation cell as WorldPosition, or INDEX_NONE
+	int32 FindSourceAtPosition(const FVector& WorldPosition) const;
+
+	void Reset();
+
+	// Resolves against the manager's chunk layout; call again if the manager is replaced or re-initialized
+	void Bind(UFluidChunkManager* InChunkManager);
+
+	// Chunk streamed out: drop the cached pointer, it is resolved again on the next emission
+	void OnChunkUnloaded(const FFluidChunkCoord& ChunkCoord);
+
+	// Create, load and wake every chunk that holds a source (game thread)
+	void PrepareChunks();
+
+	// Emit FlowRate * DeltaTime from every source, one batch per chunk; returns the volume added
+	// Without chunk creation, batches whose chunk is not live yet are skipped until PrepareChunks runs
+	float ApplyEmissions(float DeltaTime, bool bAllowChunkCreation = true);
+
+	int32 Num() const { FScopeLock Lock(&Mutex); return Sources.Num(); }
+	int32 GetChunkBatchCount() const { FScopeLock Lock(&Mutex); return Batches.Num(); }
+	float GetTotalFlowRate() const { FScopeLock Lock(&Mutex); return TotalFlowRate; }
+
+private:
+	struct FSourceEntry
+	{
+		FVector WorldPosition = FVector::ZeroVector;
+		float FlowRate = 0.0f;
+		FFluidChunkCoord ChunkCoord;
+		int32 CellIndex = INDEX_NONE;
+		int32 BatchSlot = INDEX_NONE;
+	};
+
+	// Parallel arrays so the emission pass streams through cell indices and rates only
+	struct FChunkBatch
+	{
+		TWeakObjectPtr<UFluidChunk> Chunk;
+		TArray<int32> CellIndices;
+		TArray<float> FlowRates;
+		TArray<int32> SourceIds;
+	};
+
+	typedef TPair<FFluidChunkCoord, int32> FCellKey; // Chunk and dense cell index
+
+	static FIntVector GetPositionKey(const FVector& WorldPosition) { return FIntVector(FMath::RoundToInt(WorldPosition.X), FMath::RoundToInt(WorldPosition.Y), FMath::RoundToInt(WorldPosition.Z)); }
+	bool ResolveCell(const FVector& WorldPosition, FFluidChunkCoord& OutChunkCoord, int32& OutCellIndex) const;
+	void InsertIntoBatch(int32 SourceId, FSourceEntry& Entry);
+	void RemoveFromBatch(const FSourceEntry& Entry);
+	void RebuildBatches();
+	UFluidChunk* ResolveChunk(const FFluidChunkCoord& ChunkCoord, FChunkBatch& Batch, bool bAllowChunkCreation = true);
+
+	mutable FCriticalSection Mutex;
+
+	TWeakObjectPtr<UFluidChunkManager> ChunkManager;
+	TMap<int32, FSourceEntry> Sources;
+	TMap<FFluidChunkCoord, FChunkBatch> Batches;
+	TMap<FCellKey, int32> SourcesByCell;        // Batched sources; valid while the batches are clean
+	TMap<FIntVector, int32> SourcesByPosition;  // Every source by rounded position, for lookups before a chunk layout is bound
+	int32 NextSourceId = 1;
+	float TotalFlowRate = 0.0f;
+	bool bBatchesDirty = true;
+};
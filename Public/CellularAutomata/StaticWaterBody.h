@@ -175,6 +175,9 @@ public:
 	void CreateDynamicFluidSourcesInRadius(UFluidChunk* Chunk, const FVector& Center, float Radius) const;
 	bool ShouldHaveStaticWaterAt(const FVector& WorldPosition, float& OutWaterLevel) const;
 
+	// Reported by the chunk manager that applies this static water
+	void ReportMemory(struct FFluidMemoryReport& Report) const;
+
 protected:
 	UPROPERTY()
 	TArray<FStaticWaterRegion> StaticWaterRegions;
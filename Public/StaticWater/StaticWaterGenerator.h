@@ -5,6 +5,8 @@
 #include "Engine/World.h"
 #include "RHI.h"
 #include "RenderResource.h"
+#include "StaticWater/WaterBasinAnalyzer.h"
+#include "VoxelFluidMemory.h"
 #include "StaticWaterGenerator.generated.h"
 
 USTRUCT(BlueprintType)
@@ -27,16 +29,32 @@ struct VOXELFLUIDSYSTEM_API FStaticWaterRegionDef
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Static Water")
 	int32 Priority = 0; // Higher priority overrides lower priority
 
+	// Ignore the XY extent of Bounds (infinite ocean); only the Z range is used
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Static Water")
+	bool bUnboundedXY = false;
+
+	// The actor's ocean; there is at most one, found by this flag since region indices shift on removal
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Static Water")
+	bool bIsOcean = false;
+
+	// Exact flooded footprint for basin lakes; null for plain box regions
+	TSharedPtr<const FWaterBasinMask> BasinMask;
+
 	bool ContainsPoint(const FVector& Point) const
 	{
+		if (BasinMask.IsValid())
+		{
+			return Bounds.IsInsideXY(Point) && BasinMask->ContainsPoint(Point);
+		}
+		
 		// For rendering purposes, we want to render water surfaces where chunks are above the water level
 		// The point should be within the XY bounds, and we'll render water if the terrain is below water level
-		return Bounds.IsInsideXY(Point);
+		return bUnboundedXY || Bounds.IsInsideXY(Point);
 	}
 
 	float GetWaterDepthAtPoint(const FVector& Point) const
 	{
-		if (!Bounds.IsInsideXY(Point) || Point.Z > WaterLevel)
+		if (!ContainsPoint(Point) || Point.Z > WaterLevel)
 		{
 			return 0.0f;
 		}
@@ -129,12 +147,38 @@ struct VOXELFLUIDSYSTEM_API FStaticWaterGenerationSettings
 	float UpdateFrequency = 0.1f;
 };
 
+USTRUCT(BlueprintType)
+struct VOXELFLUIDSYSTEM_API FStaticWaterBasinSettings
+{
+	GENERATED_BODY()
+
+	// Heightfield resolution for basin analysis; coarser than tile cells since only spill heights matter
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Basins", meta = (ClampMin = "50", ClampMax = "5000"))
+	float CellSize = 400.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Basins", meta = (ClampMin = "16", ClampMax = "1024"))
+	int32 TileCells = 128;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Basins", meta = (ClampMin = "0"))
+	float MinLakeDepth = 50.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Basins", meta = (ClampMin = "1"))
+	int32 MinLakeCells = 16;
+
+	// Analysis tiles processed per tick (each tile is sampled twice over the whole analysis)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Basins", meta = (ClampMin = "1", ClampMax = "64"))
+	int32 TilesPerFrame = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Basins")
+	int32 LakePriority = 1;
+};
+
 /**
  * Generates static water based on terrain data without simulation dependency
  * Uses GPU compute shaders for parallel terrain sampling and water placement
  */
 UCLASS(BlueprintType, Blueprintable, ClassGroup=(VoxelFluidSystem), meta=(BlueprintSpawnableComponent))
-class VOXELFLUIDSYSTEM_API UStaticWaterGenerator : public UActorComponent
+class VOXELFLUIDSYSTEM_API UStaticWaterGenerator : public UActorComponent, public IFluidMemoryReporter
 {
 	GENERATED_BODY()
 
@@ -145,6 +189,9 @@ public:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	// IFluidMemoryReporter
+	virtual void ReportMemory(FFluidMemoryReport& Report) const override;
+
 	// Configuration
 	UFUNCTION(BlueprintCallable, Category = "Static Water Generation")
 	void SetVoxelWorld(AActor* InVoxelWorld);
@@ -158,9 +205,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Static Water Generation")
 	void RemoveWaterRegion(int32 RegionIndex);
 
+	// Replace a region in place, regenerating only the tiles whose coverage actually changes
+	UFUNCTION(BlueprintCallable, Category = "Static Water Generation")
+	void UpdateWaterRegion(int32 RegionIndex, const FStaticWaterRegionDef& Region);
+
 	UFUNCTION(BlueprintCallable, Category = "Static Water Generation")
 	void ClearAllWaterRegions();
 
+	// Index of the region flagged bIsOcean, or INDEX_NONE
+	UFUNCTION(BlueprintCallable, Category = "Static Water Generation")
+	int32 FindOceanRegion() const;
+
 	// Generation control
 	UFUNCTION(BlueprintCallable, Category = "Static Water Generation")
 	void SetViewerPosition(const FVector& Position);
@@ -175,6 +230,19 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Static Water Generation")
 	void OnTerrainChanged(const FBox& ChangedBounds);
 
+	// Basin lakes: flood natural depressions in the area up to their spill height, spread over ticks
+	UFUNCTION(BlueprintCallable, Category = "Static Water Generation")
+	void GenerateBasinLakes(const FBox& Area);
+
+	UFUNCTION(BlueprintCallable, Category = "Static Water Generation")
+	void ClearBasinLakes();
+
+	UFUNCTION(BlueprintCallable, Category = "Static Water Generation")
+	bool IsBasinAnalysisRunning() const { return BasinAnalyzer.IsValid(); }
+
+	UFUNCTION(BlueprintCallable, Category = "Static Water Generation")
+	float GetBasinAnalysisProgress() const;
+
 	// Query methods
 	UFUNCTION(BlueprintCallable, Category = "Static Water Generation")
 	bool HasStaticWaterAtLocation(const FVector& WorldPosition) const;
@@ -188,10 +256,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Static Water Generation")
 	TArray<FIntVector> GetActiveTileCoords() const;
 
+	// Water column (surface and floor Z) at an XY position; reads region defs only, so it is safe from worker threads
+	bool GetWaterColumnAtLocation(const FVector& WorldPosition, float& OutSurfaceZ, float& OutFloorZ) const;
+
 	// Settings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation Settings")
 	FStaticWaterGenerationSettings GenerationSettings;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation Settings")
+	FStaticWaterBasinSettings BasinSettings;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Water Regions")
 	TArray<FStaticWaterRegionDef> WaterRegions;
 
@@ -215,6 +289,9 @@ protected:
 	void GenerateTileDataGPU(FStaticWaterTile& Tile);
 	void GenerateTileDataCPU(FStaticWaterTile& Tile);
 
+	// Basin analysis
+	void UpdateBasinAnalysis();
+
 	// Terrain sampling
 	bool SampleTerrainHeight(const FVector& WorldPosition, float& OutHeight) const;
 	void SampleTerrainHeightsInBounds(const FBox& Bounds, int32 Resolution, TArray<float>& OutHeights) const;
@@ -227,6 +304,8 @@ protected:
 	void UnloadTile(const FIntVector& TileCoord);
 	bool ShouldLoadTile(const FIntVector& TileCoord) const;
 	bool ShouldUnloadTile(const FIntVector& TileCoord) const;
+	bool IsTileActive(const FIntVector& TileCoord) const;
+	void MarkTilesInRegionForUpdate(const FStaticWaterRegionDef& Region);
 
 	// Water region evaluation
 	bool EvaluateWaterAtPosition(const FVector& Position, float& OutWaterLevel) const;
@@ -262,6 +341,9 @@ private:
 	bool bGPUResourcesInitialized = false;
 	FRenderCommandFence RenderFence;
 
+	// In-flight basin analysis (sampling needs the game thread, so it advances a few tiles per tick)
+	TUniquePtr<FWaterBasinAnalyzer> BasinAnalyzer;
+
 	// Performance tracking
 	int32 TilesGeneratedThisFrame = 0;
 	float LastGenerationTime = 0.0f;
@@ -5,6 +5,7 @@
 #include "Components/StaticMeshComponent.h"
 #include "Engine/StaticMesh.h"
 #include "Materials/MaterialInterface.h"
+#include "VoxelFluidMemory.h"
 #include "StaticWaterRenderer.generated.h"
 
 class UStaticWaterGenerator;
@@ -127,7 +128,7 @@ struct VOXELFLUIDSYSTEM_API FStaticWaterRenderSettings
  * Uses player-centric streaming and LOD for optimal performance
  */
 UCLASS(BlueprintType, Blueprintable, ClassGroup=(VoxelFluidSystem), meta=(BlueprintSpawnableComponent))
-class VOXELFLUIDSYSTEM_API UStaticWaterRenderer : public UActorComponent
+class VOXELFLUIDSYSTEM_API UStaticWaterRenderer : public UActorComponent, public IFluidMemoryReporter
 {
 	GENERATED_BODY()
 
@@ -138,6 +139,9 @@ public:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	// IFluidMemoryReporter
+	virtual void ReportMemory(FFluidMemoryReport& Report) const override;
+
 	// Configuration
 	UFUNCTION(BlueprintCallable, Category = "Static Water Rendering")
 	void SetWaterGenerator(UStaticWaterGenerator* InGenerator);
@@ -171,6 +175,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Static Water Rendering")
 	void RebuildChunksInRadius(const FVector& Center, float Radius);
 
+	// Rebuild only the chunks whose water coverage differs between two region footprints
+	UFUNCTION(BlueprintCallable, Category = "Static Water Rendering")
+	void RebuildChunksForRegionMove(const FBox& OldBounds, const FBox& NewBounds);
+
 	UFUNCTION(BlueprintCallable, Category = "Static Water Rendering")
 	void RegenerateAroundViewer();
 
@@ -234,6 +242,7 @@ protected:
 	void UnloadRenderChunk(const FIntVector& ChunkCoord);
 	bool ShouldLoadRenderChunk(const FIntVector& ChunkCoord) const;
 	bool ShouldUnloadRenderChunk(const FIntVector& ChunkCoord) const;
+	bool IsRenderChunkActive(const FIntVector& ChunkCoord) const;
 
 	// Mesh generation
 	void BuildChunkMesh(FStaticWaterRenderChunk& Chunk);
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Engine/World.h"
+#include "CellularAutomata/FluidChunk.h"
+#include "VoxelFluidMemory.h"
 #include "WaterActivationManager.generated.h"
 
 class UStaticWaterGenerator;
@@ -10,6 +12,40 @@ class UStaticWaterRenderer;
 class UFluidChunkManager;
 class UCAFluidGrid;
 
+USTRUCT(BlueprintType)
+struct VOXELFLUIDSYSTEM_API FWaterRegionMetrics
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Water Activation")
+	float TotalVolume = 0.0f;
+
+	// Signed fluid change per second across the region (near zero once inflow and outflow balance)
+	UPROPERTY(BlueprintReadOnly, Category = "Water Activation")
+	float NetMassFlux = 0.0f;
+
+	// Mean per-cell level change per second
+	UPROPERTY(BlueprintReadOnly, Category = "Water Activation")
+	float AverageCellChange = 0.0f;
+
+	// Volume-weighted mean flow speed from the chunks' flow fields, world units per second
+	UPROPERTY(BlueprintReadOnly, Category = "Water Activation")
+	float AverageFlowSpeed = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Water Activation")
+	float UnsettledFraction = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Water Activation")
+	int32 FluidCellCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Water Activation")
+	int32 ChunkCount = 0;
+
+	// False while any overlapping chunk has not reported a simulation step yet
+	UPROPERTY(BlueprintReadOnly, Category = "Water Activation")
+	bool bComplete = false;
+};
+
 USTRUCT(BlueprintType)
 struct VOXELFLUIDSYSTEM_API FWaterActivationRegion
 {
@@ -34,10 +70,18 @@ struct VOXELFLUIDSYSTEM_API FWaterActivationRegion
 	TArray<FVector> StaticWaterPositions;
 	TArray<float> StaticWaterAmounts;
 
+	// Simulation chunks overlapping the region, cached on activation so metrics cost O(chunks)
+	TArray<FFluidChunkCoord> OverlappingChunks;
+
+	UPROPERTY()
+	FWaterRegionMetrics Metrics;
+
 	void Clear()
 	{
 		StaticWaterPositions.Empty();
 		StaticWaterAmounts.Empty();
+		OverlappingChunks.Empty();
+		Metrics = FWaterRegionMetrics();
 		bIsActive = false;
 		ActivationTime = 0.0f;
 	}
@@ -70,7 +114,16 @@ struct VOXELFLUIDSYSTEM_API FWaterActivationSettings
 	float DeactivationDelay = 60.0f; // Time before converting back to static
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deactivation", meta = (ClampMin = "0.001", ClampMax = "0.1"))
-	float FluidSettleThreshold = 0.01f; // Fluid velocity threshold for settling
+	float FluidSettleThreshold = 0.01f; // Mean per-cell level change per second below which fluid counts as settled
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deactivation", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float MaxUnsettledFraction = 0.02f; // Fraction of cells moving faster than their chunk's SettleChangeRate (per second) tolerated in a settled region
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deactivation", meta = (ClampMin = "0.0", ClampMax = "0.1"))
+	float MaxNetFluxRatio = 0.001f; // |net flux| per second relative to region volume
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deactivation", meta = (ClampMin = "0.0"))
+	float MinRegionVolume = 0.01f; // Regions holding less than this are treated as empty
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Deactivation", meta = (ClampMin = "1", ClampMax = "60"))
 	float SettleCheckInterval = 10.0f; // How often to check if fluid has settled
@@ -82,9 +135,24 @@ struct VOXELFLUIDSYSTEM_API FWaterActivationSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "1", ClampMax = "10"))
 	int32 MaxActivationsPerFrame = 2;
 
+	// How much more expensive it is to evict moving water than the same volume of settled water
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.0", ClampMax = "100.0"))
+	float EvictionActivityWeight = 4.0f;
+
+	// Queue updates an activation waits for a region to finish filling before the oldest region is evicted anyway
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0", ClampMax = "100"))
+	int32 MaxEvictionRetries = 20;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.01", ClampMax = "1.0"))
 	float UpdateFrequency = 0.1f;
 
+	// Static-to-simulation transfer budget, spread across frames
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.1", ClampMax = "16.0"))
+	float TransferBudgetMs = 2.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "1", ClampMax = "64"))
+	int32 MaxChunksPerTransferBatch = 8;
+
 	// Transition settings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Transition")
 	bool bSmoothTransitions = true;
@@ -105,7 +173,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWaterRegionDeactivated, const FV
  * Converts settled fluid back to static water for performance
  */
 UCLASS(BlueprintType, Blueprintable, ClassGroup=(VoxelFluidSystem), meta=(BlueprintSpawnableComponent))
-class VOXELFLUIDSYSTEM_API UWaterActivationManager : public UActorComponent
+class VOXELFLUIDSYSTEM_API UWaterActivationManager : public UActorComponent, public IFluidMemoryReporter
 {
 	GENERATED_BODY()
 
@@ -116,6 +184,9 @@ public:
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	// IFluidMemoryReporter
+	virtual void ReportMemory(FFluidMemoryReport& Report) const override;
+
 	// System references
 	UFUNCTION(BlueprintCallable, Category = "Water Activation")
 	void SetStaticWaterGenerator(UStaticWaterGenerator* InGenerator);
@@ -162,6 +233,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Water Activation")
 	float GetRegionActivationTime(const FVector& Position) const;
 
+	UFUNCTION(BlueprintCallable, Category = "Water Activation")
+	int32 GetPendingTransferChunkCount() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Water Activation")
+	bool GetRegionMetrics(const FVector& Position, FWaterRegionMetrics& OutMetrics) const;
+
 	// Settings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Activation Settings")
 	FWaterActivationSettings ActivationSettings;
@@ -208,14 +285,26 @@ protected:
 	void RemoveActivationRegion(int32 RegionIndex);
 	bool ShouldMergeRegions(const FWaterActivationRegion& RegionA, const FWaterActivationRegion& RegionB) const;
 	void MergeRegions(FWaterActivationRegion& TargetRegion, const FWaterActivationRegion& SourceRegion);
+	float GetEvictionCost(const FWaterActivationRegion& Region) const;
+	int32 FindCheapestRegionToEvict();
+
+	// Spatial index
+	void RebuildRegionIndex();
+	void GetRegionCandidates(const FBox& Bounds, TArray<int32>& OutRegionIndices) const;
+	FIntPoint GetRegionGridCell(const FVector& Position) const;
 
 	// Water system integration
 	void ActivateSimulation(FWaterActivationRegion& Region);
 	void DeactivateSimulation(FWaterActivationRegion& Region);
 	void TransferStaticToSimulation(const FWaterActivationRegion& Region);
 	void TransferSimulationToStatic(FWaterActivationRegion& Region);
+	void ProcessPendingColumnFills();
+	bool BuildColumnSpans(const FFluidChunkCoord& ChunkCoord, TArray<FFluidColumnSpan>& OutSpans) const;
+	void CancelPendingColumnFills(const FWaterActivationRegion& Region);
 	
 	// Fluid state analysis
+	void UpdateRegionMetrics(FWaterActivationRegion& Region) const;
+	bool HasPendingColumnFills(const FWaterActivationRegion& Region) const;
 	bool IsFluidSettled(const FWaterActivationRegion& Region) const;
 	float GetAverageFluidVelocity(const FWaterActivationRegion& Region) const;
 	bool HasFluidInRegion(const FWaterActivationRegion& Region) const;
@@ -231,6 +320,10 @@ private:
 	// Active regions
 	TArray<FWaterActivationRegion> ActiveRegions;
 
+	// Coarse XY grid over ActiveRegions (cell -> region indices), rebuilt whenever the array changes
+	TMap<FIntPoint, TArray<int32>> RegionGrid;
+	float RegionGridCellSize = 2000.0f;
+
 	// Activation queue for performance spreading
 	struct FPendingActivation
 	{
@@ -238,13 +331,25 @@ private:
 		float Radius;
 		int32 Priority;
 		float QueueTime;
+		int32 EvictionRetries = 0;
 	};
 	TArray<FPendingActivation> ActivationQueue;
 
+	// Chunks waiting for a bulk column fill, kept in dependency order (lowest layer first)
+	struct FPendingColumnFill
+	{
+		FFluidChunkCoord ChunkCoord;
+		FVector RegionCenter;
+	};
+	TArray<FPendingColumnFill> PendingColumnFills;
+	TSet<FFluidChunkCoord> PendingColumnFillCoords;
+	float IdleTickInterval = 0.1f;
+
 	// Update timers
 	float RegionUpdateTimer = 0.0f;
 	float DeactivationCheckTimer = 0.0f;
 	float OptimizationTimer = 0.0f;
+	float DeferredTickTime = 0.0f; // Ticks skipped while the simulation thread held the chunks
 
 	// Performance tracking
 	int32 ActivationsThisFrame = 0;
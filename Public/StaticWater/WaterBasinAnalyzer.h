@@ -0,0 +1,119 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Flooded footprint of one basin on the analysis grid
+struct VOXELFLUIDSYSTEM_API FWaterBasinMask
+{
+	FVector2D Origin = FVector2D::ZeroVector; // World XY of the min corner of cell (0, 0)
+	float CellSize = 100.0f;
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	TBitArray<> Cells;
+
+	bool ContainsPoint(const FVector& Point) const
+	{
+		const int32 X = FMath::FloorToInt((Point.X - Origin.X) / CellSize);
+		const int32 Y = FMath::FloorToInt((Point.Y - Origin.Y) / CellSize);
+		if (X < 0 || Y < 0 || X >= SizeX || Y >= SizeY)
+		{
+			return false;
+		}
+		return Cells[X + Y * SizeX];
+	}
+};
+
+struct FWaterBasin
+{
+	float SpillHeight = 0.0f;   // Water level: the height at which the basin overflows
+	float FloorHeight = 0.0f;   // Lowest terrain under the water
+	FBox Bounds = FBox(EForceInit::ForceInit);
+	int32 CellCount = 0;
+	float Volume = 0.0f;        // World units cubed
+	TSharedPtr<const FWaterBasinMask> Mask;
+};
+
+struct FWaterBasinAnalysisSettings
+{
+	FVector2D Origin = FVector2D::ZeroVector; // World XY of the min corner of the analysed area
+	float CellSize = 400.0f;
+	int32 CellsX = 0;
+	int32 CellsY = 0;
+	int32 TileCells = 128;     // Tile edge length in cells; bounds working memory
+	float MinLakeDepth = 50.0f;
+	int32 MinLakeCells = 16;
+};
+
+/**
+ * Tiled priority-flood depression filling over a terrain heightfield
+ * Each tile is flooded from its perimeter once to build a spill graph between watershed labels,
+ * the graph is solved for every label's spill height, then each tile is flooded again and raised
+ * to that height. Memory is one tile plus the tile perimeters, so terrain size is only bounded by time.
+ */
+class VOXELFLUIDSYSTEM_API FWaterBasinAnalyzer
+{
+public:
+	// Fills OutHeights (SizeX * SizeY, indexed X + Y * SizeX) for the cell block starting at CellOrigin
+	typedef TFunction<void(const FIntPoint& CellOrigin, int32 SizeX, int32 SizeY, TArray<float>& OutHeights)> FHeightSampler;
+
+	FWaterBasinAnalyzer(const FWaterBasinAnalysisSettings& InSettings, FHeightSampler InSampler);
+
+	// Process one tile (or the graph solve); returns true once the basins are ready
+	bool Step();
+
+	// Run the whole analysis in one call (offline tools, worker threads with a thread-safe sampler)
+	void Run();
+
+	bool IsComplete() const { return Phase == EPhase::Complete; }
+	float GetProgress() const;
+	const TArray<FWaterBasin>& GetBasins() const { return Basins; }
+
+	// Working memory plus the basin masks found so far
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	enum class EPhase : uint8
+	{
+		FloodTiles,
+		SolveSpillGraph,
+		EmitBasins,
+		Complete
+	};
+
+	struct FTileEdges
+	{
+		// Labels and heights of the perimeter cells, in increasing X (south/north) or Y (west/east) order
+		TArray<int32> SouthLabels, NorthLabels, WestLabels, EastLabels;
+		TArray<float> SouthHeights, NorthHeights, WestHeights, EastHeights;
+	};
+
+	void GetTileRect(int32 TileIndex, FIntPoint& OutOrigin, int32& OutSizeX, int32& OutSizeY) const;
+	int32 FloodTile(const TArray<float>& Heights, int32 SizeX, int32 SizeY, int32 LabelBase,
+		TArray<float>& OutFilled, TArray<int32>& OutLabels, bool bRecordEdges);
+	void AddSpillEdge(int32 LabelA, int32 LabelB, float Elevation);
+	void StitchTileEdges();
+	void SolveSpillGraph();
+	void EmitTileBasins(int32 TileIndex);
+
+	FWaterBasinAnalysisSettings Settings;
+	FHeightSampler Sampler;
+
+	EPhase Phase = EPhase::FloodTiles;
+	int32 NumTilesX = 0;
+	int32 NumTilesY = 0;
+	int32 CurrentTile = 0;
+
+	// Label 0 is the outside of the analysed area, where everything eventually drains
+	int32 NextLabel = 1;
+	TArray<int32> TileLabelBases;
+	TArray<FTileEdges> TileEdges;
+	TMap<uint64, float> SpillEdges; // (min label, max label) -> lowest spill elevation
+	TArray<float> LabelSpillHeights;
+
+	// Scratch buffers reused across tiles
+	TArray<float> TileHeights;
+	TArray<float> TileFilled;
+	TArray<int32> TileLabels;
+
+	TArray<FWaterBasin> Basins;
+};
@@ -3,6 +3,8 @@
 #include "CoreMinimal.h"
 #include "Components/PrimitiveComponent.h"
 #include "Visualization/MarchingCubes.h"
+#include "CellularAutomata/FluidSimulationThread.h"
+#include "VoxelFluidMemory.h"
 #include "FluidVisualizationComponent.generated.h"
 
 class UCAFluidGrid;
@@ -12,6 +14,7 @@ class UInstancedStaticMeshComponent;
 class UFluidChunk;
 class UProceduralMeshComponent;
 class FMarchingCubes;
+struct FConvexVolume;
 
 UENUM(BlueprintType)
 enum class EFluidRenderMode : uint8
@@ -22,7 +25,7 @@ enum class EFluidRenderMode : uint8
 };
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
-class VOXELFLUIDSYSTEM_API UFluidVisualizationComponent : public USceneComponent
+class VOXELFLUIDSYSTEM_API UFluidVisualizationComponent : public USceneComponent, public IFluidMemoryReporter
 {
 	GENERATED_BODY()
 
@@ -31,6 +34,10 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// IFluidMemoryReporter; density grids, generated mesh sections and in-flight mesh tasks
+	virtual void ReportMemory(FFluidMemoryReport& Report) const override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -45,6 +52,12 @@ public:
 	
 	void OnChunkUnloaded(const struct FFluidChunkCoord& ChunkCoord);
 
+	// When set and returning a snapshot, marching cubes meshes are built from it instead of live chunk cells
+	void SetSnapshotSource(TFunction<FFluidSimulationSnapshotPtr()> InSnapshotSource) { SnapshotSource = MoveTemp(InSnapshotSource); }
+
+	// Progress between the last two simulation steps (0-1), set by the owner each frame before UpdateVisualization
+	void SetSimulationInterpolationAlpha(float Alpha) { SimulationStepAlpha = FMath::Clamp(Alpha, 0.0f, 1.0f); }
+
 	UFUNCTION(BlueprintCallable, Category = "Fluid Visualization")
 	void GenerateInstancedVisualization();
 
@@ -81,6 +94,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chunk Visualization", meta = (ClampMin = "1000.0", ClampMax = "100000.0"))
 	float MaxRenderDistance = 30000.0f; // Increased to 300 meters for visible rivers/lakes
 
+	// Skip chunks outside the player camera's frustum for debug boxes and instances
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chunk Visualization")
+	bool bUseFrustumCulling = true;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chunk Visualization")
 	bool bShowChunkBounds = false;
 
@@ -114,6 +131,17 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Marching Cubes")
 	bool bSmoothMeshUpdates = true;
 
+	// Blend snapshot meshes between the last two simulation steps so the surface does not snap at the step rate
+	// Each mesh is built at the latest step and carries per-vertex offsets back to the previous surface in UV1.xy and UV2.x;
+	// the material blends them every frame through StepAlphaParameterName, so chunks are not remeshed to animate
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Marching Cubes")
+	bool bInterpolateSimulationSteps = true;
+
+	// Scalar written to each chunk's material instance every frame; the material's World Position Offset
+	// should be (1 - alpha) * float3(UV1.x, UV1.y, UV2.x)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Marching Cubes", meta = (EditCondition = "bInterpolateSimulationSteps"))
+	FName StepAlphaParameterName = TEXT("SimulationStepAlpha");
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Marching Cubes", meta = (ClampMin = "0.001", ClampMax = "0.1"))
 	float MeshUpdateThreshold = 0.01f;
 
@@ -168,6 +196,7 @@ private:
 	TArray<float> CurrentDensityGrid;
 	TArray<float> InterpolatedDensityGrid;
 	float InterpolationAlpha = 0.0f;
+	float SimulationStepAlpha = 1.0f;
 
 	void DrawDebugFluid();
 	void DrawChunkedDebugFluid();
@@ -184,9 +213,20 @@ private:
 	void RenderFluidChunk(UFluidChunk* Chunk, const FVector& ViewerPosition);
 	bool ShouldRenderChunk(UFluidChunk* Chunk, const FVector& ViewerPosition) const;
 	FVector GetPrimaryViewerPosition() const;
+	bool GetPrimaryViewFrustum(FConvexVolume& OutFrustum) const;
+	TArray<UFluidChunk*> GetChunksInView(const FVector& ViewerPosition) const;
 	void DrawChunkBounds() const;
 	int32 CalculateLODLevel(float Distance) const;
-	void GenerateChunkMeshWithLOD(UFluidChunk* Chunk, int32 LODLevel, TArray<FMarchingCubes::FMarchingCubesVertex>& OutVertices, TArray<FMarchingCubes::FMarchingCubesTriangle>& OutTriangles);
+	void GenerateChunkMeshWithLOD(UFluidChunk* Chunk, int32 LODLevel, TArray<FMarchingCubes::FMarchingCubesVertex>& OutVertices, TArray<FMarchingCubes::FMarchingCubesTriangle>& OutTriangles,
+		TArray<FVector>* OutStepOffsets = nullptr, uint64* OutSnapshotStep = nullptr);
+	// OutStepOffsets, when given, receives each vertex's offset back to the previous step's surface (zero if the chunk did not step)
+	static bool GenerateSnapshotChunkMesh(const FFluidSimulationSnapshot& Snapshot, const FFluidChunkCoord& Coord, float IsoLevel,
+		TArray<FMarchingCubes::FMarchingCubesVertex>& OutVertices, TArray<FMarchingCubes::FMarchingCubesTriangle>& OutTriangles, TArray<FVector>* OutStepOffsets = nullptr);
+	static void PackStepOffsets(const TArray<FVector>& StepOffsets, TArray<FVector2D>& OutUV1, TArray<FVector2D>& OutUV2);
+	void UpdateMeshStepBlend();
+	FFluidSimulationSnapshotPtr GetSimulationSnapshot() const { return SnapshotSource ? SnapshotSource() : FFluidSimulationSnapshotPtr(); }
+
+	TFunction<FFluidSimulationSnapshotPtr()> SnapshotSource;
 	
 	TMap<UFluidChunk*, UInstancedStaticMeshComponent*> ChunkMeshComponents;
 	TMap<UFluidChunk*, UProceduralMeshComponent*> ChunkMarchingCubesMeshes;
@@ -194,6 +234,7 @@ private:
 	// Optimization: Track chunks that need mesh updates
 	TSet<UFluidChunk*> ChunksNeedingMeshUpdate;
 	TMap<UFluidChunk*, float> ChunkLastMeshUpdateTime;
+	TMap<UFluidChunk*, uint64> ChunkMeshSteps; // Snapshot step each chunk's mesh and step offsets were built from
 	UPROPERTY(EditAnywhere)
 	float ChunkMeshCheckInterval = 0.1f; // Check chunks less frequently
 	float ChunkMeshCheckTimer = 0.0f;
@@ -211,6 +252,9 @@ private:
 		TArray<FVector> Normals;
 		TArray<FVector2D> UVs;
 		TArray<FColor> VertexColors;
+		TArray<FVector2D> StepOffsetsXY;
+		TArray<FVector2D> StepOffsetsZ;
+		uint64 SnapshotStep = 0;
 		bool bCompleted;
 		bool bStarted;
 		
@@ -219,7 +263,7 @@ private:
 	};
 	
 	TArray<TSharedPtr<FAsyncMeshGenerationTask>> AsyncMeshTasks;
-	FCriticalSection AsyncTaskMutex;
+	mutable FCriticalSection AsyncTaskMutex;
 	
 	// Performance tracking
 	float CurrentFrameMeshGenTime = 0.0f;
@@ -158,6 +158,12 @@ public:
                                              TArray<FMarchingCubesVertex>& OutVertices,
                                              TArray<FMarchingCubesTriangle>& OutTriangles);
 
+    /**
+     * Trilinear interpolation of density values
+     */
+    static float TrilinearInterpolate(const TArray<float>& DensityGrid, const FIntVector& GridSize,
+                                    const FVector& Position, float CellSize, const FVector& GridOrigin);
+    
 private:
     /**
      * Interpolate vertex position along an edge based on density values
@@ -186,12 +192,6 @@ private:
     static float GetDensityAt(const TArray<float>& DensityGrid, const FIntVector& GridSize, 
                             int32 X, int32 Y, int32 Z);
     
-    /**
-     * Trilinear interpolation of density values
-     */
-    static float TrilinearInterpolate(const TArray<float>& DensityGrid, const FIntVector& GridSize,
-                                    const FVector& Position, float CellSize, const FVector& GridOrigin);
-    
     /**
      * Sample density at a fractional grid position using trilinear interpolation
      */
@@ -1,11 +1,33 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include <atomic>
 
 // Forward declaration
 class AVoxelFluidActor;
 
+// Diagnostics (hot-path logs and the trace ring) are compiled out of shipping and test builds
+#ifndef VOXELFLUID_DIAGNOSTICS
+	#define VOXELFLUID_DIAGNOSTICS !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+#endif
+
+#if VOXELFLUID_DIAGNOSTICS
+	#define VOXELFLUID_LOG_COMPILE_VERBOSITY All
+#else
+	#define VOXELFLUID_LOG_COMPILE_VERBOSITY Warning
+#endif
+
+// Per-subsystem categories; anything below Warning is stripped at compile time when diagnostics are off
+// Raise at runtime with e.g. "log LogVoxelFluidRender Verbose"
+DECLARE_LOG_CATEGORY_EXTERN(LogVoxelFluidSim, Warning, VOXELFLUID_LOG_COMPILE_VERBOSITY);
+DECLARE_LOG_CATEGORY_EXTERN(LogVoxelFluidStreaming, Warning, VOXELFLUID_LOG_COMPILE_VERBOSITY);
+DECLARE_LOG_CATEGORY_EXTERN(LogVoxelFluidStaticWater, Warning, VOXELFLUID_LOG_COMPILE_VERBOSITY);
+DECLARE_LOG_CATEGORY_EXTERN(LogVoxelFluidRender, Warning, VOXELFLUID_LOG_COMPILE_VERBOSITY);
+DECLARE_LOG_CATEGORY_EXTERN(LogVoxelFluidActivation, Warning, VOXELFLUID_LOG_COMPILE_VERBOSITY);
+
 // Debug logging macros that respect the debug toggle
+#if VOXELFLUID_DIAGNOSTICS
+
 #define UE_LOG_VOXELFLUID_DEBUG(FluidActor, Verbosity, Format, ...) \
 	do { \
 		if (FluidActor && FluidActor->bEnableDebugLogging) \
@@ -22,11 +44,120 @@ class AVoxelFluidActor;
 		} \
 	} while(0)
 
+// Hot-path logging: the category's runtime verbosity is checked before any formatting happens
+#define VOXELFLUID_LOG(Category, Verbosity, Format, ...) \
+	UE_LOG(Category, Verbosity, Format, ##__VA_ARGS__)
+
+#define VOXELFLUID_CLOG(Condition, Category, Verbosity, Format, ...) \
+	UE_CLOG(Condition, Category, Verbosity, Format, ##__VA_ARGS__)
+
+#else
+
+#define UE_LOG_VOXELFLUID_DEBUG(FluidActor, Verbosity, Format, ...) do { } while(0)
+#define UE_LOG_VOXELFLUID_DEBUG_CONDITIONAL(FluidActor, Condition, Verbosity, Format, ...) do { } while(0)
+#define VOXELFLUID_LOG(Category, Verbosity, Format, ...) do { } while(0)
+#define VOXELFLUID_CLOG(Condition, Category, Verbosity, Format, ...) do { } while(0)
+
+#endif
+
 // For components that don't have direct access to FluidActor, use a global debug flag
 DECLARE_LOG_CATEGORY_EXTERN(LogVoxelFluidDebug, Log, All);
 
+#if VOXELFLUID_DIAGNOSTICS
 #define UE_LOG_VOXELFLUID_COMPONENT_DEBUG(Verbosity, Format, ...) \
 	UE_CLOG(CVarEnableVoxelFluidDebugLogging.GetValueOnGameThread(), LogVoxelFluidDebug, Verbosity, Format, ##__VA_ARGS__)
+#else
+#define UE_LOG_VOXELFLUID_COMPONENT_DEBUG(Verbosity, Format, ...) do { } while(0)
+#endif
 
 // Console variable for global debug logging
-extern TAutoConsoleVariable<bool> CVarEnableVoxelFluidDebugLogging;
\ No newline at end of file
+extern TAutoConsoleVariable<bool> CVarEnableVoxelFluidDebugLogging;
+
+// Structured trace events; payload meaning is listed per event
+enum class EVoxelFluidTraceEvent : uint16
+{
+	None,
+
+	// Simulation chunks: A,B,C = chunk coord
+	ChunkLoaded,
+	ChunkUnloaded,
+	ChunkActivated,
+	ChunkSettled,
+	ChunkDeactivated,
+	FluidAdded,            // Value = amount
+	EditActivation,        // A = chunks activated, Value = radius
+
+	// Static water render chunks: A,B = render chunk coord, C = LOD
+	RenderChunkQueued,     // Value = distance
+	RenderChunkLoaded,     // Value = distance
+	RenderChunkUnloaded,
+	RenderChunkHidden,     // Chunk covered by active simulation
+	RenderMeshBuilt,       // A = vertices, B = triangles, Value = build ms
+	RenderMeshEmpty,
+	RenderLoadQueue,       // A = queued, B = active, C = loaded
+
+	// Static water: Value = water level or height
+	OceanCreated,
+	OceanMoved,            // A,B = new centre XY
+	StaticTileGenerated,   // A,B = tile coord
+
+	// Activation regions: A,B = centre XY
+	RegionActivated,       // Value = radius
+	RegionDeactivated,     // Value = simulated volume
+	RegionEvicted,         // Value = eviction cost
+
+	Count
+};
+
+// The ring and its console commands only exist in diagnostics builds
+#if VOXELFLUID_DIAGNOSTICS
+struct FVoxelFluidTraceRecord
+{
+	double Time = 0.0;
+	uint64 Sequence = 0;
+	uint32 ThreadId = 0;
+	EVoxelFluidTraceEvent Event = EVoxelFluidTraceEvent::None;
+	int32 A = 0;
+	int32 B = 0;
+	int32 C = 0;
+	float Value = 0.0f;
+};
+
+/**
+ * Fixed-size in-memory ring of structured events, safe to write from any thread without locks
+ * Writers claim a slot with one atomic increment and publish it with a per-slot sequence number;
+ * readers skip slots that are mid-write. Nothing is formatted until the ring is dumped.
+ */
+class VOXELFLUIDSYSTEM_API FVoxelFluidTrace
+{
+public:
+	static constexpr uint32 Capacity = 4096; // Must be a power of two
+
+	static void Record(EVoxelFluidTraceEvent Event, int32 A = 0, int32 B = 0, int32 C = 0, float Value = 0.0f);
+
+	// Copies the most recent published records, oldest first
+	static void Snapshot(TArray<FVoxelFluidTraceRecord>& OutRecords, int32 MaxRecords = Capacity);
+
+	static void Dump(FOutputDevice& Ar, int32 MaxRecords = 256);
+	static void Reset();
+
+	static uint64 GetTotalRecorded() { return Head.load(std::memory_order_relaxed); }
+	static bool IsEnabled();
+	static const TCHAR* GetEventName(EVoxelFluidTraceEvent Event);
+
+private:
+	struct FSlot
+	{
+		std::atomic<uint64> Sequence{0}; // Index + 1 once published, 0 while empty or being written
+		FVoxelFluidTraceRecord Record;
+	};
+
+	static FSlot Slots[Capacity];
+	static std::atomic<uint64> Head;
+	static std::atomic<uint64> ResetIndex; // Records at or before this index are hidden after Reset()
+};
+
+#define VOXELFLUID_TRACE(Event, ...) FVoxelFluidTrace::Record(EVoxelFluidTraceEvent::Event, ##__VA_ARGS__)
+#else
+#define VOXELFLUID_TRACE(Event, ...) do { } while(0)
+#endif
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "CellularAutomata/FluidBulkEdit.h"
 #include "VoxelFluidFunctionLibrary.generated.h"
 
 class AVoxelFluidActor;
@@ -25,12 +26,44 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid")
 	static void CreateFluidSplash(AVoxelFluidActor* FluidActor, const FVector& ImpactLocation, float SplashRadius = 200.0f, float SplashAmount = 0.5f);
 
+	// Bulk edits: every affected cell is grouped per chunk and applied in one parallel pass
+	// Amounts are in cell units (1.0 fills a cell) and are not scaled by the actor's density settings
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid|Bulk Edit")
+	static FFluidBulkEditResult FillFluidSphere(AVoxelFluidActor* FluidActor, const FVector& Center, float Radius, float Amount = 1.0f, bool bFalloff = false);
+
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid|Bulk Edit")
+	static FFluidBulkEditResult DrainFluidSphere(AVoxelFluidActor* FluidActor, const FVector& Center, float Radius, float Amount = 1.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid|Bulk Edit")
+	static FFluidBulkEditResult FillFluidBox(AVoxelFluidActor* FluidActor, const FBox& Box, float Amount = 1.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid|Bulk Edit")
+	static FFluidBulkEditResult DrainFluidBox(AVoxelFluidActor* FluidActor, const FBox& Box, float Amount = 1.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid|Bulk Edit")
+	static FFluidBulkEditResult SetFluidLevelInBox(AVoxelFluidActor* FluidActor, const FBox& Box, float Level);
+
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid|Bulk Edit")
+	static FFluidBulkEditResult SetFluidLevelInSphere(AVoxelFluidActor* FluidActor, const FVector& Center, float Radius, float Level);
+
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid|Bulk Edit")
+	static FFluidBulkEditResult AddFluidAtLocations(AVoxelFluidActor* FluidActor, const TArray<FVector>& Locations, float AmountPerLocation);
+
+	// Flood (or with bDrain, empty) columns on an XY grid from FloorZ up to each column's surface height
+	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid|Bulk Edit")
+	static FFluidBulkEditResult FloodFluidHeightfield(AVoxelFluidActor* FluidActor, const FVector2D& GridOrigin, float GridSpacing,
+		int32 SizeX, int32 SizeY, const TArray<float>& SurfaceHeights, float FloorZ, bool bDrain = false);
+
 	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid", meta = (WorldContext = "WorldContextObject"))
 	static void SyncAllFluidActorsWithTerrain(UObject* WorldContextObject);
 
 	UFUNCTION(BlueprintPure, Category = "Voxel Fluid")
 	static float GetFluidDepthAtLocation(AVoxelFluidActor* FluidActor, const FVector& WorldLocation);
 
+	// Water current at a location in world units per second (zero outside simulated water)
+	UFUNCTION(BlueprintPure, Category = "Voxel Fluid")
+	static FVector GetFluidVelocityAtLocation(AVoxelFluidActor* FluidActor, const FVector& WorldLocation);
+
 	UFUNCTION(BlueprintPure, Category = "Voxel Fluid")
 	static bool IsLocationSubmerged(AVoxelFluidActor* FluidActor, const FVector& WorldLocation, float MinDepth = 10.0f);
 
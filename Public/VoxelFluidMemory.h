@@ -0,0 +1,173 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelFluidDebug.h"
+#include <atomic>
+
+class UFluidChunkManager;
+
+// Where fluid memory goes; each subsystem reports its allocations into one or more of these
+enum class EFluidMemoryCategory : uint8
+{
+	ChunkCells,       // Dense Cells/NextCells and the chunk objects
+	ChunkSparse,      // Sparse maps, active index sets and sparse blocks
+	ChunkBorders,     // Pending border data and neighbour sets
+	ChunkFlow,        // Per-brick flow fields
+	ChunkMeshCache,   // Mesh data stored on chunks
+	ChunkPersistence, // Serialized chunks in the manager's cache
+	ChunkBookkeeping, // Manager maps and sets keyed by chunk
+	Snapshots,        // Simulation thread snapshots
+	MeshBuffers,      // Visualization density grids and in-flight mesh tasks
+	TerrainCache,     // Terrain height and voxel caches
+	StaticWater,      // Static water regions, tiles and per-chunk caches
+	StaticWaterRender,// Static water render chunk meshes
+	Activation,       // Activation regions and pending column fills
+	Count
+};
+
+VOXELFLUIDSYSTEM_API const TCHAR* LexToString(EFluidMemoryCategory Category);
+
+// Allocated bytes per category
+struct VOXELFLUIDSYSTEM_API FFluidMemoryReport
+{
+	int64 Bytes[(int32)EFluidMemoryCategory::Count] = {};
+
+	void Add(EFluidMemoryCategory Category, SIZE_T InBytes) { Bytes[(int32)Category] += (int64)InBytes; }
+	int64 Get(EFluidMemoryCategory Category) const { return Bytes[(int32)Category]; }
+	int64 GetTotal() const;
+
+	// Sum of the Chunk* categories
+	int64 GetChunkTotal() const;
+
+	FFluidMemoryReport& operator+=(const FFluidMemoryReport& Other);
+	FString ToString() const;
+};
+
+// Implemented by the objects that own fluid memory; they add what they have allocated, not estimates
+class VOXELFLUIDSYSTEM_API IFluidMemoryReporter
+{
+public:
+	virtual ~IFluidMemoryReporter() = default;
+	virtual void ReportMemory(FFluidMemoryReport& Report) const = 0;
+
+	// Manager whose simulation lock must be held while reporting; null when the reporter only changes on the game thread
+	virtual UFluidChunkManager* GetSimulationManager() const { return nullptr; }
+};
+
+/**
+ * Registry of live memory reporters with per-category high-water marks
+ * Reporters register for as long as they own memory (Initialize/BeginPlay to BeginDestroy/EndPlay).
+ * Capture walks all of them on the game thread, holding off each chunk manager's simulation thread while it
+ * reports, and publishes the totals to the VoxelFluid memory stats;
+ * "voxelfluid.Memory" prints the current and peak breakdown.
+ */
+class VOXELFLUIDSYSTEM_API FFluidMemoryTracker
+{
+public:
+	static void Register(const IFluidMemoryReporter* Reporter);
+	static void Unregister(const IFluidMemoryReporter* Reporter);
+
+	static FFluidMemoryReport Capture();
+	static FFluidMemoryReport GetLastReport();
+
+	// High-water marks since the last reset; each category peaks independently
+	static FFluidMemoryReport GetPeakReport();
+	static int64 GetPeakTotal();
+	static void ResetPeaks();
+
+	static void Dump(FOutputDevice& Ar);
+
+private:
+	static FCriticalSection Mutex;
+	static TArray<const IFluidMemoryReporter*> Reporters;
+	static FFluidMemoryReport LastReport;
+	static FFluidMemoryReport PeakReport;
+	static int64 PeakTotal;
+};
+
+// Heap allocations charged to one call site
+struct FFluidAllocationSite
+{
+	const TCHAR* Site = nullptr;
+	int64 Allocs = 0;
+	int64 Bytes = 0;
+};
+
+struct VOXELFLUIDSYSTEM_API FFluidAllocationReport
+{
+	int64 Allocs = 0;
+	int64 Bytes = 0;
+	TArray<FFluidAllocationSite> Sites; // Most allocations first, sites with none omitted
+
+	const FFluidAllocationSite* FindSite(const TCHAR* Site) const;
+	FString ToString() const;
+};
+
+/**
+ * Counts heap allocations made inside VOXELFLUID_ALLOC_SCOPE call sites, per site and per step
+ * Counting needs a forwarding FMalloc in front of GMalloc, installed once during startup when the command line
+ * has -FluidAllocTracking or -allocbudget= and put back on exit; without it SetEnabled(true) does nothing.
+ * Each allocation (and realloc) is charged to the innermost scope on the allocating thread and anything outside
+ * a scope is ignored. BeginStep/EndStep bracket one simulation step from whichever thread steps.
+ * Tracking and scopes compile out without VOXELFLUID_DIAGNOSTICS.
+ */
+class VOXELFLUIDSYSTEM_API FFluidAllocationTracker
+{
+public:
+	static constexpr int32 MaxSites = 64;
+
+	// False when the proxy was not installed at startup or diagnostics are compiled out
+	static bool IsAvailable();
+	static void SetEnabled(bool bInEnabled);
+	static bool IsEnabled() { return bEnabled.load(std::memory_order_relaxed); }
+	static void Reset();
+
+	static void BeginStep();
+	static FFluidAllocationReport EndStep(); // Allocations since BeginStep
+	static FFluidAllocationReport GetLastStep();
+	static FFluidAllocationReport GetTotals(); // Since the last Reset
+	static int64 GetMaxStepAllocs();
+	static int64 GetStepCount();
+
+	// From the malloc proxy; must not allocate
+	static void NoteAllocation(SIZE_T Size);
+
+	class VOXELFLUIDSYSTEM_API FScope
+	{
+	public:
+		explicit FScope(const TCHAR* InSite);
+		~FScope();
+
+	private:
+		int32 PreviousSlot = INDEX_NONE;
+		bool bActive = false;
+	};
+
+private:
+	struct FSiteSlot
+	{
+		std::atomic<const TCHAR*> Site{ nullptr };
+		std::atomic<int64> Allocs{ 0 };
+		std::atomic<int64> Bytes{ 0 };
+	};
+
+	// Index into Slots, INDEX_NONE once every slot is taken; scopes resolve it once so allocations never compare names
+	static int32 FindOrAddSlot(const TCHAR* Site);
+	static FFluidAllocationReport BuildReport(const int64* BaseAllocs, const int64* BaseBytes);
+
+	static FSiteSlot Slots[MaxSites];
+	static std::atomic<bool> bEnabled;
+
+	static FCriticalSection Mutex;
+	static int64 StepBaseAllocs[MaxSites];
+	static int64 StepBaseBytes[MaxSites];
+	static FFluidAllocationReport LastStep;
+	static int64 MaxStepAllocs;
+	static int64 StepCount;
+};
+
+#if VOXELFLUID_DIAGNOSTICS
+#define VOXELFLUID_ALLOC_SCOPE(Site) FFluidAllocationTracker::FScope PREPROCESSOR_JOIN(FluidAllocScope, __LINE__)(TEXT(Site))
+#else
+#define VOXELFLUID_ALLOC_SCOPE(Site)
+#endif
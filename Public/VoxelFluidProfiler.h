@@ -0,0 +1,247 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CellularAutomata/FluidChunk.h"
+#include <atomic>
+
+class UFluidChunkManager;
+
+// Work the frame profiler attributes time and hitches to
+enum class EFluidFramePhase : uint8
+{
+	Simulation,
+	BorderSync,
+	Streaming,
+	TerrainSampling,
+	Meshing,
+	StaticWater,
+	Count
+};
+
+VOXELFLUIDSYSTEM_API const TCHAR* LexToString(EFluidFramePhase Phase);
+
+// Log-bucketed timing histogram; percentiles are exact to one bucket (5%) and memory stays fixed
+struct VOXELFLUIDSYSTEM_API FFluidTimingHistogram
+{
+	static constexpr double MinBucketMs = 0.01;
+	static constexpr double BucketGrowth = 1.05;
+	static constexpr int32 NumBuckets = 300; // Up to ~22 seconds
+
+	void AddSample(double Ms);
+	void Reset();
+
+	// Upper bound of the bucket holding the percentile, clamped to the largest sample
+	double GetPercentile(double Percentile) const;
+	double GetMean() const { return Count > 0 ? SumMs / Count : 0.0; }
+	double GetMax() const { return MaxMs; }
+	int64 GetCount() const { return Count; }
+
+private:
+	static int32 GetBucket(double Ms);
+	static double GetBucketUpperMs(int32 Bucket);
+
+	uint32 Buckets[NumBuckets] = {};
+	int64 Count = 0;
+	double SumMs = 0.0;
+	double MaxMs = 0.0;
+};
+
+struct FFluidHitchChunk
+{
+	FFluidChunkCoord Coord;
+	double Ms = 0.0;
+};
+
+// A frame whose fluid work exceeded the hitch threshold, blamed on its most expensive phase
+struct VOXELFLUIDSYSTEM_API FFluidHitchRecord
+{
+	uint64 Frame = 0;
+	double FrameMs = 0.0; // Engine frame time
+	double FluidMs = 0.0; // All fluid phases this frame
+	EFluidFramePhase Phase = EFluidFramePhase::Simulation;
+	double PhaseMs = 0.0;
+	int32 Steps = 0; // Simulation steps run this frame; catch-up frames run several
+	double MaxStepMs = 0.0;
+	TArray<FFluidHitchChunk, TInlineAllocator<4>> Chunks; // Slowest chunks of Phase, slowest first
+
+	FString ToString() const;
+};
+
+/**
+ * Per-frame timing of the fluid phases, with histograms and a hitch log
+ * Phases are timed with FScopedPhase; nested scopes are exclusive, so a chunk load that applies static
+ * water counts the static water time once, under StaticWater. Scopes may run on the game or simulation
+ * thread and are grouped by engine frame. Simulation steps are also sampled one by one, since a frame that
+ * catches up runs several and its phase time is their sum. Disabled profilers cost one atomic load per scope.
+ */
+class VOXELFLUIDSYSTEM_API FFluidFrameProfiler
+{
+public:
+	static constexpr int32 MaxChunksPerPhase = 3;
+	static constexpr int32 MaxHitchRecords = 256;
+
+	static FFluidFrameProfiler* Get(const UFluidChunkManager* ChunkManager);
+
+	void SetEnabled(bool bInEnabled) { bEnabled.store(bInEnabled, std::memory_order_relaxed); }
+	bool IsEnabled() const { return bEnabled.load(std::memory_order_relaxed); }
+	void SetHitchThresholdMs(double InThresholdMs);
+	void Reset();
+
+	// Game thread, once per frame; closes the previous frame even if no phase ran in it
+	void TickFrame();
+
+	void AddPhaseTime(EFluidFramePhase Phase, double Ms);
+
+	// Once per UpdateSimulation step, from whichever thread runs it
+	void RecordStep(double Ms);
+
+	// Attribute time within a phase to a chunk without adding to the phase total (e.g. from parallel workers)
+	void NoteChunk(EFluidFramePhase Phase, const FFluidChunkCoord& Coord, double Ms);
+
+	FFluidTimingHistogram GetPhaseHistogram(EFluidFramePhase Phase) const;
+	FFluidTimingHistogram GetFrameHistogram() const;
+	FFluidTimingHistogram GetFluidHistogram() const;
+	FFluidTimingHistogram GetStepHistogram() const;
+	double GetLastFramePhaseMs(EFluidFramePhase Phase) const;
+	TArray<FFluidHitchRecord> GetHitches() const; // Oldest first
+	int32 GetTotalHitchCount() const;
+
+	class VOXELFLUIDSYSTEM_API FScopedPhase
+	{
+	public:
+		FScopedPhase(FFluidFrameProfiler* InProfiler, EFluidFramePhase InPhase);
+		FScopedPhase(FFluidFrameProfiler* InProfiler, EFluidFramePhase InPhase, const FFluidChunkCoord& InCoord);
+		~FScopedPhase();
+
+	private:
+		FFluidFrameProfiler* Profiler = nullptr;
+		FScopedPhase* Parent = nullptr;
+		EFluidFramePhase Phase;
+		FFluidChunkCoord Coord;
+		bool bHasCoord = false;
+		double StartTime = 0.0;
+		double ChildMs = 0.0;
+	};
+
+private:
+	struct FFramePhase
+	{
+		double Ms = 0.0;
+		TArray<FFluidHitchChunk, TInlineAllocator<MaxChunksPerPhase>> Chunks;
+	};
+
+	void SyncFrame_Locked();
+	void CloseFrame_Locked();
+	void NoteChunk_Locked(EFluidFramePhase Phase, const FFluidChunkCoord& Coord, double Ms);
+
+	mutable FCriticalSection Mutex;
+	std::atomic<bool> bEnabled{ false };
+	double HitchThresholdMs = 8.0;
+
+	uint64 OpenFrame = 0;
+	bool bFrameOpen = false;
+	FFramePhase CurrentPhases[(int32)EFluidFramePhase::Count];
+	double LastFramePhaseMs[(int32)EFluidFramePhase::Count] = {};
+	int32 CurrentSteps = 0;
+	double CurrentMaxStepMs = 0.0;
+
+	FFluidTimingHistogram PhaseHistograms[(int32)EFluidFramePhase::Count];
+	FFluidTimingHistogram FrameHistogram;
+	FFluidTimingHistogram FluidHistogram;
+	FFluidTimingHistogram StepHistogram;
+
+	TArray<FFluidHitchRecord> Hitches; // Ring buffer
+	int32 NextHitchIndex = 0;
+	int32 TotalHitches = 0;
+};
+
+// Ranking used when asking the chunk profiler for its worst chunks; larger is worse for all of them
+enum class EFluidChunkProfileMetric : uint8
+{
+	TotalMs,
+	StepMs,
+	MaxStepMs,
+	BorderSyncMs,
+	CellsProcessed,
+	UnsettledRatio,
+	Remeshes,
+	Count
+};
+
+VOXELFLUIDSYSTEM_API const TCHAR* LexToString(EFluidChunkProfileMetric Metric);
+
+// Counters for one chunk since the chunk profiler was last reset
+struct VOXELFLUIDSYSTEM_API FFluidChunkProfile
+{
+	FFluidChunkCoord Coord;
+	int32 Steps = 0;
+	double StepMs = 0.0;
+	double MaxStepMs = 0.0;
+	int32 BorderSyncs = 0;
+	double BorderSyncMs = 0.0; // Half of each pair sync with a neighbour
+	int64 CellsProcessed = 0;
+	int64 UnsettledCells = 0;
+	int32 Remeshes = 0;
+	double RemeshMs = 0.0;
+
+	double GetTotalMs() const { return StepMs + BorderSyncMs + RemeshMs; }
+	double GetMeanStepMs() const { return Steps > 0 ? StepMs / Steps : 0.0; }
+
+	// Fraction of processed cells that moved less than the settle threshold; 1 when nothing was processed
+	double GetSettleRatio() const { return CellsProcessed > 0 ? 1.0 - (double)UnsettledCells / CellsProcessed : 1.0; }
+
+	double GetMetric(EFluidChunkProfileMetric Metric) const;
+};
+
+/**
+ * Optional per-chunk timing and counters, for finding the one chunk (a waterfall, a border-thrashing pair)
+ * behind an aggregate stat. Records steps, border syncs and remeshes keyed by chunk coordinate; the result
+ * can be ranked at runtime or exported as a CSV/JSON heatmap. Disabled profilers cost one atomic load per call.
+ */
+class VOXELFLUIDSYSTEM_API FFluidChunkProfiler
+{
+public:
+	static FFluidChunkProfiler* Get(const UFluidChunkManager* ChunkManager);
+
+	void SetEnabled(bool bInEnabled);
+	bool IsEnabled() const { return bEnabled.load(std::memory_order_relaxed); }
+	void Reset();
+
+	// Safe to call from simulation workers
+	void RecordStep(const FFluidChunkCoord& Coord, double Ms, int32 CellsProcessed, int32 UnsettledCells);
+	void RecordBorderSync(const FFluidChunkCoord& Coord, double Ms);
+	void RecordRemesh(const FFluidChunkCoord& Coord, double Ms);
+
+	int32 GetNumChunks() const;
+	double GetRecordedSeconds() const;
+	TArray<FFluidChunkProfile> GetProfiles() const; // Sorted by Z, Y, X
+	TArray<FFluidChunkProfile> GetWorstChunks(int32 Count, EFluidChunkProfileMetric Metric) const;
+	FString GetWorstChunksReport(int32 Count, EFluidChunkProfileMetric Metric) const;
+
+	// One row per chunk coordinate
+	FString ToCSV() const;
+	FString ToJson() const;
+
+	// Writes JSON for a .json path and CSV otherwise
+	bool SaveHeatmap(const FString& FilePath) const;
+
+	class VOXELFLUIDSYSTEM_API FScopedRemesh
+	{
+	public:
+		FScopedRemesh(FFluidChunkProfiler* InProfiler, const FFluidChunkCoord& InCoord);
+		~FScopedRemesh();
+
+	private:
+		FFluidChunkProfiler* Profiler = nullptr;
+		FFluidChunkCoord Coord;
+		double StartTime = 0.0;
+	};
+
+private:
+	FFluidChunkProfile& FindOrAdd_Locked(const FFluidChunkCoord& Coord);
+
+	mutable FCriticalSection Mutex;
+	std::atomic<bool> bEnabled{ false };
+	TMap<FFluidChunkCoord, FFluidChunkProfile> Profiles;
+	double StartTime = 0.0;
+};
@@ -67,6 +67,7 @@ DECLARE_DWORD_COUNTER_STAT(TEXT("_Static Water Cells"), STAT_VoxelFluid_StaticWa
 DECLARE_CYCLE_STAT(TEXT("_Apply Gravity"), STAT_VoxelFluid_ApplyGravity, STATGROUP_VoxelFluid);
 DECLARE_CYCLE_STAT(TEXT("_Apply Flow Rules"), STAT_VoxelFluid_ApplyFlowRules, STATGROUP_VoxelFluid);
 DECLARE_CYCLE_STAT(TEXT("_Apply Pressure"), STAT_VoxelFluid_ApplyPressure, STATGROUP_VoxelFluid);
+DECLARE_CYCLE_STAT(TEXT("_Apply Column Pressure"), STAT_VoxelFluid_ApplyColumnPressure, STATGROUP_VoxelFluid);
 
 // Visualization detail stats
 DECLARE_CYCLE_STAT(TEXT("_Visualization"), STAT_VoxelFluid_Visualization, STATGROUP_VoxelFluid);
@@ -100,6 +101,38 @@ DECLARE_CYCLE_STAT(TEXT("_Border Sync"), STAT_VoxelFluid_BorderSync, STATGROUP_V
 DECLARE_CYCLE_STAT(TEXT("_Fluid Source Update"), STAT_VoxelFluid_FluidSourceUpdate, STATGROUP_VoxelFluid);
 DECLARE_CYCLE_STAT(TEXT("_Dynamic Refill"), STAT_VoxelFluid_DynamicRefill, STATGROUP_VoxelFluid);
 
+// Simulation thread stats
+DECLARE_CYCLE_STAT(TEXT("_Sim Snapshot"), STAT_VoxelFluid_SimSnapshot, STATGROUP_VoxelFluid);
+DECLARE_CYCLE_STAT(TEXT("_Sim Thread Sync"), STAT_VoxelFluid_SimThreadSync, STATGROUP_VoxelFluid);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("_Sim Thread Step MS"), STAT_VoxelFluid_SimThreadStepMS, STATGROUP_VoxelFluid);
+
+// Step scheduling stats
+DECLARE_DWORD_COUNTER_STAT(TEXT("_Sim Steps/Frame"), STAT_VoxelFluid_SimStepsPerFrame, STATGROUP_VoxelFluid);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("_Sim Time Shed MS"), STAT_VoxelFluid_SimTimeShedMS, STATGROUP_VoxelFluid);
+
 // Sparse grid conversion stats
 DECLARE_CYCLE_STAT(TEXT("_Convert To Sparse"), STAT_VoxelFluid_ConvertToSparse, STATGROUP_VoxelFluid);
-DECLARE_CYCLE_STAT(TEXT("_Convert To Dense"), STAT_VoxelFluid_ConvertToDense, STATGROUP_VoxelFluid);
\ No newline at end of file
+DECLARE_CYCLE_STAT(TEXT("_Convert To Dense"), STAT_VoxelFluid_ConvertToDense, STATGROUP_VoxelFluid);
+
+// Memory, from FFluidMemoryTracker::Capture
+DECLARE_MEMORY_STAT(TEXT("_Mem Total"), STAT_VoxelFluid_MemTotal, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Peak"), STAT_VoxelFluid_MemPeak, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Chunk Cells"), STAT_VoxelFluid_MemChunkCells, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Chunk Sparse"), STAT_VoxelFluid_MemChunkSparse, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Chunk Borders"), STAT_VoxelFluid_MemChunkBorders, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Chunk Flow"), STAT_VoxelFluid_MemChunkFlow, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Chunk Mesh Cache"), STAT_VoxelFluid_MemChunkMeshCache, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Chunk Persistence"), STAT_VoxelFluid_MemChunkPersistence, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Chunk Bookkeeping"), STAT_VoxelFluid_MemChunkBookkeeping, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Snapshots"), STAT_VoxelFluid_MemSnapshots, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Mesh Buffers"), STAT_VoxelFluid_MemMeshBuffers, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Terrain Cache"), STAT_VoxelFluid_MemTerrainCache, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Static Water"), STAT_VoxelFluid_MemStaticWater, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Static Render"), STAT_VoxelFluid_MemStaticWaterRender, STATGROUP_VoxelFluid);
+DECLARE_MEMORY_STAT(TEXT("_Mem Activation"), STAT_VoxelFluid_MemActivation, STATGROUP_VoxelFluid);
+
+// Mass ledger, from FFluidMassLedger::Audit (volumes in cells of fluid)
+DECLARE_FLOAT_COUNTER_STAT(TEXT("_Mass Volume"), STAT_VoxelFluid_MassVolume, STATGROUP_VoxelFluid);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("_Mass Drift"), STAT_VoxelFluid_MassDrift, STATGROUP_VoxelFluid);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("_Mass Drift/Audit"), STAT_VoxelFluid_MassDriftPerAudit, STATGROUP_VoxelFluid);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("_Mass Clamped"), STAT_VoxelFluid_MassClamped, STATGROUP_VoxelFluid);
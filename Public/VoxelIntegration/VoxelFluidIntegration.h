@@ -5,6 +5,7 @@
 #include "CellularAutomata/CAFluidGrid.h"
 #include "VoxelStackLayer.h"
 #include "VoxelIntegration/VoxelTerrainSampler.h"
+#include "VoxelFluidMemory.h"
 #include "VoxelFluidIntegration.generated.h"
 
 class AActor;
@@ -21,7 +22,7 @@ enum class E3DVoxelQueryMode : uint8
 };
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
-class VOXELFLUIDSYSTEM_API UVoxelFluidIntegration : public UActorComponent
+class VOXELFLUIDSYSTEM_API UVoxelFluidIntegration : public UActorComponent, public IFluidMemoryReporter
 {
 	GENERATED_BODY()
 
@@ -30,9 +31,13 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
+	// IFluidMemoryReporter; terrain caches and batch sampling queues
+	virtual void ReportMemory(FFluidMemoryReport& Report) const override;
+
 	UFUNCTION(BlueprintCallable, Category = "Voxel Fluid")
 	void InitializeFluidSystem(AActor* InVoxelWorld);
 
@@ -199,7 +204,7 @@ private:
 	// Terrain change tracking
 	TMap<FIntVector, bool> CachedVoxelStates;
 	TArray<FBox> PendingTerrainUpdates;
-	FCriticalSection TerrainUpdateMutex;
+	mutable FCriticalSection TerrainUpdateMutex;
 	float LastTerrainRefreshTime = 0.0f;
 	bool bTerrainNeedsRefresh = false;
 
@@ -243,7 +248,7 @@ private:
 	
 	// Async processing
 	bool bIsProcessingBatch = false;
-	FCriticalSection BatchSamplingMutex;
+	mutable FCriticalSection BatchSamplingMutex;
 	
 	// Helper functions
 	FIntPoint WorldPositionToCacheKey(float WorldX, float WorldY) const;
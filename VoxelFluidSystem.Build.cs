@@ -21,7 +21,9 @@ public class VoxelFluidSystem : ModuleRules
 
 		PrivateDependencyModuleNames.AddRange(new string[] { 
 			"RenderCore",
-			"RHI"
+			"RHI",
+			"Json",
+			"Projects"
 		});
 
 		// Uncomment if you are using Slate UI